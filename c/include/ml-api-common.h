@@ -384,6 +384,23 @@ int ml_tensors_data_destroy (ml_tensors_data_h data);
  */
 int ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index, void **raw_data, size_t *data_size);
 
+/**
+ * @brief Gets a read-only tensor data of given handle.
+ * @details This returns the pointer of memory block in the handle without copying it, even if the memory block is shared with other handles or read-only (e.g., the data referred with ml_tensors_data_ref() or the view of serialized blob).
+ *          Do not modify and deallocate the returned tensor data. The pointer is valid until the data handle is destroyed.
+ *          Use ml_tensors_data_get_tensor_data() to update the data.
+ * @since_tizen 10.0
+ * @param[in] data The handle of tensors data.
+ * @param[in] index The index of the tensor.
+ * @param[out] raw_data Raw tensor data in the handle.
+ * @param[out] data_size Byte size of tensor data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_peek_tensor_data (const ml_tensors_data_h data, unsigned int index, const void **raw_data, size_t *data_size);
+
 /**
  * @brief Copies a tensor data to given handle.
  * @since_tizen 5.5
@@ -412,6 +429,23 @@ int ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
  */
 int ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h *out);
 
+/**
+ * @brief Gets new handle referring the tensor buffers of given data without copying.
+ * @details The buffers are reference-counted and kept alive until all handles referring them are destroyed.
+ *          For example, the data given by the sink callback of a pipeline may be kept after the callback returns, holding the buffer of the pipeline.
+ *          The buffers are copied when the application writes the data of a handle (copy-on-write).
+ * @since_tizen 10.0
+ * @remarks The @a out should be released using ml_tensors_data_destroy().
+ * @param[in] in The handle of tensors data to be referred.
+ * @param[out] out The new handle of tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the buffers of @a in cannot be shared. Use ml_tensors_data_clone() in this case.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_ref (const ml_tensors_data_h in, ml_tensors_data_h *out);
+
 /**
  * @brief Gets the tensors information of given tensor data frame.
  * @since_tizen 9.0
@@ -426,6 +460,58 @@ int ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h *out);
  */
 int ml_tensors_data_get_info (const ml_tensors_data_h data, ml_tensors_info_h *info);
 
+/**
+ * @brief Converts the tensors data to the given type, quantizing or dequantizing the values.
+ * @details Every tensor in @a src is converted to @a dst_type. The @a scale and @a zero_point describe the quantization of the integer side:
+ *          integer to floating point: real = (quantized - zero_point) * scale,
+ *          floating point to integer: quantized = round (real / scale) + zero_point, saturated to the range of @a dst_type.
+ *          The @a scale and @a zero_point are ignored if both types are integers or both are floating points.
+ * @since_tizen 10.0
+ * @remarks The @a dst should be released using ml_tensors_data_destroy().
+ * @param[in] src The handle of tensors data to be converted.
+ * @param[in] dst_type The tensor type of converted data.
+ * @param[in] scale The quantization scale. It should be positive if the data is quantized or dequantized.
+ * @param[in] zero_point The quantization zero-point.
+ * @param[out] dst The handle of converted tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_convert (const ml_tensors_data_h src, ml_tensor_type_e dst_type, float scale, int zero_point, ml_tensors_data_h *dst);
+
+/**
+ * @brief Converts the floating point tensors data to bfloat16.
+ * @details Every tensor in @a src should be a floating point type. The converted tensors are #ML_TENSOR_TYPE_UINT16, each element holds the bits of bfloat16 (round-to-nearest-even, NaN is kept as NaN).
+ * @since_tizen 10.0
+ * @remarks The @a dst should be released using ml_tensors_data_destroy().
+ * @param[in] src The handle of tensors data to be converted.
+ * @param[out] dst The handle of converted tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_convert_to_bfloat16 (const ml_tensors_data_h src, ml_tensors_data_h *dst);
+
+/**
+ * @brief Converts the bfloat16 tensors data to the given floating point type.
+ * @details Every tensor in @a src should be #ML_TENSOR_TYPE_UINT16 holding the bits of bfloat16, which is usually converted with ml_tensors_data_convert_to_bfloat16().
+ * @since_tizen 10.0
+ * @remarks The @a dst should be released using ml_tensors_data_destroy().
+ * @param[in] src The handle of tensors data to be converted.
+ * @param[in] dst_type The floating point type of converted data.
+ * @param[out] dst The handle of converted tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_convert_from_bfloat16 (const ml_tensors_data_h src, ml_tensor_type_e dst_type, ml_tensors_data_h *dst);
+
 /**
  * @brief Returns a human-readable string describing the last error.
  * @details This returns a human-readable, null-terminated string describing
@@ -514,6 +600,180 @@ int ml_option_set (ml_option_h option, const char *key, void *value, ml_data_des
  */
 int ml_option_get (ml_option_h option, const char *key, void **value);
 
+/**
+ * @brief Pre-processes an image tensor for the model input: resizes, normalizes and transposes it in a single pass.
+ * @details The @a src should have a single uint8 tensor in NHWC layout (dimension channel:width:height:1).
+ *          The image is resized to the dimension of @a dst_info with bilinear interpolation, normalized with (value - mean) / std and converted to the tensor type of @a dst_info.
+ *          The @a option may have the following keys with string values:
+ *          "layout": The layout of @a dst_info, "NHWC" (default, channel:width:height:1) or "NCHW" (width:height:channel:1).
+ *          "mean": Comma-separated mean values, a single value or one per channel (default 0).
+ *          "std": Comma-separated standard deviations, a single value or one per channel (default 1).
+ *          "num_threads": The max number of threads to process the image, a positive integer (default: decided by the image size).
+ * @since_tizen 10.0
+ * @remarks The @a dst should be released using ml_tensors_data_destroy().
+ * @param[in] src The handle of tensors data with an image tensor.
+ * @param[in] dst_info The handle of tensors information of the pre-processed data.
+ * @param[in] option The handle of ml-option for pre-processing. It can be NULL.
+ * @param[out] dst The handle of pre-processed tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_preprocess (const ml_tensors_data_h src, const ml_tensors_info_h dst_info, const ml_option_h option, ml_tensors_data_h *dst);
+
+/**
+ * @brief A handle of a file of concatenated tensor data frames.
+ * @since_tizen 10.0
+ */
+typedef void *ml_tensors_file_h;
+
+/**
+ * @brief Creates a tensor data frame that maps the raw tensors in the file into memory.
+ * @details The tensors described by @a info are read consecutively from the file without copying them to the heap.
+ *          Modifying the data does not change the file. The file may be removed or changed after this call, however, the changes in the file may be visible through the data handle.
+ *          The @a option may have the following keys with string values:
+ *          "offset": The offset in bytes of the tensors in the file. If it is not given, the file size should be same as the size of tensors data.
+ *          "populate": "true" to read the file in advance while mapping it (MAP_POPULATE, Linux only).
+ *          "advice": The expected access pattern, "normal" (default), "sequential", "random" or "willneed" (madvise).
+ * @since_tizen 10.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a path is relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a path is relevant to external storage.
+ * @remarks The @a data should be released using ml_tensors_data_destroy().
+ * @param[in] path The path of the raw tensors file.
+ * @param[in] info The handle of tensors information of the data in the file.
+ * @param[in] option The handle of ml-option for mapping the file. It can be NULL.
+ * @param[out] data The handle of tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the file.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the file size mismatches the tensors information.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory or map the file.
+ */
+int ml_tensors_data_create_from_file (const char *path, const ml_tensors_info_h info, const ml_option_h option, ml_tensors_data_h *data);
+
+/**
+ * @brief Opens a file of concatenated tensor data frames and maps it into memory.
+ * @details Every frame in the file has the tensors described by @a info, without padding. Trailing bytes shorter than a frame are ignored.
+ *          The @a option has the same keys as ml_tensors_data_create_from_file(), where "offset" is the offset of the first frame.
+ * @since_tizen 10.0
+ * @remarks %http://tizen.org/privilege/mediastorage is needed if @a path is relevant to media storage.
+ * @remarks %http://tizen.org/privilege/externalstorage is needed if @a path is relevant to external storage.
+ * @remarks The @a file should be released using ml_tensors_file_close().
+ * @param[in] path The path of the file.
+ * @param[in] info The handle of tensors information of a frame.
+ * @param[in] option The handle of ml-option for mapping the file. It can be NULL.
+ * @param[out] file The handle of tensors file.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the file.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the file does not have a frame.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory or map the file.
+ */
+int ml_tensors_file_open (const char *path, const ml_tensors_info_h info, const ml_option_h option, ml_tensors_file_h *file);
+
+/**
+ * @brief Closes the tensors file.
+ * @details The frames from the file are still valid until they are destroyed.
+ * @since_tizen 10.0
+ * @param[in] file The handle of tensors file.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_file_close (ml_tensors_file_h file);
+
+/**
+ * @brief Gets the number of frames in the tensors file.
+ * @since_tizen 10.0
+ * @param[in] file The handle of tensors file.
+ * @param[out] count The number of frames.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_file_get_count (ml_tensors_file_h file, unsigned int *count);
+
+/**
+ * @brief Gets a tensor data frame of the given index from the tensors file.
+ * @details The data handle points to the mapped file and does not copy the frame. It can be passed to ml_single_invoke_fast() or ml_pipeline_src_input_data() directly.
+ *          The frame is read-only. The buffer of a tensor is copied when the application gets the data with ml_tensors_data_get_tensor_data() or writes it (copy-on-write), so the handles of the same index do not change each other.
+ * @since_tizen 10.0
+ * @remarks The @a data should be released using ml_tensors_data_destroy().
+ * @param[in] file The handle of tensors file.
+ * @param[in] index The index of the frame.
+ * @param[out] data The handle of tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_file_get_frame (ml_tensors_file_h file, unsigned int index, ml_tensors_data_h *data);
+
+/**
+ * @brief Serializes the tensor data frames and their information into a binary blob.
+ * @details The blob is versioned and each tensor has the header of NNStreamer flexible tensor (GstTensorMetaInfo), so every frame can have different tensors information.
+ *          The offset of each tensor data is aligned to 64 bytes from the start of the blob.
+ *          The @a option may have the key "checksum" with the string value "true" to append CRC32 of the frames, which is verified by ml_tensors_data_validate_serialized().
+ * @since_tizen 10.0
+ * @remarks The @a blob should be released using g_free().
+ * @param[in] frames The array of tensors data handles to be serialized.
+ * @param[in] num_frames The number of frames in @a frames.
+ * @param[in] option The handle of ml-option for serialization. It can be NULL.
+ * @param[out] blob The serialized blob.
+ * @param[out] size The size of @a blob in bytes.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_serialize (const ml_tensors_data_h *frames, unsigned int num_frames, const ml_option_h option, void **blob, size_t *size);
+
+/**
+ * @brief Validates the serialized blob and gets the number of frames in it.
+ * @details This checks the headers of all frames and the checksum if the blob has it.
+ * @since_tizen 10.0
+ * @param[in] blob The serialized blob from ml_tensors_data_serialize().
+ * @param[in] size The size of @a blob in bytes.
+ * @param[out] num_frames The number of frames in the blob.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the version of the blob is not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the blob is truncated or corrupted.
+ */
+int ml_tensors_data_validate_serialized (const void *blob, size_t size, unsigned int *num_frames);
+
+/**
+ * @brief Deserializes a tensor data frame of the given index from the blob.
+ * @details If @a zero_copy is true, the tensors data handle is a read-only view of the blob, and no memory is allocated for the tensor data.
+ *          The view calls @a destroy with @a user_data when the view and its clones are destroyed, so the application can release the blob there (e.g., the reference of the blob for each view).
+ *          If @a destroy is NULL, the application should keep @a blob valid until the handle and its clones are destroyed.
+ *          Use ml_tensors_data_peek_tensor_data() to read the view without copying. Getting the writable data of the view makes a copy of it.
+ *          This does not verify the checksum. Use ml_tensors_data_validate_serialized() for the blob received from untrusted source.
+ * @since_tizen 10.0
+ * @remarks The @a data should be released using ml_tensors_data_destroy().
+ * @param[in] blob The serialized blob from ml_tensors_data_serialize().
+ * @param[in] size The size of @a blob in bytes.
+ * @param[in] index The index of the frame.
+ * @param[in] zero_copy True to get the view of the blob, false to copy the data.
+ * @param[in] destroy The function to be called when the view is destroyed. It is called only if @a zero_copy is true and this function returns #ML_ERROR_NONE. It can be NULL.
+ * @param[in] user_data The data to pass to @a destroy.
+ * @param[out] data The handle of tensors data. Use ml_tensors_data_get_info() to get its information.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the version of the blob is not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the blob is truncated or corrupted.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_deserialize (const void *blob, size_t size, unsigned int index, bool zero_copy, ml_data_destroy_cb destroy, void *user_data, ml_tensors_data_h *data);
+
 /******************
  * ML INFORMATION *
  ******************/
@@ -275,6 +275,40 @@ int ml_single_set_input_info (ml_single_h single, const ml_tensors_info_h info);
  */
 int ml_single_set_timeout (ml_single_h single, unsigned int timeout);
 
+/**
+ * @brief Sets the image pre-processing stage applied to the input data before invoking the model.
+ * @details Once it is set, ml_single_invoke() and ml_single_invoke_fast() accept a single uint8 image tensor in NHWC layout (dimension channel:width:height:1) of any size.
+ *          The image is resized, normalized and converted to the input information of the model. See ml_tensors_data_preprocess() for the keys of @a option.
+ *          Set @a option to NULL to disable the pre-processing stage.
+ * @since_tizen 10.0
+ * @param[in] single The model handle.
+ * @param[in] option The handle of ml-option for pre-processing. The values are parsed and copied, so the caller may release @a option after this call.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_set_preprocess (ml_single_h single, const ml_option_h option);
+
+/**
+ * @brief Sets the conversion of input data to the tensor types of the model.
+ * @details Once it is set, ml_single_invoke() and ml_single_invoke_fast() accept the input data of which tensor types differ from the model, if each tensor has the same number of elements.
+ *          The input data is converted with ml_tensors_data_convert() before invoking the model. The keys of @a option are:
+ *          'scale' (the quantization scale, a positive number, default 1.0),
+ *          'zero_point' (the quantization zero-point, an integer, default 0),
+ *          'bfloat16' ('true' if the #ML_TENSOR_TYPE_UINT16 input of the model is bfloat16, default 'false'. See ml_tensors_data_convert_to_bfloat16()).
+ *          Set @a option to NULL to disable the conversion. The conversion is not applied if the image pre-processing stage is set with ml_single_set_preprocess().
+ * @since_tizen 10.0
+ * @param[in] single The model handle.
+ * @param[in] option The handle of ml-option for input conversion. The values are parsed and copied, so the caller may release @a option after this call.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_set_input_conversion (ml_single_h single, const ml_option_h option);
+
 /**
  * @brief Sets the property value for the given model.
  * @details Note that a model/framework may not support changing the property after opening the model.
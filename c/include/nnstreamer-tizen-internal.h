@@ -61,6 +61,38 @@ void ml_api_get_version (unsigned int *major, unsigned int *minor, unsigned int
  */
 char * ml_api_get_version_string (void);
 
+/**
+ * @brief Gets the statistics of tensor memory tracked by machine-learning API.
+ * @details The statistics include the live bytes and objects of tensor buffers, allocated by the user (ml_tensors_data_create()), returned from single-shot, passed to pipeline sink callbacks and queued in ml-service extension and query client.
+ *          The value of each key is a pointer to size_t.
+ *          - "current", "peak" : The total bytes of live tensor buffers, and its high-water-mark.
+ *          - "objects", "peak_objects" : The number of live tensor buffer owners, and its high-water-mark.
+ *          - "budget" : The soft budget in bytes, 0 if not limited.
+ *          - "<origin>.current", "<origin>.peak", "<origin>.objects" : The breakdown for each origin, where the origin is one of "user", "single_output", "pipeline_sink", "extension_queue" and "query_queue".
+ *          The buffers shared between origins, e.g., queued clone of user data, are counted in each origin.
+ * @since_tizen 10.0
+ * @remarks The @a stats should be released using ml_information_destroy().
+ * @param[out] stats Newly created information handle with the memory statistics.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_api_get_memory_stats (ml_information_h *stats);
+
+/**
+ * @brief Sets the soft budget of tensor memory tracked by machine-learning API.
+ * @details If the budget is set, allocating new tensor buffers (user data, single-shot output and queued data in ml-service extension) fails with #ML_ERROR_OUT_OF_MEMORY when the total bytes exceed the budget.
+ *          The buffers already produced by the pipeline are always accounted and do not fail.
+ * @since_tizen 10.0
+ * @param[in] budget The budget in bytes. Set 0 to disable the budget.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ */
+int ml_api_set_memory_budget (size_t budget);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -88,6 +88,12 @@ typedef void *ml_custom_easy_filter_h;
  */
 typedef void *ml_pipeline_if_h;
 
+/**
+ * @brief A handle of a pool of pre-constructed NNStreamer pipelines.
+ * @since_tizen 10.0
+ */
+typedef void *ml_pipeline_pool_h;
+
 /**
  * @brief Enumeration for buffer deallocation policies.
  * @since_tizen 5.5
@@ -144,6 +150,15 @@ typedef void (*ml_pipeline_sink_cb) (const ml_tensors_data_h data, const ml_tens
  */
 typedef void (*ml_pipeline_state_cb) (ml_pipeline_state_e state, void *user_data);
 
+/**
+ * @brief Callback to notify that the pipeline is destroyed with ml_pipeline_destroy_async().
+ * @details This callback is called in the worker thread destroying the pipeline. Do not spend too much time in the callback.
+ * @since_tizen 10.0
+ * @param[in] status The result of destroying the pipeline. #ML_ERROR_NONE on success, otherwise a negative error value.
+ * @param[in,out] user_data User application's private data.
+ */
+typedef void (*ml_pipeline_destroy_cb) (int status, void *user_data);
+
 /**
  * @brief Callback to execute the custom-easy filter in NNStreamer pipelines.
  * @details Note that if ml_custom_easy_invoke_cb() returns negative error values, the constructed pipeline does not work properly anymore.
@@ -207,6 +222,32 @@ typedef int (*ml_pipeline_if_custom_cb) (const ml_tensors_data_h data, const ml_
  */
 int ml_pipeline_construct (const char *pipeline_description, ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h *pipe);
 
+/**
+ * @brief Constructs the pipeline with the option.
+ * @details Use this function to construct the pipeline as ml_pipeline_construct() does, with the option below.
+ *          The keys of @a option are:
+ *          'parallel_filter' (string), the name of tensor_filter to be replicated. The tensor_filter is replaced with the replicas, each running in its own thread, and the inputs are distributed to the replicas in round-robin. The outputs are pushed in the order of inputs.
+ *          'parallel_replicas' (string of integer), the number of replicas between 1 and 64. The default is the number of processors.
+ *          'parallel_affinity' (string), the comma-separated list of CPU numbers to run the replicas, one for each replica (e.g., '0,1,2,3'). By default, the affinity is not set.
+ *          The replica with index N is named '{name}_replica_{N}', except the first one which is the given tensor_filter.
+ * @since_tizen 10.0
+ * @remarks If the function succeeds, @a pipe handle must be released using ml_pipeline_destroy().
+ * @remarks The replicas invoke the same model concurrently. If the model is a custom-easy filter, it should be thread-safe. See ml_pipeline_custom_easy_filter_set_thread_safe().
+ * @param[in] pipeline_description The pipeline description compatible with GStreamer gst_parse_launch().
+ * @param[in] option The handle of ml-option to construct the pipeline. The values are used in this call only, so the caller may release @a option after this call.
+ * @param[in] cb The function to be called when the pipeline state is changed. You may set NULL if it's not required.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @param[out] pipe The NNStreamer pipeline handler from the given description.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the option is not supported in this platform.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the required privilege to access to the media storage, external storage, microphone, or camera.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or there is no tensor_filter of 'parallel_filter' linked in the pipeline.
+ * @retval #ML_ERROR_STREAMS_PIPE Pipeline construction is failed because of wrong parameter or initialization failure.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory to construct the pipeline.
+ */
+int ml_pipeline_construct_with_option (const char *pipeline_description, const ml_option_h option, ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h *pipe);
+
 /**
  * @brief Destroys the pipeline.
  * @details Use this function to destroy the pipeline constructed with ml_pipeline_construct().
@@ -223,6 +264,25 @@ int ml_pipeline_construct (const char *pipeline_description, ml_pipeline_state_c
  */
 int ml_pipeline_destroy (ml_pipeline_h pipe);
 
+/**
+ * @brief Destroys the pipeline asynchronously.
+ * @details The pipeline is stopped and released in the worker thread, and @a cb is called when it is done.
+ *          The pipelines destroyed with this function are released in parallel, so that the application can tear down many pipelines without blocking.
+ * @since_tizen 10.0
+ * @remarks The @a pipe handle is invalid after calling this function, even if the callback is not called yet.
+ * @remarks The application should wait for the callbacks of all pipelines destroyed with this function before unloading the library or exiting the process. The pipelines not released yet are not waited for at that time.
+ * @param[in] pipe The pipeline to be destroyed.
+ * @param[in] cb The function to be called when the pipeline is destroyed. You may set NULL if it's not required.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the worker thread.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_destroy_async (ml_pipeline_h pipe, ml_pipeline_destroy_cb cb, void *user_data);
+
 /**
  * @brief Gets the state of pipeline.
  * @details Gets the state of the pipeline handle returned by ml_pipeline_construct().
@@ -237,6 +297,42 @@ int ml_pipeline_destroy (ml_pipeline_h pipe);
  */
 int ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e *state);
 
+/**
+ * @brief Enables or disables the statistics of the elements in the pipeline.
+ * @details If enabled, the buffers passing through the pads of each element are counted and the processing time of each element is measured, so that the application can find the bottleneck of the pipeline.
+ *          The statistics is disabled by default, and there is no overhead until it is enabled. Disabling the statistics clears the values.
+ * @since_tizen 10.0
+ * @remarks The pads created after enabling the statistics (e.g., the pads of demuxer created when the stream is negotiated) are not measured.
+ * @param[in] pipe The pipeline handle.
+ * @param[in] enable True to enable the statistics.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to access the elements in the pipeline.
+ */
+int ml_pipeline_set_stats_enabled (ml_pipeline_h pipe, bool enable);
+
+/**
+ * @brief Gets the statistics of the elements in the pipeline.
+ * @details Each information handle in @a stats is for an element, with the keys below.
+ *          'name' and 'factory' (string), the name and the factory name of the element.
+ *          'buffers_in' and 'buffers_out' (uint64_t), the number of buffers arrived at the sink pads and pushed from the src pads.
+ *          'latency_p50', 'latency_p90', 'latency_p99' and 'latency_max' (uint64_t), the percentiles of recent processing time in microseconds, measured from the arrival of a buffer to the push in the same streaming thread. These are available only for the elements processing the buffers synchronously, not for the sources, sinks, queues and the elements pushing the buffers in their own threads.
+ *          'queue_level' (uint64_t), the number of buffers queued in the element (e.g., queue), if the element reports it.
+ *          'replicas' and 'throughput_gain' (uint64_t), the number of replicas and the throughput in percentage of a single instance, if the tensor_filter is replicated with ml_pipeline_construct_with_option(). The gain is estimated with the processing time of replicas over the elapsed time.
+ * @since_tizen 10.0
+ * @remarks If the function succeeds, @a stats should be released using ml_information_list_destroy().
+ * @param[in] pipe The pipeline handle.
+ * @param[out] stats The list of the statistics of elements.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the statistics is not enabled.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_get_stats (ml_pipeline_h pipe, ml_information_list_h *stats);
+
 /****************************************************
  ** NNStreamer Pipeline Start/Stop Control         **
  ****************************************************/
@@ -290,6 +386,81 @@ int ml_pipeline_stop (ml_pipeline_h pipe);
  */
 int ml_pipeline_flush (ml_pipeline_h pipe, bool start);
 
+/**
+ * @brief Creates a pool of pre-constructed pipelines.
+ * @details Constructing a pipeline parses the description, loads the plugins and opens the models, which may take long time.
+ *          The pool keeps the constructed pipelines in paused state for each pipeline description, so that the application can reuse them.
+ * @since_tizen 10.0
+ * @remarks If the function succeeds, @a pool handle must be released using ml_pipeline_pool_destroy().
+ * @param[in] max_idle The max number of idle pipelines kept for each pipeline description.
+ * @param[out] pool The pool handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_pool_create (unsigned int max_idle, ml_pipeline_pool_h *pool);
+
+/**
+ * @brief Destroys the pool of pipelines.
+ * @details The idle pipelines in the pool are destroyed. The pipelines acquired from the pool are not destroyed, the application should destroy them with ml_pipeline_destroy().
+ * @since_tizen 10.0
+ * @param[in] pool The pool handle to be destroyed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_pipeline_pool_destroy (ml_pipeline_pool_h pool);
+
+/**
+ * @brief Constructs the pipelines in advance and keeps them in the pool.
+ * @details The pipelines are constructed until the pool has @a count idle pipelines of the description. @a count is limited to the max number of idle pipelines of the pool.
+ * @since_tizen 10.0
+ * @param[in] pool The pool handle.
+ * @param[in] description The pipeline description compatible with GStreamer gst-launch format.
+ * @param[in] count The number of idle pipelines to be prepared.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to construct the pipeline.
+ */
+int ml_pipeline_pool_prepare (ml_pipeline_pool_h pool, const char *description, unsigned int count);
+
+/**
+ * @brief Gets a pipeline of the description from the pool.
+ * @details If the pool has an idle pipeline of the description, this returns it without constructing new pipeline. Otherwise, this constructs new pipeline.
+ *          The pipeline is in paused state, call ml_pipeline_start() to start the data flow.
+ * @since_tizen 10.0
+ * @remarks The pipeline should be returned with ml_pipeline_pool_release(), or destroyed with ml_pipeline_destroy().
+ * @param[in] pool The pool handle.
+ * @param[in] description The pipeline description compatible with GStreamer gst-launch format.
+ * @param[out] pipe The pipeline handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to construct the pipeline.
+ */
+int ml_pipeline_pool_acquire (ml_pipeline_pool_h pool, const char *description, ml_pipeline_h *pipe);
+
+/**
+ * @brief Returns the pipeline to the pool.
+ * @details The pipeline is reset and the data in the pipeline is dropped. If the pool already has enough idle pipelines of the description, the pipeline is destroyed.
+ * @since_tizen 10.0
+ * @param[in] pool The pool handle.
+ * @param[in] pipe The pipeline handle acquired with ml_pipeline_pool_acquire().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid. (The pipeline is not acquired from the pool, or the handles of elements in the pipeline are not released.)
+ *
+ * @pre The handles of elements in the pipeline (e.g., sink, src, switch and valve) should be released.
+ */
+int ml_pipeline_pool_release (ml_pipeline_pool_h pool, ml_pipeline_h pipe);
+
 /****************************************************
  ** NNStreamer Pipeline Sink/Src Control           **
  ****************************************************/
@@ -337,6 +508,62 @@ int ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name, ml_pip
  */
 int ml_pipeline_sink_unregister (ml_pipeline_sink_h sink_handle);
 
+/**
+ * @brief Sets the asynchronous delivery of sink data.
+ * @details By default, the sink callback is called in the streaming thread of the pipeline, so a slow callback stalls the pipeline.
+ *          Once it is set, the sink data is queued holding the buffer of pipeline without copying it, and a worker thread of the sink handle calls the callback.
+ *          The keys of @a option are:
+ *          'queue_size' (the max number of data in the queue, default 16),
+ *          'overflow' (the policy when the queue is full, one of 'block' (default), 'drop-oldest' and 'drop-newest').
+ *          Set @a option to NULL to call the callback in the streaming thread again.
+ * @since_tizen 10.0
+ * @remarks This function waits for the callback running in the previous worker thread. Do not call this function or ml_pipeline_sink_unregister() in the sink callback.
+ * @param[in] sink_handle The sink handle registered with ml_pipeline_sink_register().
+ * @param[in] option The handle of ml-option for asynchronous delivery. The values are parsed and copied, so the caller may release @a option after this call.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to create the worker thread.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_sink_set_async (ml_pipeline_sink_h sink_handle, const ml_option_h option);
+
+/**
+ * @brief Gets the number of sink data dropped by the overflow policy of asynchronous delivery.
+ * @since_tizen 10.0
+ * @param[in] sink_handle The sink handle registered with ml_pipeline_sink_register().
+ * @param[out] count The number of dropped data. 0 if the asynchronous delivery is not set.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_pipeline_sink_get_dropped_count (ml_pipeline_sink_h sink_handle, uint64_t *count);
+
+/**
+ * @brief Pulls the next data from the sink element, without registering the sink callback.
+ * @details This waits for the data until @a timeout, so that the application can get the result in its own loop.
+ *          The data holds the buffer of the pipeline without copying it, and the data is read-only. If you need to update the data, make a copy with ml_tensors_data_clone().
+ *          Use ml_tensors_data_get_info() to get the information of the data.
+ * @since_tizen 10.0
+ * @remarks If the function succeeds, @a data handle must be released using ml_tensors_data_destroy().
+ * @remarks For tensor_sink, the data is kept from the first call of this function, and the oldest data is dropped if the application does not pull the data for a while.
+ * @remarks For appsink, the data cannot be pulled if the sink callback is registered with ml_pipeline_sink_register().
+ * @param[in] pipe The pipeline handle.
+ * @param[in] sink_name The name of sink node (tensor_sink or appsink), described with ml_pipeline_construct().
+ * @param[in] timeout The time to wait for the data in milliseconds. 0 not to wait.
+ * @param[out] data The handle of the pulled data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_TIMED_OUT No data is received until the timeout, or the sink element reached end-of-stream.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to get the information of the data.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_sink_pull (ml_pipeline_h pipe, const char *sink_name, unsigned int timeout, ml_tensors_data_h *data);
+
 /**
  * @brief Gets a handle to operate as a src node of NNStreamer pipelines.
  * @since_tizen 5.5
@@ -387,6 +614,45 @@ int ml_pipeline_src_release_handle (ml_pipeline_src_h src_handle);
  */
 int ml_pipeline_src_input_data (ml_pipeline_src_h src_handle, ml_tensors_data_h data, ml_pipeline_buf_policy_e policy);
 
+/**
+ * @brief Adds multiple input data frames at once.
+ * @details The frames are validated with the tensors info of the source once, and pushed to the appsrc as a buffer list. This reduces the overhead of pushing many small frames with ml_pipeline_src_input_data().
+ *          If one of the frames is invalid, or the same handle is given more than once, no frame is pushed.
+ * @since_tizen 10.0
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in,out] data The array of input tensors handles, in the format of tensors info given by ml_pipeline_src_get_tensors_info().
+ *                 This function takes ownership of the data handles and sets each element of @a data to NULL if @a policy is #ML_PIPELINE_BUF_POLICY_AUTO_FREE and the frames are pushed.
+ * @param[in] num_data The number of data handles in @a data.
+ * @param[in] policy The policy of buffer deallocation, applied to all frames.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The pipeline has inconsistent pad caps. (Pipeline is not negotiated yet.)
+ * @retval #ML_ERROR_TRY_AGAIN The pipeline is not ready yet.
+ */
+int ml_pipeline_src_input_data_batch (ml_pipeline_src_h src_handle, ml_tensors_data_h *data, unsigned int num_data, ml_pipeline_buf_policy_e policy);
+
+/**
+ * @brief Gets a writable input data frame from the buffer pool of the source.
+ * @details The data frame is allocated from the buffer pool negotiated with the caps of the source, so the application can write the input directly into the memory of the pipeline.
+ *          If the frame is pushed with ml_pipeline_src_input_data() and #ML_PIPELINE_BUF_POLICY_AUTO_FREE, the pipeline takes the memory without allocating and copying it, and the memory is returned to the pool when the pipeline releases it.
+ *          For flexible tensors, the header of each tensor is written in place.
+ * @since_tizen 10.0
+ * @remarks The @a data should be released using ml_tensors_data_destroy() if it is not pushed to the source.
+ * @remarks Do not write the data after pushing it with the policy other than #ML_PIPELINE_BUF_POLICY_AUTO_FREE, the pipeline may be reading it.
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in] info The tensors information of the frame. Set NULL to use the tensors info of the source. This is mandatory if the source is flexible tensor stream.
+ * @param[out] data The data frame to be written and pushed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the source is not a tensor stream.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to allocate the frame from the buffer pool.
+ * @retval #ML_ERROR_TRY_AGAIN The pipeline is not ready yet.
+ */
+int ml_pipeline_src_acquire_data (ml_pipeline_src_h src_handle, const ml_tensors_info_h info, ml_tensors_data_h *data);
+
 /**
  * @brief Callbacks for src input events.
  * @details A set of callbacks that can be installed on the appsrc with ml_pipeline_src_set_event_cb().
@@ -413,6 +679,39 @@ typedef struct {
  */
 int ml_pipeline_src_set_event_cb (ml_pipeline_src_h src_handle, ml_pipeline_src_callbacks_s *cb, void *user_data);
 
+/**
+ * @brief Sets the flow control of the source, limiting the input frames queued in the source.
+ * @details The keys of @a option are:
+ *          'max_buffers' (the max number of frames queued in the source, 0 for unlimited. This requires GStreamer 1.20 or later),
+ *          'max_bytes' (the max bytes of frames queued in the source, 0 for unlimited),
+ *          'timeout' (the time in milliseconds to wait for the room of the source in ml_pipeline_src_input_data(). 0 not to block, which is the default).
+ *          If 'timeout' is given and the source is full, ml_pipeline_src_input_data() waits until the pipeline consumes the queued frames, and returns #ML_ERROR_TIMED_OUT if the source is still full after the timeout. The data is not consumed in this case.
+ *          With ml_pipeline_src_wait_ready(), the application can pace the input frames to the throughput of the pipeline with bounded memory.
+ * @since_tizen 10.0
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in] option The handle of ml-option for the flow control.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to get the pad of the source.
+ */
+int ml_pipeline_src_set_flow_control (ml_pipeline_src_h src_handle, const ml_option_h option);
+
+/**
+ * @brief Waits until the source can accept an input frame under the limits given by ml_pipeline_src_set_flow_control().
+ * @since_tizen 10.0
+ * @remarks This function blocks other operations of the pipeline until it returns. Do not use long timeout.
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in] timeout The time to wait in milliseconds. 0 to check the source without waiting.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful. The source can accept an input frame.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the flow control is not set.
+ * @retval #ML_ERROR_TIMED_OUT The source is still full after the timeout.
+ */
+int ml_pipeline_src_wait_ready (ml_pipeline_src_h src_handle, unsigned int timeout);
+
 /**
  * @brief Gets a handle for the tensors information of given src node.
  * @details If the media type is not other/tensor or other/tensors, @a info handle may not be correct. If want to use other media types, you MUST set the correct properties.
@@ -1092,6 +1391,22 @@ int ml_check_element_availability (const char *element_name, bool *available);
  */
 int ml_pipeline_custom_easy_filter_register (const char *name, const ml_tensors_info_h in, const ml_tensors_info_h out, ml_custom_easy_invoke_cb cb, void *user_data, ml_custom_easy_filter_h *custom);
 
+/**
+ * @brief Declares that the callback of custom filter is thread-safe.
+ * @details By default, the callback of custom filter is serialized, even if the custom filter is used in several pipelines or branches.
+ *          If the callback is thread-safe (reentrant), the pipelines invoke the callback concurrently.
+ * @since_tizen 10.0
+ * @param[in] custom The custom filter handle.
+ * @param[in] thread_safe @c true if the callback can be invoked concurrently.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the custom filter is used in the pipeline.
+ *
+ * @pre The custom filter should not be used in the pipeline. Call this before constructing the pipeline.
+ */
+int ml_pipeline_custom_easy_filter_set_thread_safe (ml_custom_easy_filter_h custom, bool thread_safe);
+
 /**
  * @brief Unregisters the custom filter.
  * @details Use this function to release and unregister the custom filter.
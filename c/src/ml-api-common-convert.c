@@ -0,0 +1,1678 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-convert.c
+ * @date 18 October 2026
+ * @brief ML C-API, type conversion and quantization of tensors data.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include <math.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api_util.h>
+#include "nnstreamer.h"
+#include "ml-api-internal.h"
+
+#if defined (__x86_64__) || defined (__i386__)
+#define ML_CONVERT_X86 1
+#include <immintrin.h>
+#include <cpuid.h>
+#elif defined (__ARM_NEON)
+#define ML_CONVERT_NEON 1
+#include <float.h>
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief The number of elements converted at once in the generic path.
+ */
+#define ML_CONVERT_CHUNK (256U)
+
+/**
+ * @brief Function to convert the elements of a tensor.
+ * @details For integer to float, the kernel dequantizes: (x - zero_point) * scale.
+ *          For float to integer, the kernel quantizes: round (x / scale) + zero_point.
+ *          The vectorized kernels should give the same result as the scalar kernels, bit by bit.
+ */
+typedef void (*ml_convert_func) (const void *src, void *dst, gsize count,
+    gfloat scale, gint32 zero_point);
+
+/**
+ * @brief Conversion kernels for frequently used types.
+ */
+typedef struct
+{
+  ml_convert_func u8_to_f32;
+  ml_convert_func i8_to_f32;
+  ml_convert_func f32_to_u8;
+  ml_convert_func f32_to_i8;
+  ml_convert_func f16_to_f32;
+  ml_convert_func f32_to_f16;
+  ml_convert_func bf16_to_f32;
+  ml_convert_func f32_to_bf16;
+} ml_convert_kernels_s;
+
+static ml_convert_kernels_s scalar_kernels;
+static ml_convert_kernels_s simd_kernels;
+static gint force_scalar = 0;
+
+/**
+ * @brief Internal function to check the tensor type is a floating point.
+ */
+static inline gboolean
+_is_float_type (ml_tensor_type_e type)
+{
+  return (type == ML_TENSOR_TYPE_FLOAT16 || type == ML_TENSOR_TYPE_FLOAT32 ||
+      type == ML_TENSOR_TYPE_FLOAT64);
+}
+
+/**
+ * @brief Internal function to convert IEEE 754 half precision to single precision.
+ */
+static inline gfloat
+_half_to_float (guint16 h)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+  guint32 sign = ((guint32) (h & 0x8000U)) << 16;
+  guint32 exp = (h >> 10) & 0x1fU;
+  guint32 mant = h & 0x3ffU;
+  gint32 e;
+
+  if (exp == 0) {
+    if (mant == 0) {
+      v.u = sign;
+    } else {
+      /* subnormal, normalize the mantissa. */
+      e = 1;
+      while (!(mant & 0x400U)) {
+        mant <<= 1;
+        e--;
+      }
+      mant &= 0x3ffU;
+      v.u = sign | ((guint32) (e + 112) << 23) | (mant << 13);
+    }
+  } else if (exp == 0x1fU) {
+    /* NaN is quiet, same as the conversion instructions. */
+    v.u = sign | 0x7f800000U | (mant << 13) | (mant ? 0x400000U : 0U);
+  } else {
+    v.u = sign | ((exp + 112) << 23) | (mant << 13);
+  }
+
+  return v.f;
+}
+
+/**
+ * @brief Internal function to convert single precision to IEEE 754 half precision. (round to nearest even)
+ */
+static inline guint16
+_float_to_half (gfloat f)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+  guint32 sign, mant, rem, half, shift;
+  gint32 exp;
+
+  v.f = f;
+  sign = (v.u >> 16) & 0x8000U;
+  mant = v.u & 0x7fffffU;
+
+  /* NaN is quiet and keeps the upper bits of payload, same as the conversion instructions. */
+  if (((v.u >> 23) & 0xffU) == 0xffU)
+    return (guint16) (sign | 0x7c00U | (mant ? (0x200U | (mant >> 13)) : 0U));
+
+  exp = (gint32) ((v.u >> 23) & 0xffU) - 112;
+  if (exp >= 0x1f)
+    return (guint16) (sign | 0x7c00U);
+
+  if (exp <= 0) {
+    if (exp < -10)
+      return (guint16) sign;
+
+    mant |= 0x800000U;
+    shift = (guint32) (14 - exp);
+    half = mant >> shift;
+    rem = mant & ((1U << shift) - 1U);
+
+    if (rem > (1U << (shift - 1)) ||
+        (rem == (1U << (shift - 1)) && (half & 1U)))
+      half++;
+
+    return (guint16) (sign | half);
+  }
+
+  half = sign | ((guint32) exp << 10) | (mant >> 13);
+  rem = mant & 0x1fffU;
+
+  /* carry may overflow to the exponent, which is expected. */
+  if (rem > 0x1000U || (rem == 0x1000U && (half & 1U)))
+    half++;
+
+  return (guint16) half;
+}
+
+/**
+ * @brief Internal function to convert single precision to bfloat16. (round to nearest even)
+ */
+static inline guint16
+_float_to_bf16 (gfloat f)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+
+  v.f = f;
+
+  /* keep NaN quiet, rounding may change it to infinity. */
+  if ((v.u & 0x7fffffffU) > 0x7f800000U)
+    return (guint16) ((v.u >> 16) | 0x40U);
+
+  v.u += 0x7fffU + ((v.u >> 16) & 1U);
+  return (guint16) (v.u >> 16);
+}
+
+/**
+ * @brief Internal function to convert bfloat16 to single precision.
+ */
+static inline gfloat
+_bf16_to_float (guint16 b)
+{
+  union
+  {
+    guint32 u;
+    gfloat f;
+  } v;
+
+  v.u = ((guint32) b) << 16;
+  return v.f;
+}
+
+/**
+ * @brief Internal function to clamp the value before quantization.
+ * @note NaN is clamped to the lower bound.
+ */
+static inline gfloat
+_clamp_float (gfloat v, gfloat lo, gfloat hi)
+{
+  if (!(v >= lo))
+    return lo;
+  if (v > hi)
+    return hi;
+  return v;
+}
+
+/**
+ * @brief Scalar kernel, uint8 to float32.
+ */
+static void
+_u8_to_f32_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  gfloat zp = (gfloat) zero_point;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = ((gfloat) s[i] - zp) * scale;
+}
+
+/**
+ * @brief Scalar kernel, int8 to float32.
+ */
+static void
+_i8_to_f32_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  gfloat zp = (gfloat) zero_point;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = ((gfloat) s[i] - zp) * scale;
+}
+
+/**
+ * @brief Scalar kernel, float32 to uint8.
+ */
+static void
+_f32_to_u8_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dst;
+  gint32 q;
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    q = (gint32) nearbyintf (_clamp_float (s[i] / scale, -65536.0f, 65536.0f));
+    d[i] = (guint8) CLAMP (q + zero_point, 0, G_MAXUINT8);
+  }
+}
+
+/**
+ * @brief Scalar kernel, float32 to int8.
+ */
+static void
+_f32_to_i8_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dst;
+  gint32 q;
+  gsize i;
+
+  for (i = 0; i < count; i++) {
+    q = (gint32) nearbyintf (_clamp_float (s[i] / scale, -65536.0f, 65536.0f));
+    d[i] = (gint8) CLAMP (q + zero_point, G_MININT8, G_MAXINT8);
+  }
+}
+
+/**
+ * @brief Scalar kernel, float16 to float32.
+ */
+static void
+_f16_to_f32_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _half_to_float (s[i]);
+}
+
+/**
+ * @brief Scalar kernel, float32 to float16.
+ */
+static void
+_f32_to_f16_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _float_to_half (s[i]);
+}
+
+/**
+ * @brief Scalar kernel, bfloat16 to float32.
+ */
+static void
+_bf16_to_f32_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _bf16_to_float (s[i]);
+}
+
+/**
+ * @brief Scalar kernel, float32 to bfloat16.
+ */
+static void
+_f32_to_bf16_c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    d[i] = _float_to_bf16 (s[i]);
+}
+
+#if defined (ML_CONVERT_X86)
+/**
+ * @brief SSE4.1 kernel, uint8 to float32.
+ */
+__attribute__ ((target ("sse4.1")))
+static void
+_u8_to_f32_sse41 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const __m128 vscale = _mm_set1_ps (scale);
+  const __m128 vzp = _mm_set1_ps ((gfloat) zero_point);
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    gint32 packed;
+    __m128 f;
+
+    memcpy (&packed, s + i, sizeof (packed));
+    f = _mm_cvtepi32_ps (_mm_cvtepu8_epi32 (_mm_cvtsi32_si128 (packed)));
+    _mm_storeu_ps (d + i, _mm_mul_ps (_mm_sub_ps (f, vzp), vscale));
+  }
+
+  _u8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief SSE4.1 kernel, int8 to float32.
+ */
+__attribute__ ((target ("sse4.1")))
+static void
+_i8_to_f32_sse41 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const __m128 vscale = _mm_set1_ps (scale);
+  const __m128 vzp = _mm_set1_ps ((gfloat) zero_point);
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    gint32 packed;
+    __m128 f;
+
+    memcpy (&packed, s + i, sizeof (packed));
+    f = _mm_cvtepi32_ps (_mm_cvtepi8_epi32 (_mm_cvtsi32_si128 (packed)));
+    _mm_storeu_ps (d + i, _mm_mul_ps (_mm_sub_ps (f, vzp), vscale));
+  }
+
+  _i8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief SSE2 kernel, float32 to uint8.
+ */
+__attribute__ ((target ("sse2")))
+static void
+_f32_to_u8_sse2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dst;
+  const __m128 vscale = _mm_set1_ps (scale);
+  const __m128 vlo = _mm_set1_ps (-65536.0f);
+  const __m128 vhi = _mm_set1_ps (65536.0f);
+  const __m128i vzp = _mm_set1_epi32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m128 f0, f1;
+    __m128i q0, q1, w;
+
+    f0 = _mm_div_ps (_mm_loadu_ps (s + i), vscale);
+    f1 = _mm_div_ps (_mm_loadu_ps (s + i + 4), vscale);
+    f0 = _mm_min_ps (_mm_max_ps (f0, vlo), vhi);
+    f1 = _mm_min_ps (_mm_max_ps (f1, vlo), vhi);
+    q0 = _mm_add_epi32 (_mm_cvtps_epi32 (f0), vzp);
+    q1 = _mm_add_epi32 (_mm_cvtps_epi32 (f1), vzp);
+    w = _mm_packs_epi32 (q0, q1);
+    _mm_storel_epi64 ((__m128i *) (d + i), _mm_packus_epi16 (w, w));
+  }
+
+  _f32_to_u8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief SSE2 kernel, float32 to int8.
+ */
+__attribute__ ((target ("sse2")))
+static void
+_f32_to_i8_sse2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dst;
+  const __m128 vscale = _mm_set1_ps (scale);
+  const __m128 vlo = _mm_set1_ps (-65536.0f);
+  const __m128 vhi = _mm_set1_ps (65536.0f);
+  const __m128i vzp = _mm_set1_epi32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m128 f0, f1;
+    __m128i q0, q1, w;
+
+    f0 = _mm_div_ps (_mm_loadu_ps (s + i), vscale);
+    f1 = _mm_div_ps (_mm_loadu_ps (s + i + 4), vscale);
+    f0 = _mm_min_ps (_mm_max_ps (f0, vlo), vhi);
+    f1 = _mm_min_ps (_mm_max_ps (f1, vlo), vhi);
+    q0 = _mm_add_epi32 (_mm_cvtps_epi32 (f0), vzp);
+    q1 = _mm_add_epi32 (_mm_cvtps_epi32 (f1), vzp);
+    w = _mm_packs_epi32 (q0, q1);
+    _mm_storel_epi64 ((__m128i *) (d + i), _mm_packs_epi16 (w, w));
+  }
+
+  _f32_to_i8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief AVX2 kernel, uint8 to float32.
+ */
+__attribute__ ((target ("avx2")))
+static void
+_u8_to_f32_avx2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const __m256 vscale = _mm256_set1_ps (scale);
+  const __m256 vzp = _mm256_set1_ps ((gfloat) zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m128i b = _mm_loadl_epi64 ((const __m128i *) (s + i));
+    __m256 f = _mm256_cvtepi32_ps (_mm256_cvtepu8_epi32 (b));
+
+    _mm256_storeu_ps (d + i, _mm256_mul_ps (_mm256_sub_ps (f, vzp), vscale));
+  }
+
+  _u8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief AVX2 kernel, int8 to float32.
+ */
+__attribute__ ((target ("avx2")))
+static void
+_i8_to_f32_avx2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const __m256 vscale = _mm256_set1_ps (scale);
+  const __m256 vzp = _mm256_set1_ps ((gfloat) zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m128i b = _mm_loadl_epi64 ((const __m128i *) (s + i));
+    __m256 f = _mm256_cvtepi32_ps (_mm256_cvtepi8_epi32 (b));
+
+    _mm256_storeu_ps (d + i, _mm256_mul_ps (_mm256_sub_ps (f, vzp), vscale));
+  }
+
+  _i8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to 16 packed int16 values with saturation.
+ */
+__attribute__ ((target ("avx2")))
+static inline __m256i
+_f32_to_i16x16_avx2 (const gfloat * s, __m256 vscale, __m256i vzp)
+{
+  const __m256 vlo = _mm256_set1_ps (-65536.0f);
+  const __m256 vhi = _mm256_set1_ps (65536.0f);
+  __m256 f0, f1;
+  __m256i q0, q1;
+
+  f0 = _mm256_div_ps (_mm256_loadu_ps (s), vscale);
+  f1 = _mm256_div_ps (_mm256_loadu_ps (s + 8), vscale);
+  f0 = _mm256_min_ps (_mm256_max_ps (f0, vlo), vhi);
+  f1 = _mm256_min_ps (_mm256_max_ps (f1, vlo), vhi);
+  q0 = _mm256_add_epi32 (_mm256_cvtps_epi32 (f0), vzp);
+  q1 = _mm256_add_epi32 (_mm256_cvtps_epi32 (f1), vzp);
+
+  /* packs works in 128-bit lanes, restore the order of elements. */
+  return _mm256_permute4x64_epi64 (_mm256_packs_epi32 (q0, q1), 0xd8);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to uint8.
+ */
+__attribute__ ((target ("avx2")))
+static void
+_f32_to_u8_avx2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dst;
+  const __m256 vscale = _mm256_set1_ps (scale);
+  const __m256i vzp = _mm256_set1_epi32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 16 <= count; i += 16) {
+    __m256i w = _f32_to_i16x16_avx2 (s + i, vscale, vzp);
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packus_epi16 (_mm256_castsi256_si128 (w),
+            _mm256_extracti128_si256 (w, 1)));
+  }
+
+  _f32_to_u8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to int8.
+ */
+__attribute__ ((target ("avx2")))
+static void
+_f32_to_i8_avx2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dst;
+  const __m256 vscale = _mm256_set1_ps (scale);
+  const __m256i vzp = _mm256_set1_epi32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 16 <= count; i += 16) {
+    __m256i w = _f32_to_i16x16_avx2 (s + i, vscale, vzp);
+
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm_packs_epi16 (_mm256_castsi256_si128 (w),
+            _mm256_extracti128_si256 (w, 1)));
+  }
+
+  _f32_to_i8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief F16C kernel, float16 to float32.
+ */
+__attribute__ ((target ("avx,f16c")))
+static void
+_f16_to_f32_f16c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    _mm256_storeu_ps (d + i,
+        _mm256_cvtph_ps (_mm_loadu_si128 ((const __m128i *) (s + i))));
+  }
+
+  _f16_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief F16C kernel, float32 to float16.
+ */
+__attribute__ ((target ("avx,f16c")))
+static void
+_f32_to_f16_f16c (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    _mm_storeu_si128 ((__m128i *) (d + i),
+        _mm256_cvtps_ph (_mm256_loadu_ps (s + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  _f32_to_f16_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief SSE2 kernel, bfloat16 to float32.
+ */
+__attribute__ ((target ("sse2")))
+static void
+_bf16_to_f32_sse2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  const __m128i zero = _mm_setzero_si128 ();
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m128i b = _mm_loadu_si128 ((const __m128i *) (s + i));
+
+    /* bfloat16 is the upper half of float32. */
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_unpacklo_epi16 (zero, b));
+    _mm_storeu_si128 ((__m128i *) (d + i + 4), _mm_unpackhi_epi16 (zero, b));
+  }
+
+  _bf16_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief AVX2 kernel, float32 to bfloat16.
+ */
+__attribute__ ((target ("avx2")))
+static void
+_f32_to_bf16_avx2 (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  const __m256i bias = _mm256_set1_epi32 (0x7fff);
+  const __m256i one = _mm256_set1_epi32 (1);
+  const __m256i quiet = _mm256_set1_epi32 (0x40);
+  gsize i = 0;
+
+  for (; i + 16 <= count; i += 16) {
+    __m256 f0 = _mm256_loadu_ps (s + i);
+    __m256 f1 = _mm256_loadu_ps (s + i + 8);
+    __m256i u0 = _mm256_castps_si256 (f0);
+    __m256i u1 = _mm256_castps_si256 (f1);
+    __m256i r0, r1, n0, n1;
+
+    /* round to nearest even */
+    r0 = _mm256_add_epi32 (u0, _mm256_add_epi32 (bias,
+            _mm256_and_si256 (_mm256_srli_epi32 (u0, 16), one)));
+    r1 = _mm256_add_epi32 (u1, _mm256_add_epi32 (bias,
+            _mm256_and_si256 (_mm256_srli_epi32 (u1, 16), one)));
+    r0 = _mm256_srli_epi32 (r0, 16);
+    r1 = _mm256_srli_epi32 (r1, 16);
+
+    /* keep NaN quiet */
+    n0 = _mm256_or_si256 (_mm256_srli_epi32 (u0, 16), quiet);
+    n1 = _mm256_or_si256 (_mm256_srli_epi32 (u1, 16), quiet);
+    r0 = _mm256_blendv_epi8 (r0, n0,
+        _mm256_castps_si256 (_mm256_cmp_ps (f0, f0, _CMP_UNORD_Q)));
+    r1 = _mm256_blendv_epi8 (r1, n1,
+        _mm256_castps_si256 (_mm256_cmp_ps (f1, f1, _CMP_UNORD_Q)));
+
+    /* pack in 128-bit lanes, then restore the order */
+    _mm256_storeu_si256 ((__m256i *) (d + i),
+        _mm256_permute4x64_epi64 (_mm256_packus_epi32 (r0, r1), 0xd8));
+  }
+
+  _f32_to_bf16_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief Internal function to check the OS saves AVX registers.
+ */
+static gboolean
+_x86_os_supports_avx (void)
+{
+  guint32 eax, edx;
+
+  __asm__ __volatile__ ("xgetbv":"=a" (eax), "=d" (edx):"c" (0));
+
+  return ((eax & 0x6U) == 0x6U);
+}
+
+/**
+ * @brief Internal function to set the SIMD kernels for x86.
+ */
+static void
+_init_simd_kernels (ml_convert_kernels_s * kernels)
+{
+  guint32 eax, ebx, ecx, edx;
+  gboolean avx = FALSE;
+
+  if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx))
+    return;
+
+  /* SSE2 */
+  if (edx & (1U << 26)) {
+    kernels->f32_to_u8 = _f32_to_u8_sse2;
+    kernels->f32_to_i8 = _f32_to_i8_sse2;
+    kernels->bf16_to_f32 = _bf16_to_f32_sse2;
+  }
+
+  /* SSE4.1 */
+  if (ecx & (1U << 19)) {
+    kernels->u8_to_f32 = _u8_to_f32_sse41;
+    kernels->i8_to_f32 = _i8_to_f32_sse41;
+  }
+
+  /* AVX with OSXSAVE */
+  if ((ecx & (1U << 28)) && (ecx & (1U << 27)))
+    avx = _x86_os_supports_avx ();
+
+  if (!avx)
+    return;
+
+  /* F16C */
+  if (ecx & (1U << 29)) {
+    kernels->f16_to_f32 = _f16_to_f32_f16c;
+    kernels->f32_to_f16 = _f32_to_f16_f16c;
+  }
+
+  /* AVX2 */
+  if (__get_cpuid_count (7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1U << 5))) {
+    kernels->u8_to_f32 = _u8_to_f32_avx2;
+    kernels->i8_to_f32 = _i8_to_f32_avx2;
+    kernels->f32_to_u8 = _f32_to_u8_avx2;
+    kernels->f32_to_i8 = _f32_to_i8_avx2;
+    kernels->f32_to_bf16 = _f32_to_bf16_avx2;
+  }
+}
+#elif defined (ML_CONVERT_NEON)
+/**
+ * @brief NEON kernel, uint8 to float32.
+ */
+static void
+_u8_to_f32_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint8 *s = (const guint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const float32x4_t vscale = vdupq_n_f32 (scale);
+  const float32x4_t vzp = vdupq_n_f32 ((gfloat) zero_point);
+  gsize i = 0;
+
+#if !defined (__aarch64__)
+  /* ARMv7 NEON flushes the subnormal results to zero. */
+  if (scale < FLT_MIN)
+    count = 0;
+#endif
+
+  for (; i + 8 <= count; i += 8) {
+    uint16x8_t w = vmovl_u8 (vld1_u8 (s + i));
+    float32x4_t lo = vcvtq_f32_u32 (vmovl_u16 (vget_low_u16 (w)));
+    float32x4_t hi = vcvtq_f32_u32 (vmovl_u16 (vget_high_u16 (w)));
+
+    vst1q_f32 (d + i, vmulq_f32 (vsubq_f32 (lo, vzp), vscale));
+    vst1q_f32 (d + i + 4, vmulq_f32 (vsubq_f32 (hi, vzp), vscale));
+  }
+
+  _u8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief NEON kernel, int8 to float32.
+ */
+static void
+_i8_to_f32_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gint8 *s = (const gint8 *) src;
+  gfloat *d = (gfloat *) dst;
+  const float32x4_t vscale = vdupq_n_f32 (scale);
+  const float32x4_t vzp = vdupq_n_f32 ((gfloat) zero_point);
+  gsize i = 0;
+
+#if !defined (__aarch64__)
+  /* ARMv7 NEON flushes the subnormal results to zero. */
+  if (scale < FLT_MIN)
+    count = 0;
+#endif
+
+  for (; i + 8 <= count; i += 8) {
+    int16x8_t w = vmovl_s8 (vld1_s8 (s + i));
+    float32x4_t lo = vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (w)));
+    float32x4_t hi = vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (w)));
+
+    vst1q_f32 (d + i, vmulq_f32 (vsubq_f32 (lo, vzp), vscale));
+    vst1q_f32 (d + i + 4, vmulq_f32 (vsubq_f32 (hi, vzp), vscale));
+  }
+
+  _i8_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+#if defined (__aarch64__)
+/**
+ * @brief NEON kernel, float32 to 8 packed int16 values with saturation.
+ */
+static inline int16x8_t
+_f32_to_i16x8_neon (const gfloat * s, float32x4_t vscale, int32x4_t vzp)
+{
+  const float32x4_t vlo = vdupq_n_f32 (-65536.0f);
+  const float32x4_t vhi = vdupq_n_f32 (65536.0f);
+  float32x4_t f0, f1;
+  int32x4_t q0, q1;
+
+  /* vmaxnm returns the number if one of the operands is NaN. */
+  f0 = vminq_f32 (vmaxnmq_f32 (vdivq_f32 (vld1q_f32 (s), vscale), vlo), vhi);
+  f1 = vminq_f32 (vmaxnmq_f32 (vdivq_f32 (vld1q_f32 (s + 4), vscale), vlo), vhi);
+  q0 = vaddq_s32 (vcvtnq_s32_f32 (f0), vzp);
+  q1 = vaddq_s32 (vcvtnq_s32_f32 (f1), vzp);
+
+  return vcombine_s16 (vqmovn_s32 (q0), vqmovn_s32 (q1));
+}
+
+/**
+ * @brief NEON kernel, float32 to uint8.
+ */
+static void
+_f32_to_u8_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint8 *d = (guint8 *) dst;
+  const float32x4_t vscale = vdupq_n_f32 (scale);
+  const int32x4_t vzp = vdupq_n_s32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8)
+    vst1_u8 (d + i, vqmovun_s16 (_f32_to_i16x8_neon (s + i, vscale, vzp)));
+
+  _f32_to_u8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief NEON kernel, float32 to int8.
+ */
+static void
+_f32_to_i8_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  gint8 *d = (gint8 *) dst;
+  const float32x4_t vscale = vdupq_n_f32 (scale);
+  const int32x4_t vzp = vdupq_n_s32 (zero_point);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8)
+    vst1_s8 (d + i, vqmovn_s16 (_f32_to_i16x8_neon (s + i, vscale, vzp)));
+
+  _f32_to_i8_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief NEON kernel, float16 to float32.
+ */
+static void
+_f16_to_f32_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32 (d + i, vcvt_f32_f16 (vreinterpret_f16_u16 (vld1_u16 (s + i))));
+
+  _f16_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief NEON kernel, float32 to float16.
+ */
+static void
+_f32_to_f16_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4)
+    vst1_u16 (d + i, vreinterpret_u16_f16 (vcvt_f16_f32 (vld1q_f32 (s + i))));
+
+  _f32_to_f16_c (s + i, d + i, count - i, scale, zero_point);
+}
+#endif /* __aarch64__ */
+
+/**
+ * @brief NEON kernel, bfloat16 to float32.
+ */
+static void
+_bf16_to_f32_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const guint16 *s = (const guint16 *) src;
+  gfloat *d = (gfloat *) dst;
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    uint16x8_t b = vld1q_u16 (s + i);
+
+    vst1q_f32 (d + i, vreinterpretq_f32_u32 (vshll_n_u16 (vget_low_u16 (b),
+                16)));
+    vst1q_f32 (d + i + 4,
+        vreinterpretq_f32_u32 (vshll_n_u16 (vget_high_u16 (b), 16)));
+  }
+
+  _bf16_to_f32_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief NEON kernel, float32 to bfloat16.
+ */
+static void
+_f32_to_bf16_neon (const void *src, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  const gfloat *s = (const gfloat *) src;
+  guint16 *d = (guint16 *) dst;
+  const uint32x4_t bias = vdupq_n_u32 (0x7fffU);
+  const uint32x4_t one = vdupq_n_u32 (1U);
+  const uint32x4_t quiet = vdupq_n_u32 (0x40U);
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t f = vld1q_f32 (s + i);
+    uint32x4_t u = vreinterpretq_u32_f32 (f);
+    uint32x4_t r, n, is_num;
+
+    /* round to nearest even, keep NaN quiet */
+    r = vaddq_u32 (u, vaddq_u32 (bias, vandq_u32 (vshrq_n_u32 (u, 16), one)));
+    n = vorrq_u32 (vshrq_n_u32 (u, 16), quiet);
+    is_num = vceqq_f32 (f, f);
+
+    vst1_u16 (d + i, vmovn_u32 (vbslq_u32 (is_num, vshrq_n_u32 (r, 16), n)));
+  }
+
+  _f32_to_bf16_c (s + i, d + i, count - i, scale, zero_point);
+}
+
+/**
+ * @brief Internal function to set the SIMD kernels for ARM.
+ * @note ARMv7 NEON does not support IEEE 754 division, rounding and NaN handling, quantization and float16 use the scalar kernels.
+ */
+static void
+_init_simd_kernels (ml_convert_kernels_s * kernels)
+{
+  kernels->u8_to_f32 = _u8_to_f32_neon;
+  kernels->i8_to_f32 = _i8_to_f32_neon;
+  kernels->bf16_to_f32 = _bf16_to_f32_neon;
+  kernels->f32_to_bf16 = _f32_to_bf16_neon;
+#if defined (__aarch64__)
+  kernels->f32_to_u8 = _f32_to_u8_neon;
+  kernels->f32_to_i8 = _f32_to_i8_neon;
+  kernels->f16_to_f32 = _f16_to_f32_neon;
+  kernels->f32_to_f16 = _f32_to_f16_neon;
+#endif
+}
+#else
+/**
+ * @brief Internal function to set the SIMD kernels. (not supported)
+ */
+static void
+_init_simd_kernels (ml_convert_kernels_s * kernels)
+{
+  /* Use scalar kernels. */
+}
+#endif
+
+/**
+ * @brief Internal function to initialize the conversion kernels once.
+ */
+static gpointer
+_init_kernels (gpointer data)
+{
+  scalar_kernels.u8_to_f32 = _u8_to_f32_c;
+  scalar_kernels.i8_to_f32 = _i8_to_f32_c;
+  scalar_kernels.f32_to_u8 = _f32_to_u8_c;
+  scalar_kernels.f32_to_i8 = _f32_to_i8_c;
+  scalar_kernels.f16_to_f32 = _f16_to_f32_c;
+  scalar_kernels.f32_to_f16 = _f32_to_f16_c;
+  scalar_kernels.bf16_to_f32 = _bf16_to_f32_c;
+  scalar_kernels.f32_to_bf16 = _f32_to_bf16_c;
+
+  simd_kernels = scalar_kernels;
+  _init_simd_kernels (&simd_kernels);
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to get the conversion kernels.
+ */
+static const ml_convert_kernels_s *
+_get_kernels (void)
+{
+  static GOnce init_once = G_ONCE_INIT;
+
+  g_once (&init_once, _init_kernels, NULL);
+  return g_atomic_int_get (&force_scalar) ? &scalar_kernels : &simd_kernels;
+}
+
+/**
+ * @brief Internal function to find the kernel for given types.
+ */
+static ml_convert_func
+_find_kernel (ml_tensor_type_e src_type, ml_tensor_type_e dst_type)
+{
+  const ml_convert_kernels_s *kernels = _get_kernels ();
+
+  if (dst_type == ML_TENSOR_TYPE_FLOAT32) {
+    switch (src_type) {
+      case ML_TENSOR_TYPE_UINT8:
+        return kernels->u8_to_f32;
+      case ML_TENSOR_TYPE_INT8:
+        return kernels->i8_to_f32;
+      case ML_TENSOR_TYPE_FLOAT16:
+        return kernels->f16_to_f32;
+      default:
+        break;
+    }
+  } else if (src_type == ML_TENSOR_TYPE_FLOAT32) {
+    switch (dst_type) {
+      case ML_TENSOR_TYPE_UINT8:
+        return kernels->f32_to_u8;
+      case ML_TENSOR_TYPE_INT8:
+        return kernels->f32_to_i8;
+      case ML_TENSOR_TYPE_FLOAT16:
+        return kernels->f32_to_f16;
+      default:
+        break;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to load the elements as double.
+ */
+static void
+_load_as_double (ml_tensor_type_e type, const void *src, gdouble * dst,
+    gsize count)
+{
+  gsize i;
+
+  switch (type) {
+    case ML_TENSOR_TYPE_INT32:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const gint32 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const guint32 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const gint16 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const guint16 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_INT8:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const gint8 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const guint8 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_FLOAT64:
+      memcpy (dst, src, count * sizeof (gdouble));
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      for (i = 0; i < count; i++)
+        dst[i] = ((const gfloat *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      for (i = 0; i < count; i++)
+        dst[i] = (gdouble) ((const gint64 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      for (i = 0; i < count; i++)
+        dst[i] = (gdouble) ((const guint64 *) src)[i];
+      break;
+    case ML_TENSOR_TYPE_FLOAT16:
+      for (i = 0; i < count; i++)
+        dst[i] = _half_to_float (((const guint16 *) src)[i]);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to round and saturate the value for integer types.
+ */
+static inline gdouble
+_saturate (gdouble v, gdouble lo, gdouble hi)
+{
+  v = nearbyint (v);
+  if (!(v >= lo))
+    return lo;
+  if (v > hi)
+    return hi;
+  return v;
+}
+
+/**
+ * @brief Internal function to store the elements from double.
+ */
+static void
+_store_from_double (ml_tensor_type_e type, const gdouble * src, void *dst,
+    gsize count)
+{
+  gdouble v;
+  gsize i;
+
+  switch (type) {
+    case ML_TENSOR_TYPE_INT32:
+      for (i = 0; i < count; i++)
+        ((gint32 *) dst)[i] = (gint32) _saturate (src[i], G_MININT32,
+            G_MAXINT32);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      for (i = 0; i < count; i++)
+        ((guint32 *) dst)[i] = (guint32) _saturate (src[i], 0, G_MAXUINT32);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      for (i = 0; i < count; i++)
+        ((gint16 *) dst)[i] = (gint16) _saturate (src[i], G_MININT16,
+            G_MAXINT16);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      for (i = 0; i < count; i++)
+        ((guint16 *) dst)[i] = (guint16) _saturate (src[i], 0, G_MAXUINT16);
+      break;
+    case ML_TENSOR_TYPE_INT8:
+      for (i = 0; i < count; i++)
+        ((gint8 *) dst)[i] = (gint8) _saturate (src[i], G_MININT8, G_MAXINT8);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      for (i = 0; i < count; i++)
+        ((guint8 *) dst)[i] = (guint8) _saturate (src[i], 0, G_MAXUINT8);
+      break;
+    case ML_TENSOR_TYPE_FLOAT64:
+      memcpy (dst, src, count * sizeof (gdouble));
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      for (i = 0; i < count; i++)
+        ((gfloat *) dst)[i] = (gfloat) src[i];
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      /* (gdouble) G_MAXINT64 is 2^63, which overflows gint64. */
+      for (i = 0; i < count; i++) {
+        v = _saturate (src[i], (gdouble) G_MININT64, (gdouble) G_MAXINT64);
+        ((gint64 *) dst)[i] = (v >= (gdouble) G_MAXINT64) ?
+            G_MAXINT64 : (gint64) v;
+      }
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      for (i = 0; i < count; i++) {
+        v = _saturate (src[i], 0, (gdouble) G_MAXUINT64);
+        ((guint64 *) dst)[i] = (v >= (gdouble) G_MAXUINT64) ?
+            G_MAXUINT64 : (guint64) v;
+      }
+      break;
+    case ML_TENSOR_TYPE_FLOAT16:
+      for (i = 0; i < count; i++)
+        ((guint16 *) dst)[i] = _float_to_half ((gfloat) src[i]);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to convert the elements with double precision. (generic path)
+ */
+static void
+_convert_generic (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dst_type, void *dst, gsize count, gfloat scale,
+    gint32 zero_point)
+{
+  gdouble buffer[ML_CONVERT_CHUNK];
+  gsize src_esize, dst_esize, n, i;
+  gboolean dequantize, quantize;
+
+  src_esize = gst_tensor_get_element_size ((tensor_type) src_type);
+  dst_esize = gst_tensor_get_element_size ((tensor_type) dst_type);
+  dequantize = !_is_float_type (src_type) && _is_float_type (dst_type);
+  quantize = _is_float_type (src_type) && !_is_float_type (dst_type);
+
+  while (count > 0) {
+    n = MIN (count, ML_CONVERT_CHUNK);
+
+    _load_as_double (src_type, src, buffer, n);
+
+    if (dequantize) {
+      for (i = 0; i < n; i++)
+        buffer[i] = (buffer[i] - zero_point) * scale;
+    } else if (quantize) {
+      for (i = 0; i < n; i++)
+        buffer[i] = nearbyint (buffer[i] / scale) + zero_point;
+    }
+
+    _store_from_double (dst_type, buffer, dst, n);
+
+    src = (const guint8 *) src + n * src_esize;
+    dst = (guint8 *) dst + n * dst_esize;
+    count -= n;
+  }
+}
+
+/**
+ * @brief Converts the elements of a tensor to the given type. (internal)
+ */
+int
+_ml_tensors_convert_raw (ml_tensor_type_e src_type, const void *src,
+    ml_tensor_type_e dst_type, void *dst, size_t count, float scale,
+    int zero_point)
+{
+  ml_convert_func kernel;
+
+  if (src_type < ML_TENSOR_TYPE_INT32 || src_type >= ML_TENSOR_TYPE_UNKNOWN)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The source tensor type (%d) is invalid.", src_type);
+  if (dst_type < ML_TENSOR_TYPE_INT32 || dst_type >= ML_TENSOR_TYPE_UNKNOWN)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The destination tensor type (%d) is invalid.", dst_type);
+  if (count > 0 && (!src || !dst))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The source or destination buffer is NULL.");
+
+  if (_is_float_type (src_type) != _is_float_type (dst_type)) {
+    if (!(scale > 0.0f) || !isfinite (scale))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, scale (%f), is invalid. It should be a positive number to quantize or dequantize the tensor data.",
+          scale);
+  }
+
+  if (count == 0)
+    return ML_ERROR_NONE;
+
+  if (src_type == dst_type) {
+    memcpy (dst, src, count * gst_tensor_get_element_size (src_type));
+    return ML_ERROR_NONE;
+  }
+
+  kernel = _find_kernel (src_type, dst_type);
+  if (kernel)
+    kernel (src, dst, count, scale, zero_point);
+  else
+    _convert_generic (src_type, src, dst_type, dst, count, scale, zero_point);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Converts the elements between bfloat16 and the floating point type. (internal)
+ */
+int
+_ml_tensors_convert_bf16_raw (ml_tensor_type_e type, const void *src,
+    void *dst, size_t count, gboolean to_bf16)
+{
+  const ml_convert_kernels_s *kernels;
+  gfloat buffer[ML_CONVERT_CHUNK];
+  gsize esize, n;
+  int status;
+
+  if (!_is_float_type (type))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The tensor type (%d) is invalid. bfloat16 can be converted from or to floating point types only.",
+        type);
+  if (count > 0 && (!src || !dst))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The source or destination buffer is NULL.");
+
+  kernels = _get_kernels ();
+
+  if (type == ML_TENSOR_TYPE_FLOAT32) {
+    if (to_bf16)
+      kernels->f32_to_bf16 (src, dst, count, 1.0f, 0);
+    else
+      kernels->bf16_to_f32 (src, dst, count, 1.0f, 0);
+
+    return ML_ERROR_NONE;
+  }
+
+  /* Other floating point types are converted through float32 in chunks. */
+  esize = gst_tensor_get_element_size ((tensor_type) type);
+
+  while (count > 0) {
+    n = MIN (count, ML_CONVERT_CHUNK);
+
+    if (to_bf16) {
+      status = _ml_tensors_convert_raw (type, src, ML_TENSOR_TYPE_FLOAT32,
+          buffer, n, 1.0f, 0);
+      if (status != ML_ERROR_NONE)
+        return status;
+
+      kernels->f32_to_bf16 (buffer, dst, n, 1.0f, 0);
+      src = (const guint8 *) src + n * esize;
+      dst = (guint16 *) dst + n;
+    } else {
+      kernels->bf16_to_f32 (src, buffer, n, 1.0f, 0);
+
+      status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, buffer, type,
+          dst, n, 1.0f, 0);
+      if (status != ML_ERROR_NONE)
+        return status;
+
+      src = (const guint16 *) src + n;
+      dst = (guint8 *) dst + n * esize;
+    }
+
+    count -= n;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Uses the scalar kernels only. (internal, for testing and benchmarks)
+ */
+void
+_ml_tensors_convert_set_force_scalar (gboolean scalar)
+{
+  g_atomic_int_set (&force_scalar, scalar ? 1 : 0);
+}
+
+/**
+ * @brief Converts the tensors data to the given type. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_convert (const ml_tensors_data_h src,
+    ml_tensor_type_e dst_type, float scale, int zero_point,
+    ml_tensors_data_h * dst)
+{
+  ml_tensors_data_s *_src, *_dst = NULL;
+  ml_tensors_info_s *_src_info;
+  ml_tensors_info_h dst_info = NULL;
+  ml_tensor_type_e src_types[ML_TENSOR_SIZE_LIMIT];
+  unsigned int i, num;
+  gsize esize;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dst == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dst, is NULL. It should be a valid pointer to a space that can hold a ml_tensors_data_h handle. E.g., ml_tensors_data_h dst; ml_tensors_data_convert (src, type, scale, zero_point, &dst);.");
+  if (dst_type < ML_TENSOR_TYPE_INT32 || dst_type >= ML_TENSOR_TYPE_UNKNOWN)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dst_type (%d), is invalid. It should be one of ml_tensor_type_e.",
+        dst_type);
+
+  /* init null */
+  *dst = NULL;
+
+  _src = (ml_tensors_data_s *) src;
+  G_LOCK_UNLESS_NOLOCK (*_src);
+
+  _src_info = (ml_tensors_info_s *) _src->info;
+  if (!_src_info) {
+    _ml_error_report
+        ("The parameter, src, does not have tensors information. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = _ml_tensors_data_map (_src, -1);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = _ml_tensors_info_create_from (_src->info, &dst_info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the tensors information for converted data.");
+    goto done;
+  }
+
+  num = _src->num_tensors;
+  for (i = 0; i < num; i++) {
+    GstTensorInfo *_gst_tensor_info;
+
+    G_LOCK_UNLESS_NOLOCK (*_src_info);
+    _gst_tensor_info = gst_tensors_info_get_nth_info (&_src_info->info, i);
+    src_types[i] = (ml_tensor_type_e) _gst_tensor_info->type;
+    G_UNLOCK_UNLESS_NOLOCK (*_src_info);
+
+    status = ml_tensors_info_set_tensor_type (dst_info, i, dst_type);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to set the type of %u'th tensor to %d.", i, dst_type);
+      goto done;
+    }
+  }
+
+  status = ml_tensors_data_create (dst_info, (ml_tensors_data_h *) & _dst);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to allocate the tensors data for converted data.");
+    goto done;
+  }
+
+  for (i = 0; i < num; i++) {
+    esize = gst_tensor_get_element_size ((tensor_type) src_types[i]);
+
+    status = _ml_tensors_convert_raw (src_types[i], _src->tensors[i].data,
+        dst_type, _dst->tensors[i].data, _src->tensors[i].size / esize,
+        scale, zero_point);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue ("Failed to convert %u'th tensor.", i);
+      goto done;
+    }
+  }
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_src);
+
+  if (dst_info)
+    ml_tensors_info_destroy (dst_info);
+
+  if (status == ML_ERROR_NONE) {
+    *dst = _dst;
+  } else if (_dst) {
+    ml_tensors_data_destroy (_dst);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to get the tensor type from the tensors information.
+ */
+static ml_tensor_type_e
+_get_tensor_type (ml_tensors_info_s * info, unsigned int index)
+{
+  GstTensorInfo *_gst_tensor_info;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+
+  G_LOCK_UNLESS_NOLOCK (*info);
+  _gst_tensor_info = gst_tensors_info_get_nth_info (&info->info, index);
+  if (_gst_tensor_info)
+    type = (ml_tensor_type_e) _gst_tensor_info->type;
+  G_UNLOCK_UNLESS_NOLOCK (*info);
+
+  return type;
+}
+
+/**
+ * @brief Converts the tensors data to newly allocated data with the given information. (internal)
+ */
+int
+_ml_tensors_data_convert_to_info (const ml_tensors_data_h src,
+    const ml_tensors_info_h dst_info, float scale, int zero_point,
+    gboolean bf16, ml_tensors_data_h * dst)
+{
+  ml_tensors_data_s *_src, *_dst = NULL;
+  ml_tensor_type_e src_type, dst_type;
+  gsize src_count, dst_count;
+  unsigned int i;
+  int status;
+
+  if (!src || !dst_info || !dst)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, dst_info or dst, is NULL.");
+
+  *dst = NULL;
+
+  _src = (ml_tensors_data_s *) src;
+  G_LOCK_UNLESS_NOLOCK (*_src);
+
+  if (!_src->info) {
+    _ml_error_report
+        ("The parameter, src, does not have tensors information. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = _ml_tensors_data_map (_src, -1);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = ml_tensors_data_create (dst_info, (ml_tensors_data_h *) & _dst);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to allocate the tensors data for converted data.");
+    goto done;
+  }
+
+  if (_src->num_tensors != _dst->num_tensors) {
+    _ml_error_report
+        ("The number of tensors mismatches, %u (source) != %u (destination).",
+        _src->num_tensors, _dst->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  for (i = 0; i < _src->num_tensors; i++) {
+    src_type = _get_tensor_type ((ml_tensors_info_s *) _src->info, i);
+    dst_type = _get_tensor_type ((ml_tensors_info_s *) _dst->info, i);
+
+    if (src_type == ML_TENSOR_TYPE_UNKNOWN ||
+        dst_type == ML_TENSOR_TYPE_UNKNOWN) {
+      _ml_error_report ("The type of %u'th tensor is unknown.", i);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    src_count = _src->tensors[i].size /
+        gst_tensor_get_element_size ((tensor_type) src_type);
+    dst_count = _dst->tensors[i].size /
+        gst_tensor_get_element_size ((tensor_type) dst_type);
+
+    if (src_count != dst_count) {
+      _ml_error_report
+          ("The number of elements in %u'th tensor mismatches, %zu (source) != %zu (destination).",
+          i, src_count, dst_count);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    if (bf16 && dst_type == ML_TENSOR_TYPE_UINT16 && _is_float_type (src_type)) {
+      status = _ml_tensors_convert_bf16_raw (src_type, _src->tensors[i].data,
+          _dst->tensors[i].data, src_count, TRUE);
+    } else if (bf16 && src_type == ML_TENSOR_TYPE_UINT16 &&
+        _is_float_type (dst_type)) {
+      status = _ml_tensors_convert_bf16_raw (dst_type, _src->tensors[i].data,
+          _dst->tensors[i].data, src_count, FALSE);
+    } else {
+      status = _ml_tensors_convert_raw (src_type, _src->tensors[i].data,
+          dst_type, _dst->tensors[i].data, src_count, scale, zero_point);
+    }
+
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue ("Failed to convert %u'th tensor.", i);
+      goto done;
+    }
+  }
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_src);
+
+  if (status == ML_ERROR_NONE) {
+    *dst = _dst;
+  } else if (_dst) {
+    ml_tensors_data_destroy (_dst);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to convert the tensors data between bfloat16 and the floating point type.
+ */
+static int
+_ml_tensors_data_convert_bf16 (const ml_tensors_data_h src,
+    ml_tensor_type_e type, gboolean to_bf16, ml_tensors_data_h * dst)
+{
+  ml_tensors_data_s *_src;
+  ml_tensors_info_h dst_info = NULL;
+  ml_tensor_type_e src_type;
+  unsigned int i;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (src == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (dst == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dst, is NULL. It should be a valid pointer to a space that can hold a ml_tensors_data_h handle.");
+  if (!_is_float_type (type))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The tensor type (%d) is invalid. bfloat16 can be converted from or to floating point types only.",
+        type);
+
+  _src = (ml_tensors_data_s *) src;
+  G_LOCK_UNLESS_NOLOCK (*_src);
+
+  if (!_src->info) {
+    _ml_error_report
+        ("The parameter, src, does not have tensors information. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = _ml_tensors_data_map (_src, -1);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = _ml_tensors_info_create_from (_src->info, &dst_info);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the tensors information for converted data.");
+    goto done;
+  }
+
+  for (i = 0; i < _src->num_tensors; i++) {
+    src_type = _get_tensor_type ((ml_tensors_info_s *) _src->info, i);
+
+    if (to_bf16 ? !_is_float_type (src_type) :
+        (src_type != ML_TENSOR_TYPE_UINT16)) {
+      _ml_error_report
+          ("The type of %u'th tensor (%d) is invalid. It should be %s.", i,
+          src_type, to_bf16 ? "a floating point type" :
+          "ML_TENSOR_TYPE_UINT16 holding bfloat16");
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    status = ml_tensors_info_set_tensor_type (dst_info, i,
+        to_bf16 ? ML_TENSOR_TYPE_UINT16 : type);
+    if (status != ML_ERROR_NONE)
+      goto done;
+  }
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_src);
+
+  if (status == ML_ERROR_NONE)
+    status = _ml_tensors_data_convert_to_info (src, dst_info, 1.0f, 0, TRUE,
+        dst);
+
+  if (dst_info)
+    ml_tensors_info_destroy (dst_info);
+
+  return status;
+}
+
+/**
+ * @brief Converts the floating point tensors data to bfloat16. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_convert_to_bfloat16 (const ml_tensors_data_h src,
+    ml_tensors_data_h * dst)
+{
+  return _ml_tensors_data_convert_bf16 (src, ML_TENSOR_TYPE_FLOAT32, TRUE, dst);
+}
+
+/**
+ * @brief Converts the bfloat16 tensors data to the floating point type. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_convert_from_bfloat16 (const ml_tensors_data_h src,
+    ml_tensor_type_e dst_type, ml_tensors_data_h * dst)
+{
+  return _ml_tensors_data_convert_bf16 (src, dst_type, FALSE, dst);
+}
@@ -0,0 +1,481 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-file.c
+ * @date 18 October 2026
+ * @brief ML C-API, memory-mapped tensors data from files.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <nnstreamer_plugin_api_util.h>
+#include "nnstreamer.h"
+#include "ml-api-internal.h"
+
+/**
+ * @brief Data structure for a mapped region of the file.
+ */
+typedef struct
+{
+  gpointer addr; /**< The address of the mapping, aligned to the page size */
+  gsize length; /**< The length of the mapping */
+  guint8 *data; /**< The start of the region in the mapping */
+} ml_tensors_file_map_s;
+
+/**
+ * @brief Data structure for the multi-frame tensors file.
+ */
+typedef struct
+{
+  ml_tensors_info_h info; /**< The information of a frame */
+  gsize frame_size; /**< The size of a frame */
+  guint num_frames; /**< The number of frames */
+  ml_tensors_file_map_s *map; /**< The mapping of all frames */
+  ml_tensors_data_shared_s *shared; /**< The owner of the mapping, shared with the frames */
+} ml_tensors_file_s;
+
+/**
+ * @brief Internal function to release the mapping.
+ */
+static void
+_ml_tensors_file_unmap (gpointer data)
+{
+  ml_tensors_file_map_s *map = (ml_tensors_file_map_s *) data;
+
+  if (map->addr)
+    munmap (map->addr, map->length);
+
+  g_free (map);
+}
+
+/**
+ * @brief Internal function to get the total size of the tensors.
+ */
+static gsize
+_ml_tensors_file_get_frame_size (const ml_tensors_info_h info)
+{
+  ml_tensors_info_s *_info = (ml_tensors_info_s *) info;
+  gsize size = 0;
+  guint i;
+
+  G_LOCK_UNLESS_NOLOCK (*_info);
+  for (i = 0; i < _info->info.num_tensors; i++)
+    size += gst_tensors_info_get_size (&_info->info, i);
+  G_UNLOCK_UNLESS_NOLOCK (*_info);
+
+  return size;
+}
+
+/**
+ * @brief Internal function to parse the mapping options.
+ * @details The option may have "offset" (bytes to skip), "populate" ("true" to prefault the pages) and "advice" ("normal", "sequential", "random" or "willneed").
+ */
+static int
+_ml_tensors_file_parse_option (const ml_option_h option, goffset * offset,
+    gboolean * has_offset, int *flags, int *advice)
+{
+  void *value;
+  gchar *end;
+  gint64 val;
+
+  *offset = 0;
+  *has_offset = FALSE;
+  *flags = MAP_PRIVATE;
+  *advice = MADV_NORMAL;
+
+  if (!option)
+    return ML_ERROR_NONE;
+
+  if (ML_ERROR_NONE == ml_option_get (option, "offset", &value)) {
+    val = g_ascii_strtoll ((const gchar *) value, &end, 10);
+    if (end == (gchar *) value || *end != '\0' || val < 0)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'offset' (%s) is invalid. It should be a non-negative integer.",
+          (const gchar *) value);
+
+    *offset = (goffset) val;
+    *has_offset = TRUE;
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "populate", &value)) {
+    if (g_ascii_strcasecmp ((const gchar *) value, "true") == 0) {
+#ifdef MAP_POPULATE
+      *flags |= MAP_POPULATE;
+#else
+      _ml_logw ("MAP_POPULATE is not supported in this platform. The option 'populate' is ignored.");
+#endif
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "advice", &value)) {
+    const gchar *str = (const gchar *) value;
+
+    if (g_ascii_strcasecmp (str, "normal") == 0)
+      *advice = MADV_NORMAL;
+    else if (g_ascii_strcasecmp (str, "sequential") == 0)
+      *advice = MADV_SEQUENTIAL;
+    else if (g_ascii_strcasecmp (str, "random") == 0)
+      *advice = MADV_RANDOM;
+    else if (g_ascii_strcasecmp (str, "willneed") == 0)
+      *advice = MADV_WILLNEED;
+    else
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'advice' (%s) is invalid. It should be one of 'normal', 'sequential', 'random' and 'willneed'.",
+          str);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to map the region of the file.
+ * @details If @a whole is TRUE, the region is from the offset to the end of the file.
+ *          Otherwise the region has @a size bytes, which should be same as the file size if the offset is not given.
+ */
+static int
+_ml_tensors_file_map (const char *path, const ml_option_h option, gsize size,
+    gboolean whole, ml_tensors_file_map_s ** map)
+{
+  ml_tensors_file_map_s *_map;
+  struct stat st;
+  goffset offset, aligned;
+  gboolean has_offset;
+  int fd, flags, advice, err;
+  int status;
+
+  *map = NULL;
+
+  status = _ml_tensors_file_parse_option (option, &offset, &has_offset,
+      &flags, &advice);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  fd = g_open (path, O_RDONLY, 0);
+  if (fd < 0) {
+    if (errno == EACCES || errno == EPERM)
+      _ml_error_report_return (ML_ERROR_PERMISSION_DENIED,
+          "Failed to open the file '%s'. Permission denied.", path);
+
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to open the file '%s': %s.", path, g_strerror (errno));
+  }
+
+  if (fstat (fd, &st) != 0 || !S_ISREG (st.st_mode)) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The file '%s' is not a regular file.", path);
+  }
+
+  if (offset > (goffset) st.st_size) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The offset %" G_GINT64_FORMAT " exceeds the size of the file '%s' (%"
+        G_GINT64_FORMAT ").", (gint64) offset, path, (gint64) st.st_size);
+  }
+
+  if (whole) {
+    size = (gsize) (st.st_size - offset);
+  } else if ((goffset) size > st.st_size - offset ||
+      (!has_offset && (goffset) size != st.st_size)) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The size of the file '%s' (%" G_GINT64_FORMAT
+        ") mismatches the size of tensors data (%zu) at offset %"
+        G_GINT64_FORMAT ".", path, (gint64) st.st_size, size, (gint64) offset);
+  }
+
+  if (size == 0) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The file '%s' has no data to map at offset %" G_GINT64_FORMAT ".",
+        path, (gint64) offset);
+  }
+
+  _map = g_try_new0 (ml_tensors_file_map_s, 1);
+  if (!_map) {
+    close (fd);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the mapping of the file. Out of memory?");
+  }
+
+  /* The offset of mmap should be aligned to the page size. */
+  aligned = offset - (offset % (goffset) sysconf (_SC_PAGESIZE));
+  _map->length = size + (gsize) (offset - aligned);
+
+  /**
+   * The private writable mapping lets the kernel copy the pages on write,
+   * so the file is never modified and read-only access has no copy.
+   */
+  _map->addr = mmap (NULL, _map->length, PROT_READ | PROT_WRITE, flags, fd,
+      (off_t) aligned);
+  err = errno;
+  close (fd);
+
+  if (_map->addr == MAP_FAILED) {
+    _map->addr = NULL;
+    _ml_tensors_file_unmap (_map);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to map the file '%s': %s.", path, g_strerror (err));
+  }
+
+  if (advice != MADV_NORMAL && madvise (_map->addr, _map->length, advice) != 0)
+    _ml_logw ("Failed to set the memory advice for the file '%s'.", path);
+
+  _map->data = (guint8 *) _map->addr + (offset - aligned);
+  *map = _map;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to create tensors data that points to the mapped region.
+ */
+static int
+_ml_tensors_file_create_data (const ml_tensors_info_h info, guint8 * mem,
+    ml_tensors_data_shared_s * shared, ml_tensors_data_h * data)
+{
+  ml_tensors_data_s *_data;
+  guint i;
+  int status;
+
+  status = _ml_tensors_data_create_no_alloc (info, (ml_tensors_data_h *) & _data);
+  if (status != ML_ERROR_NONE) {
+    _ml_tensors_data_shared_unref (shared);
+    _ml_error_report_return_continue (status,
+        "Failed to create the tensors data handle for the mapped file.");
+  }
+
+  _data->shared = shared;
+  for (i = 0; i < _data->num_tensors; i++) {
+    _data->tensors[i].data = mem;
+    mem += _data->tensors[i].size;
+  }
+
+  *data = _data;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to validate the tensors information for the file.
+ */
+static int
+_ml_tensors_file_validate_info (const ml_tensors_info_h info)
+{
+  bool valid = false;
+  int status;
+
+  status = ml_tensors_info_validate (info, &valid);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "ml_tensors_info_validate() has reported that the parameter, info, is not NULL, but its contents are not valid.");
+  if (!valid)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is not valid. It should have valid number of tensors, type and dimension of every tensor.");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Creates a tensor data frame from the memory-mapped file. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_create_from_file (const char *path,
+    const ml_tensors_info_h info, const ml_option_h option,
+    ml_tensors_data_h * data)
+{
+  ml_tensors_file_map_s *map;
+  ml_tensors_data_shared_s *shared;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!path)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, path, is NULL. It should be a valid path of the raw tensors file.");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which describes the tensors in the file.");
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid space to hold a ml_tensors_data_h handle.");
+
+  status = _ml_tensors_file_validate_info (info);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  status = _ml_tensors_file_map (path, option,
+      _ml_tensors_file_get_frame_size (info), FALSE, &map);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to map the file '%s' as tensors data.", path);
+
+  shared = _ml_tensors_data_shared_new (0, _ml_tensors_file_unmap, map);
+  if (!shared) {
+    _ml_tensors_file_unmap (map);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the shared buffer of tensors data. Out of memory?");
+  }
+
+  return _ml_tensors_file_create_data (info, map->data, shared, data);
+}
+
+/**
+ * @brief Opens the file of concatenated tensor data frames. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_file_open (const char *path, const ml_tensors_info_h info,
+    const ml_option_h option, ml_tensors_file_h * file)
+{
+  ml_tensors_file_s *_file;
+  ml_tensors_file_map_s *map;
+  gsize frame_size, avail;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!path)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, path, is NULL. It should be a valid path of the raw tensors file.");
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which describes a frame in the file.");
+  if (!file)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, file, is NULL. It should be a valid space to hold a ml_tensors_file_h handle.");
+
+  *file = NULL;
+
+  status = _ml_tensors_file_validate_info (info);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  frame_size = _ml_tensors_file_get_frame_size (info);
+
+  status = _ml_tensors_file_map (path, option, 0, TRUE, &map);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to map the file '%s' as tensors data.", path);
+
+  avail = map->length - (gsize) (map->data - (guint8 *) map->addr);
+  if (frame_size == 0 || avail < frame_size) {
+    _ml_tensors_file_unmap (map);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The file '%s' does not have a frame (%zu bytes).", path, frame_size);
+  }
+
+  _file = g_try_new0 (ml_tensors_file_s, 1);
+  if (!_file) {
+    _ml_tensors_file_unmap (map);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the tensors file handle. Out of memory?");
+  }
+
+  _file->map = map;
+  _file->frame_size = frame_size;
+  _file->num_frames = (guint) MIN (avail / frame_size, G_MAXUINT);
+
+  if (avail % frame_size)
+    _ml_logw ("The size of the file '%s' is not a multiple of the frame size (%zu). The trailing bytes are ignored.",
+        path, frame_size);
+
+  _file->shared = _ml_tensors_data_shared_new (0, _ml_tensors_file_unmap, map);
+  if (!_file->shared) {
+    _ml_tensors_file_unmap (map);
+    g_free (_file);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the shared buffer of tensors file. Out of memory?");
+  }
+
+  /* The frames of same index share the mapped memory, the frame is copied when writing. */
+  _file->shared->read_only = TRUE;
+
+  status = _ml_tensors_info_create_from (info, &_file->info);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_file_close (_file);
+    _ml_error_report_return_continue (status,
+        "Failed to copy the tensors information of the file.");
+  }
+
+  *file = _file;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Closes the tensors file. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_file_close (ml_tensors_file_h file)
+{
+  ml_tensors_file_s *_file = (ml_tensors_file_s *) file;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!file)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, file, is NULL. It should be a valid ml_tensors_file_h handle, which is usually created by ml_tensors_file_open().");
+
+  /* The mapping is released when all frames are destroyed. */
+  _ml_tensors_data_shared_unref (_file->shared);
+
+  if (_file->info)
+    ml_tensors_info_destroy (_file->info);
+
+  g_free (_file);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the number of frames in the tensors file. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_file_get_count (ml_tensors_file_h file, unsigned int *count)
+{
+  ml_tensors_file_s *_file = (ml_tensors_file_s *) file;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!file)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, file, is NULL. It should be a valid ml_tensors_file_h handle, which is usually created by ml_tensors_file_open().");
+  if (!count)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, count, is NULL. It should be a valid pointer to get the number of frames.");
+
+  *count = _file->num_frames;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets a tensor data frame of the given index from the tensors file. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_file_get_frame (ml_tensors_file_h file, unsigned int index,
+    ml_tensors_data_h * data)
+{
+  ml_tensors_file_s *_file = (ml_tensors_file_s *) file;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!file)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, file, is NULL. It should be a valid ml_tensors_file_h handle, which is usually created by ml_tensors_file_open().");
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid space to hold a ml_tensors_data_h handle.");
+  if (index >= _file->num_frames)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index (%u), is out of range. The file has %u frames.",
+        index, _file->num_frames);
+
+  return _ml_tensors_file_create_data (_file->info,
+      _file->map->data + (gsize) index * _file->frame_size,
+      _ml_tensors_data_shared_ref (_file->shared), data);
+}
@@ -0,0 +1,311 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-memory.c
+ * @date 18 October 2026
+ * @brief ML C-API, process-wide accounting of tensor memory.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include <glib.h>
+#include "nnstreamer.h"
+#include "nnstreamer-tizen-internal.h"
+#include "ml-api-internal.h"
+
+/**
+ * @brief Data structure for the statistics of accounted memory.
+ */
+typedef struct
+{
+  gsize bytes; /**< The live bytes */
+  gsize peak_bytes; /**< The high-water-mark of live bytes */
+  gsize objects; /**< The number of live objects */
+  gsize peak_objects; /**< The high-water-mark of live objects */
+} ml_memory_stat_s;
+
+/**
+ * @brief The names of memory origins, used for the keys of statistics.
+ */
+static const gchar *ml_memory_origin_names[ML_MEMORY_ORIGIN_MAX] = {
+  [ML_MEMORY_ORIGIN_USER] = "user",
+  [ML_MEMORY_ORIGIN_SINGLE_OUTPUT] = "single_output",
+  [ML_MEMORY_ORIGIN_PIPELINE_SINK] = "pipeline_sink",
+  [ML_MEMORY_ORIGIN_EXTENSION_QUEUE] = "extension_queue",
+  [ML_MEMORY_ORIGIN_QUERY_QUEUE] = "query_queue",
+};
+
+G_LOCK_DEFINE_STATIC (memory_lock);
+static ml_memory_stat_s memory_total;
+static ml_memory_stat_s memory_origin[ML_MEMORY_ORIGIN_MAX];
+static gsize memory_budget = 0;
+
+/**
+ * @brief Internal function to add the memory to the statistics.
+ * @note The caller should hold the memory lock.
+ */
+static void
+_ml_memory_stat_add (ml_memory_stat_s * stat, gsize size)
+{
+  stat->bytes += size;
+  stat->objects++;
+
+  if (stat->bytes > stat->peak_bytes)
+    stat->peak_bytes = stat->bytes;
+  if (stat->objects > stat->peak_objects)
+    stat->peak_objects = stat->objects;
+}
+
+/**
+ * @brief Internal function to remove the memory from the statistics.
+ * @note The caller should hold the memory lock.
+ */
+static void
+_ml_memory_stat_remove (ml_memory_stat_s * stat, gsize size)
+{
+  stat->bytes = (stat->bytes > size) ? (stat->bytes - size) : 0;
+  if (stat->objects > 0)
+    stat->objects--;
+}
+
+/**
+ * @brief Accounts the memory of given origin.
+ */
+int
+_ml_memory_reserve (ml_memory_origin_e origin, gsize size,
+    gboolean check_budget)
+{
+  if ((guint) origin >= ML_MEMORY_ORIGIN_MAX)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, origin (%d), is invalid.", origin);
+
+  G_LOCK (memory_lock);
+
+  if (check_budget && memory_budget > 0 &&
+      (size > memory_budget || memory_total.bytes > memory_budget - size)) {
+    gsize current = memory_total.bytes;
+    gsize budget = memory_budget;
+
+    G_UNLOCK (memory_lock);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to reserve %zu bytes for %s, the memory budget is exceeded (current %zu bytes, budget %zu bytes).",
+        size, ml_memory_origin_names[origin], current, budget);
+  }
+
+  _ml_memory_stat_add (&memory_total, size);
+  _ml_memory_stat_add (&memory_origin[origin], size);
+
+  G_UNLOCK (memory_lock);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Releases the memory accounted with _ml_memory_reserve().
+ */
+void
+_ml_memory_release (ml_memory_origin_e origin, gsize size)
+{
+  if ((guint) origin >= ML_MEMORY_ORIGIN_MAX)
+    return;
+
+  G_LOCK (memory_lock);
+  _ml_memory_stat_remove (&memory_total, size);
+  _ml_memory_stat_remove (&memory_origin[origin], size);
+  G_UNLOCK (memory_lock);
+}
+
+/**
+ * @brief Internal function to account the shared block, or to move the accounted memory of the block to new origin.
+ * @note The buffers are accounted once in the block, although the block is shared by the cloned handles.
+ */
+static int
+_ml_tensors_data_shared_account (ml_tensors_data_shared_s * shared,
+    gsize size, ml_memory_origin_e origin, gboolean check_budget)
+{
+  int status;
+
+  G_LOCK (memory_lock);
+  if (shared->accounted > 0) {
+    if (shared->origin != origin) {
+      _ml_memory_stat_remove (&memory_origin[shared->origin], shared->accounted);
+      _ml_memory_stat_add (&memory_origin[origin], shared->accounted);
+      shared->origin = origin;
+    }
+
+    G_UNLOCK (memory_lock);
+    return ML_ERROR_NONE;
+  }
+  G_UNLOCK (memory_lock);
+
+  /* The block is not accounted yet (e.g., external memory). */
+  status = _ml_memory_reserve (origin, size, check_budget);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  G_LOCK (memory_lock);
+  if (shared->accounted > 0) {
+    /* Accounted by other handle in the meantime. */
+    G_UNLOCK (memory_lock);
+    _ml_memory_release (origin, size);
+    return ML_ERROR_NONE;
+  }
+
+  shared->origin = origin;
+  shared->accounted = size;
+  G_UNLOCK (memory_lock);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Accounts the tensor buffers of the data handle, until the handle is destroyed or _ml_tensors_data_unaccount() is called.
+ */
+int
+_ml_tensors_data_account (ml_tensors_data_s * data, ml_memory_origin_e origin,
+    gboolean check_budget)
+{
+  gsize size = 0;
+  guint i;
+  int status;
+
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_s struct.");
+
+  if ((guint) origin >= ML_MEMORY_ORIGIN_MAX)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, origin (%d), is invalid.", origin);
+
+  for (i = 0; i < data->num_tensors; i++)
+    size += data->tensors[i].size;
+
+  /* The shared buffers are accounted in the block, not to count the buffers again in the cloned handles. */
+  if (data->shared)
+    return _ml_tensors_data_shared_account (data->shared, size, origin,
+        check_budget);
+
+  status = _ml_memory_reserve (origin, size, check_budget);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  /* Move the accounted memory to new origin. */
+  _ml_tensors_data_unaccount (data);
+
+  data->origin = origin;
+  data->accounted = size;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Releases the memory accounted for the data handle.
+ * @note The memory accounted in the shared block is released with the last reference of the block.
+ */
+void
+_ml_tensors_data_unaccount (ml_tensors_data_s * data)
+{
+  if (!data || data->accounted == 0)
+    return;
+
+  _ml_memory_release (data->origin, data->accounted);
+  data->accounted = 0;
+}
+
+/**
+ * @brief Internal function to set the statistics value in the information handle.
+ */
+static int
+_ml_memory_stats_set (ml_information_h stats, const gchar * key, gsize value)
+{
+  size_t *v;
+
+  v = g_try_new (size_t, 1);
+  if (!v)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the value of memory statistics. Out of memory?");
+
+  *v = value;
+  return _ml_information_set (stats, key, v, g_free);
+}
+
+/**
+ * @brief Gets the statistics of tensor memory tracked by machine-learning API.
+ */
+int
+ml_api_get_memory_stats (ml_information_h * stats)
+{
+  ml_memory_stat_s total;
+  ml_memory_stat_s origin[ML_MEMORY_ORIGIN_MAX];
+  gsize budget;
+  ml_information_h _stats = NULL;
+  gchar key[64];
+  int status, i;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!stats)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, stats, is NULL. It should be a valid pointer to ml_information_h.");
+
+  /* Take a snapshot so that the values are consistent. */
+  G_LOCK (memory_lock);
+  total = memory_total;
+  memcpy (origin, memory_origin, sizeof (origin));
+  budget = memory_budget;
+  G_UNLOCK (memory_lock);
+
+  status = _ml_information_create (&_stats);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to create the information handle for memory statistics.");
+
+  status = _ml_memory_stats_set (_stats, "current", total.bytes);
+  if (status == ML_ERROR_NONE)
+    status = _ml_memory_stats_set (_stats, "peak", total.peak_bytes);
+  if (status == ML_ERROR_NONE)
+    status = _ml_memory_stats_set (_stats, "objects", total.objects);
+  if (status == ML_ERROR_NONE)
+    status = _ml_memory_stats_set (_stats, "peak_objects", total.peak_objects);
+  if (status == ML_ERROR_NONE)
+    status = _ml_memory_stats_set (_stats, "budget", budget);
+
+  for (i = 0; i < ML_MEMORY_ORIGIN_MAX && status == ML_ERROR_NONE; i++) {
+    g_snprintf (key, sizeof (key), "%s.current", ml_memory_origin_names[i]);
+    status = _ml_memory_stats_set (_stats, key, origin[i].bytes);
+
+    if (status == ML_ERROR_NONE) {
+      g_snprintf (key, sizeof (key), "%s.peak", ml_memory_origin_names[i]);
+      status = _ml_memory_stats_set (_stats, key, origin[i].peak_bytes);
+    }
+
+    if (status == ML_ERROR_NONE) {
+      g_snprintf (key, sizeof (key), "%s.objects", ml_memory_origin_names[i]);
+      status = _ml_memory_stats_set (_stats, key, origin[i].objects);
+    }
+  }
+
+  if (status != ML_ERROR_NONE) {
+    ml_information_destroy (_stats);
+    _ml_error_report_return_continue (status,
+        "Failed to set the memory statistics.");
+  }
+
+  *stats = _stats;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the soft budget of tensor memory tracked by machine-learning API.
+ */
+int
+ml_api_set_memory_budget (size_t budget)
+{
+  check_feature_state (ML_FEATURE);
+
+  G_LOCK (memory_lock);
+  memory_budget = budget;
+  G_UNLOCK (memory_lock);
+
+  return ML_ERROR_NONE;
+}
@@ -0,0 +1,762 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-preprocess.c
+ * @date 18 October 2026
+ * @brief ML C-API, fused image pre-processing (resize, normalization and layout transpose).
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api_util.h>
+#include "nnstreamer.h"
+#include "ml-api-internal.h"
+
+#if defined (__x86_64__) || defined (__i386__)
+#define ML_PREPROCESS_X86 1
+#include <immintrin.h>
+#elif defined (__aarch64__) && defined (__ARM_NEON)
+#define ML_PREPROCESS_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief The max number of channels for normalization.
+ */
+#define ML_PREPROCESS_MAX_CHANNELS (16U)
+
+/**
+ * @brief The number of output elements processed by a thread at least.
+ */
+#define ML_PREPROCESS_ELEMENTS_PER_THREAD (1U << 18)
+
+/**
+ * @brief The max value of the option 'num_threads'.
+ */
+#define ML_PREPROCESS_MAX_THREADS (256U)
+
+/**
+ * @brief Data structure for pre-processing configuration.
+ */
+struct _ml_preprocess_s
+{
+  gboolean nchw; /**< TRUE if the output layout is NCHW */
+  guint num_mean; /**< The number of mean values, 0 or 1 or the number of channels */
+  guint num_std; /**< The number of std values, 0 or 1 or the number of channels */
+  gfloat mean[ML_PREPROCESS_MAX_CHANNELS]; /**< The mean values */
+  gfloat std[ML_PREPROCESS_MAX_CHANNELS]; /**< The standard deviation values */
+  guint num_threads; /**< The max number of threads, 0 to decide by frame size (option is not given) */
+};
+
+/**
+ * @brief Data structure for pre-processing a range of output rows.
+ */
+typedef struct
+{
+  const ml_preprocess_s *pp;
+  const guint8 *src;
+  guint src_w;
+  guint src_h;
+  guint ch;
+  guint8 *dst;
+  ml_tensor_type_e dst_type;
+  gsize dst_esize;
+  guint dst_w;
+  guint dst_h;
+  const guint *xofs; /**< Element offsets of the left source pixels */
+  const gfloat *xw; /**< Weights of the right source pixels */
+  const gfloat *scale; /**< Per element scale (1 / std), length is dst_w * ch */
+  const gfloat *bias; /**< Per element bias (-mean / std), length is dst_w * ch */
+  guint row_start;
+  guint row_end;
+  int status;
+
+  /* sync */
+  GMutex *lock;
+  GCond *cond;
+  guint *remaining;
+} ml_preprocess_task_s;
+
+/**
+ * @brief Function to blend two rows vertically and normalize.
+ */
+typedef void (*ml_preprocess_blend_func) (const gfloat * r0,
+    const gfloat * r1, gfloat wy, const gfloat * scale, const gfloat * bias,
+    gfloat * out, gsize count);
+
+static GThreadPool *preprocess_pool = NULL;
+static gboolean preprocess_pool_closed = FALSE;
+G_LOCK_DEFINE_STATIC (preprocess_pool_lock);
+
+static void fini_ml_preprocess (void) __attribute__ ((destructor));
+
+/**
+ * @brief Scalar kernel to blend two rows vertically and normalize.
+ */
+static void
+_blend_normalize_c (const gfloat * r0, const gfloat * r1, gfloat wy,
+    const gfloat * scale, const gfloat * bias, gfloat * out, gsize count)
+{
+  gsize i;
+
+  for (i = 0; i < count; i++)
+    out[i] = (r0[i] + (r1[i] - r0[i]) * wy) * scale[i] + bias[i];
+}
+
+#if defined (ML_PREPROCESS_X86)
+/**
+ * @brief AVX kernel to blend two rows vertically and normalize.
+ */
+__attribute__ ((target ("avx")))
+static void
+_blend_normalize_avx (const gfloat * r0, const gfloat * r1, gfloat wy,
+    const gfloat * scale, const gfloat * bias, gfloat * out, gsize count)
+{
+  const __m256 vwy = _mm256_set1_ps (wy);
+  gsize i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    __m256 a = _mm256_loadu_ps (r0 + i);
+    __m256 b = _mm256_loadu_ps (r1 + i);
+    __m256 v = _mm256_add_ps (a, _mm256_mul_ps (_mm256_sub_ps (b, a), vwy));
+
+    v = _mm256_add_ps (_mm256_mul_ps (v, _mm256_loadu_ps (scale + i)),
+        _mm256_loadu_ps (bias + i));
+    _mm256_storeu_ps (out + i, v);
+  }
+
+  _blend_normalize_c (r0 + i, r1 + i, wy, scale + i, bias + i, out + i,
+      count - i);
+}
+#elif defined (ML_PREPROCESS_NEON)
+/**
+ * @brief NEON kernel to blend two rows vertically and normalize.
+ */
+static void
+_blend_normalize_neon (const gfloat * r0, const gfloat * r1, gfloat wy,
+    const gfloat * scale, const gfloat * bias, gfloat * out, gsize count)
+{
+  const float32x4_t vwy = vdupq_n_f32 (wy);
+  gsize i = 0;
+
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t a = vld1q_f32 (r0 + i);
+    float32x4_t b = vld1q_f32 (r1 + i);
+    float32x4_t v = vaddq_f32 (a, vmulq_f32 (vsubq_f32 (b, a), vwy));
+
+    v = vaddq_f32 (vmulq_f32 (v, vld1q_f32 (scale + i)), vld1q_f32 (bias + i));
+    vst1q_f32 (out + i, v);
+  }
+
+  _blend_normalize_c (r0 + i, r1 + i, wy, scale + i, bias + i, out + i,
+      count - i);
+}
+#endif
+
+/**
+ * @brief Internal function to find the blend kernel once.
+ */
+static gpointer
+_find_blend_kernel (gpointer data)
+{
+#if defined (ML_PREPROCESS_X86)
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx"))
+    return (gpointer) _blend_normalize_avx;
+#elif defined (ML_PREPROCESS_NEON)
+  return (gpointer) _blend_normalize_neon;
+#endif
+  return (gpointer) _blend_normalize_c;
+}
+
+/**
+ * @brief Internal function to get the blend kernel.
+ */
+static ml_preprocess_blend_func
+_get_blend_kernel (void)
+{
+  static GOnce once = G_ONCE_INIT;
+
+  return (ml_preprocess_blend_func) g_once (&once, _find_blend_kernel, NULL);
+}
+
+/**
+ * @brief Internal function to interpolate a source row horizontally.
+ */
+static void
+_interpolate_row (const ml_preprocess_task_s * task, guint y, gfloat * row)
+{
+  const guint8 *s = task->src + (gsize) y * task->src_w * task->ch;
+  const guint step = (task->src_w > 1) ? task->ch : 0;
+  guint x, c, o;
+  gfloat w, p0;
+
+  for (x = 0; x < task->dst_w; x++) {
+    o = task->xofs[x];
+    w = task->xw[x];
+
+    for (c = 0; c < task->ch; c++) {
+      p0 = s[o + c];
+      /* the right pixel is clamped in xofs, step is 0 if the width is 1. */
+      *row++ = p0 + ((gfloat) s[MIN (o + c + step,
+                  (task->src_w - 1) * task->ch + c)] - p0) * w;
+    }
+  }
+}
+
+/**
+ * @brief Internal function to process the range of output rows.
+ */
+static void
+_preprocess_rows (ml_preprocess_task_s * task)
+{
+  ml_preprocess_blend_func blend = _get_blend_kernel ();
+  const gsize row_len = (gsize) task->dst_w * task->ch;
+  gfloat *buffer, *r0, *r1, *tmp, *plane, *out, *swap;
+  gint tag0 = -1, tag1 = -1, t;
+  gfloat fy, sy, wy;
+  guint y, y0, y1, x, c;
+  guint8 *dst_row;
+
+  buffer = g_try_new (gfloat, row_len * 4);
+  if (!buffer) {
+    task->status = ML_ERROR_OUT_OF_MEMORY;
+    return;
+  }
+
+  r0 = buffer;
+  r1 = r0 + row_len;
+  tmp = r1 + row_len;
+  plane = tmp + row_len;
+  sy = (gfloat) task->src_h / (gfloat) task->dst_h;
+
+  for (y = task->row_start; y < task->row_end; y++) {
+    fy = ((gfloat) y + 0.5f) * sy - 0.5f;
+    if (fy < 0.0f)
+      fy = 0.0f;
+
+    y0 = MIN ((guint) fy, task->src_h - 1);
+    y1 = MIN (y0 + 1, task->src_h - 1);
+    wy = fy - (gfloat) y0;
+
+    /* reuse the interpolated rows of the previous output row. */
+    if (tag0 != (gint) y0) {
+      if (tag1 == (gint) y0) {
+        swap = r0;
+        r0 = r1;
+        r1 = swap;
+        t = tag0;
+        tag0 = tag1;
+        tag1 = t;
+      } else {
+        _interpolate_row (task, y0, r0);
+        tag0 = (gint) y0;
+      }
+    }
+
+    if (tag1 != (gint) y1) {
+      _interpolate_row (task, y1, r1);
+      tag1 = (gint) y1;
+    }
+
+    if (!task->pp->nchw) {
+      dst_row = task->dst + (gsize) y * row_len * task->dst_esize;
+      out = (task->dst_type == ML_TENSOR_TYPE_FLOAT32) ?
+          (gfloat *) dst_row : tmp;
+
+      blend (r0, r1, wy, task->scale, task->bias, out, row_len);
+
+      if (out == tmp) {
+        task->status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, tmp,
+            task->dst_type, dst_row, row_len, 1.0f, 0);
+      }
+    } else {
+      blend (r0, r1, wy, task->scale, task->bias, tmp, row_len);
+
+      for (c = 0; c < task->ch; c++) {
+        for (x = 0; x < task->dst_w; x++)
+          plane[x] = tmp[(gsize) x * task->ch + c];
+
+        dst_row = task->dst + (((gsize) c * task->dst_h + y) * task->dst_w) *
+            task->dst_esize;
+        task->status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, plane,
+            task->dst_type, dst_row, task->dst_w, 1.0f, 0);
+      }
+    }
+
+    if (task->status != ML_ERROR_NONE)
+      break;
+  }
+
+  g_free (buffer);
+}
+
+/**
+ * @brief Internal function to run the task in the thread pool.
+ */
+static void
+_preprocess_thread_func (gpointer data, gpointer user_data)
+{
+  ml_preprocess_task_s *task = (ml_preprocess_task_s *) data;
+
+  _preprocess_rows (task);
+
+  g_mutex_lock (task->lock);
+  (*task->remaining)--;
+  g_cond_signal (task->cond);
+  g_mutex_unlock (task->lock);
+}
+
+/**
+ * @brief Internal function to push the task to the shared thread pool.
+ * @return FALSE if the task is not pushed. The caller should run the task.
+ */
+static gboolean
+_push_task (ml_preprocess_task_s * task)
+{
+  gboolean pushed = FALSE;
+
+  G_LOCK (preprocess_pool_lock);
+  if (!preprocess_pool && !preprocess_pool_closed) {
+    preprocess_pool = g_thread_pool_new (_preprocess_thread_func, NULL,
+        (gint) g_get_num_processors (), FALSE, NULL);
+  }
+
+  if (preprocess_pool)
+    pushed = g_thread_pool_push (preprocess_pool, task, NULL);
+  G_UNLOCK (preprocess_pool_lock);
+
+  return pushed;
+}
+
+/**
+ * @brief Releases the shared thread pool when the library is unloaded.
+ * @details The tasks already pushed are done before releasing the pool, then new tasks run in the caller thread.
+ */
+static void
+fini_ml_preprocess (void)
+{
+  GThreadPool *pool;
+
+  G_LOCK (preprocess_pool_lock);
+  pool = preprocess_pool;
+  preprocess_pool = NULL;
+  preprocess_pool_closed = TRUE;
+  G_UNLOCK (preprocess_pool_lock);
+
+  if (pool)
+    g_thread_pool_free (pool, FALSE, TRUE);
+}
+
+/**
+ * @brief Internal function to parse comma-separated float values.
+ */
+static int
+_parse_float_list (const gchar * str, gfloat * values, guint * num)
+{
+  gchar **strv;
+  gchar *end;
+  guint i, n;
+  int status = ML_ERROR_NONE;
+
+  strv = g_strsplit (str, ",", -1);
+  n = g_strv_length (strv);
+
+  if (n == 0 || n > ML_PREPROCESS_MAX_CHANNELS) {
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  for (i = 0; i < n; i++) {
+    values[i] = (gfloat) g_ascii_strtod (g_strstrip (strv[i]), &end);
+    if (end == strv[i] || *end != '\0') {
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+  }
+
+  *num = n;
+
+done:
+  g_strfreev (strv);
+  return status;
+}
+
+/**
+ * @brief Creates the pre-processing configuration from the option.
+ */
+int
+_ml_preprocess_create (const ml_option_h option, ml_preprocess_s ** pp)
+{
+  ml_preprocess_s *_pp;
+  void *value;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  if (!pp)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pp, is NULL. It should be a valid pointer to hold the pre-processing configuration.");
+
+  *pp = NULL;
+
+  _pp = g_try_new0 (ml_preprocess_s, 1);
+  if (!_pp)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the pre-processing configuration. Out of memory?");
+
+  if (!option)
+    goto done;
+
+  if (ML_ERROR_NONE == ml_option_get (option, "layout", &value)) {
+    if (g_ascii_strcasecmp ((const gchar *) value, "NCHW") == 0) {
+      _pp->nchw = TRUE;
+    } else if (g_ascii_strcasecmp ((const gchar *) value, "NHWC") != 0) {
+      _ml_error_report
+          ("The option 'layout' (%s) is invalid. It should be either 'NHWC' or 'NCHW'.",
+          (const gchar *) value);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "mean", &value)) {
+    if (_parse_float_list ((const gchar *) value, _pp->mean,
+            &_pp->num_mean) != ML_ERROR_NONE) {
+      _ml_error_report
+          ("The option 'mean' (%s) is invalid. It should be comma-separated numbers for each channel (max %u).",
+          (const gchar *) value, ML_PREPROCESS_MAX_CHANNELS);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "std", &value)) {
+    if (_parse_float_list ((const gchar *) value, _pp->std,
+            &_pp->num_std) != ML_ERROR_NONE) {
+      _ml_error_report
+          ("The option 'std' (%s) is invalid. It should be comma-separated numbers for each channel (max %u).",
+          (const gchar *) value, ML_PREPROCESS_MAX_CHANNELS);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    for (i = 0; i < _pp->num_std; i++) {
+      if (_pp->std[i] == 0.0f) {
+        _ml_error_report ("The option 'std' should not have zero value.");
+        status = ML_ERROR_INVALID_PARAMETER;
+        goto done;
+      }
+    }
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "num_threads", &value)) {
+    guint64 num_threads;
+
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 1,
+            ML_PREPROCESS_MAX_THREADS, &num_threads, NULL)) {
+      _ml_error_report
+          ("The option 'num_threads' (%s) is invalid. It should be a positive integer, not larger than %u.",
+          (const gchar *) value, ML_PREPROCESS_MAX_THREADS);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    _pp->num_threads = (guint) num_threads;
+  }
+
+done:
+  if (status == ML_ERROR_NONE)
+    *pp = _pp;
+  else
+    g_free (_pp);
+
+  return status;
+}
+
+/**
+ * @brief Releases the pre-processing configuration.
+ */
+void
+_ml_preprocess_destroy (ml_preprocess_s * pp)
+{
+  g_free (pp);
+}
+
+/**
+ * @brief Internal function to get the dimension of an image tensor. (C, W, H, N=1)
+ */
+static gboolean
+_get_image_dimension (GstTensorInfo * info, gboolean nchw, guint * ch,
+    guint * w, guint * h)
+{
+  guint i;
+
+  for (i = 3; i < ML_TENSOR_RANK_LIMIT; i++) {
+    if (info->dimension[i] > 1)
+      return FALSE;
+  }
+
+  if (nchw) {
+    *w = info->dimension[0];
+    *h = info->dimension[1];
+    *ch = info->dimension[2];
+  } else {
+    *ch = info->dimension[0];
+    *w = info->dimension[1];
+    *h = info->dimension[2];
+  }
+
+  return (*ch > 0 && *w > 0 && *h > 0);
+}
+
+/**
+ * @brief Pre-processes the image tensor into the given tensors information.
+ */
+int
+_ml_preprocess_run (const ml_preprocess_s * pp, const ml_tensors_data_h src,
+    const ml_tensors_info_h dst_info, ml_tensors_data_h * dst)
+{
+  ml_tensors_data_s *_src, *_dst = NULL;
+  ml_tensors_info_s *_src_info, *_dst_info;
+  GstTensorInfo *src_tinfo, *dst_tinfo;
+  ml_preprocess_task_s *tasks = NULL;
+  guint *xofs = NULL;
+  gfloat *xw = NULL, *scale = NULL, *bias = NULL;
+  guint src_ch, src_w, src_h, dst_ch, dst_w, dst_h;
+  guint x, c, i, num_tasks, rows, remaining;
+  gsize row_len;
+  gfloat fx, sx, mean, std;
+  GMutex lock;
+  GCond cond;
+  int status = ML_ERROR_NONE;
+
+  if (!pp || !src || !dst_info || !dst)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pp, src, dst_info or dst is NULL.");
+
+  *dst = NULL;
+  _src = (ml_tensors_data_s *) src;
+  _dst_info = (ml_tensors_info_s *) dst_info;
+
+  G_LOCK_UNLESS_NOLOCK (*_src);
+  _src_info = (ml_tensors_info_s *) _src->info;
+
+  if (!_src_info || _src->num_tensors != 1) {
+    _ml_error_report
+        ("The parameter, src, should have a single image tensor (uint8, dimension channel:width:height:1).");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  /* The data may be given in the sink callback, map the buffer. */
+  status = _ml_tensors_data_map (_src, 0);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to map the buffer of the parameter, src.");
+    goto done;
+  }
+
+  src_tinfo = gst_tensors_info_get_nth_info (&_src_info->info, 0);
+  if (src_tinfo->type != _NNS_UINT8 ||
+      !_get_image_dimension (src_tinfo, FALSE, &src_ch, &src_w, &src_h)) {
+    _ml_error_report
+        ("The parameter, src, should have a single image tensor (uint8, dimension channel:width:height:1).");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  G_LOCK_UNLESS_NOLOCK (*_dst_info);
+  dst_tinfo = (_dst_info->info.num_tensors == 1) ?
+      gst_tensors_info_get_nth_info (&_dst_info->info, 0) : NULL;
+  if (!dst_tinfo ||
+      !_get_image_dimension (dst_tinfo, pp->nchw, &dst_ch, &dst_w, &dst_h)) {
+    G_UNLOCK_UNLESS_NOLOCK (*_dst_info);
+    _ml_error_report
+        ("The parameter, dst_info, should have a single tensor with the dimension %s.",
+        pp->nchw ? "width:height:channel:1 (NCHW)" :
+        "channel:width:height:1 (NHWC)");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+  G_UNLOCK_UNLESS_NOLOCK (*_dst_info);
+
+  if (src_ch != dst_ch || src_ch > ML_PREPROCESS_MAX_CHANNELS ||
+      (pp->num_mean > 1 && pp->num_mean != src_ch) ||
+      (pp->num_std > 1 && pp->num_std != src_ch)) {
+    _ml_error_report
+        ("The number of channels mismatches: source %u, destination %u, mean %u, std %u.",
+        src_ch, dst_ch, pp->num_mean, pp->num_std);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = ml_tensors_data_create (dst_info, (ml_tensors_data_h *) & _dst);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to allocate the tensors data for pre-processing.");
+    goto done;
+  }
+
+  /* horizontal sampling table and per element normalization coefficients */
+  row_len = (gsize) dst_w * dst_ch;
+  xofs = g_try_new (guint, dst_w);
+  xw = g_try_new (gfloat, dst_w);
+  scale = g_try_new (gfloat, row_len);
+  bias = g_try_new (gfloat, row_len);
+  if (!xofs || !xw || !scale || !bias) {
+    _ml_error_report
+        ("Failed to allocate the sampling table for pre-processing. Out of memory?");
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  sx = (gfloat) src_w / (gfloat) dst_w;
+  for (x = 0; x < dst_w; x++) {
+    fx = ((gfloat) x + 0.5f) * sx - 0.5f;
+    if (fx < 0.0f)
+      fx = 0.0f;
+
+    xofs[x] = MIN ((guint) fx, src_w - 1) * src_ch;
+    xw[x] = fx - (gfloat) (xofs[x] / src_ch);
+
+    for (c = 0; c < dst_ch; c++) {
+      mean = (pp->num_mean == 0) ? 0.0f :
+          pp->mean[(pp->num_mean == 1) ? 0 : c];
+      std = (pp->num_std == 0) ? 1.0f : pp->std[(pp->num_std == 1) ? 0 : c];
+
+      scale[(gsize) x * dst_ch + c] = 1.0f / std;
+      bias[(gsize) x * dst_ch + c] = -mean / std;
+    }
+  }
+
+  /* decide the number of threads */
+  num_tasks = pp->num_threads;
+  if (num_tasks == 0)
+    num_tasks = (guint) MAX (1, (row_len * dst_h) /
+        ML_PREPROCESS_ELEMENTS_PER_THREAD);
+  num_tasks = MIN (num_tasks, MIN (g_get_num_processors (), dst_h));
+  num_tasks = MAX (num_tasks, 1);
+
+  tasks = g_try_new0 (ml_preprocess_task_s, num_tasks);
+  if (!tasks) {
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  g_mutex_init (&lock);
+  g_cond_init (&cond);
+  rows = (dst_h + num_tasks - 1) / num_tasks;
+  remaining = 0;
+
+  for (i = 0; i < num_tasks; i++) {
+    tasks[i].pp = pp;
+    tasks[i].src = (const guint8 *) _src->tensors[0].data;
+    tasks[i].src_w = src_w;
+    tasks[i].src_h = src_h;
+    tasks[i].ch = src_ch;
+    tasks[i].dst = (guint8 *) _dst->tensors[0].data;
+    tasks[i].dst_type = (ml_tensor_type_e) dst_tinfo->type;
+    tasks[i].dst_esize = gst_tensor_get_element_size (dst_tinfo->type);
+    tasks[i].dst_w = dst_w;
+    tasks[i].dst_h = dst_h;
+    tasks[i].xofs = xofs;
+    tasks[i].xw = xw;
+    tasks[i].scale = scale;
+    tasks[i].bias = bias;
+    tasks[i].row_start = MIN (i * rows, dst_h);
+    tasks[i].row_end = MIN ((i + 1) * rows, dst_h);
+    tasks[i].status = ML_ERROR_NONE;
+    tasks[i].lock = &lock;
+    tasks[i].cond = &cond;
+    tasks[i].remaining = &remaining;
+  }
+
+  /* the caller thread processes the first range. */
+  for (i = 1; i < num_tasks; i++) {
+    g_mutex_lock (&lock);
+    remaining++;
+    g_mutex_unlock (&lock);
+
+    if (!_push_task (&tasks[i])) {
+      g_mutex_lock (&lock);
+      remaining--;
+      g_mutex_unlock (&lock);
+      _preprocess_rows (&tasks[i]);
+    }
+  }
+
+  _preprocess_rows (&tasks[0]);
+
+  g_mutex_lock (&lock);
+  while (remaining > 0)
+    g_cond_wait (&cond, &lock);
+  g_mutex_unlock (&lock);
+
+  g_cond_clear (&cond);
+  g_mutex_clear (&lock);
+
+  for (i = 0; i < num_tasks; i++) {
+    if (tasks[i].status != ML_ERROR_NONE) {
+      status = tasks[i].status;
+      _ml_error_report ("Failed to pre-process the image, error %d.", status);
+      break;
+    }
+  }
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_src);
+
+  g_free (tasks);
+  g_free (xofs);
+  g_free (xw);
+  g_free (scale);
+  g_free (bias);
+
+  if (status == ML_ERROR_NONE)
+    *dst = _dst;
+  else if (_dst)
+    ml_tensors_data_destroy (_dst);
+
+  return status;
+}
+
+/**
+ * @brief Pre-processes the image tensor. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_preprocess (const ml_tensors_data_h src,
+    const ml_tensors_info_h dst_info, const ml_option_h option,
+    ml_tensors_data_h * dst)
+{
+  ml_preprocess_s *pp;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!src)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src, is NULL. It should be a valid ml_tensors_data_h handle of an image tensor.");
+  if (!dst_info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dst_info, is NULL. It should be a valid ml_tensors_info_h handle, e.g., the input information of the model from ml_single_get_input_info().");
+  if (!dst)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dst, is NULL. It should be a valid pointer to a space that can hold a ml_tensors_data_h handle.");
+
+  status = _ml_preprocess_create (option, &pp);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to parse the pre-processing option.");
+
+  status = _ml_preprocess_run (pp, src, dst_info, dst);
+  _ml_preprocess_destroy (pp);
+
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to pre-process the image tensor.");
+
+  return ML_ERROR_NONE;
+}
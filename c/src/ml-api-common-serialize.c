@@ -0,0 +1,559 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-serialize.c
+ * @date 18 October 2026
+ * @brief ML C-API, binary serialization of tensors data and information.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ *
+ * @details The serialized blob has the following layout. The fields of the blob and frame headers are little-endian.
+ *          Every tensor has the flexible tensor header of NNStreamer (GstTensorMetaInfo) and its data.
+ *          The offset of tensor data is aligned to ML_TENSORS_BLOB_ALIGN bytes from the start of the blob.
+ *
+ *          | blob header (32 bytes) | padding | frame 0 | frame 1 | ... |
+ *          frame: | frame header (16 bytes) | tensor 0 | tensor 1 | ... |
+ *          tensor: | GstTensorMetaInfo header | padding | data | padding |
+ */
+
+#include <string.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api_util.h>
+#include "nnstreamer.h"
+#include "ml-api-internal.h"
+#include "ml-api-inference-internal.h"
+
+/**
+ * @brief The magic number of the blob ("MLTD").
+ */
+#define ML_TENSORS_BLOB_MAGIC (0x44544C4DU)
+
+/**
+ * @brief The version of the blob format.
+ */
+#define ML_TENSORS_BLOB_VERSION (1U)
+
+/**
+ * @brief The flag of the blob, the blob has the checksum (CRC32) of the frames.
+ */
+#define ML_TENSORS_BLOB_FLAG_CHECKSUM (1U << 0)
+
+/**
+ * @brief The alignment of tensor data in the blob.
+ */
+#define ML_TENSORS_BLOB_ALIGN (64U)
+
+/**
+ * @brief Macro to align the offset in the blob.
+ */
+#define ML_TENSORS_BLOB_ALIGN_UP(o) (((o) + ML_TENSORS_BLOB_ALIGN - 1) & ~((gsize) ML_TENSORS_BLOB_ALIGN - 1))
+
+/**
+ * @brief The header of the blob.
+ */
+typedef struct
+{
+  guint32 magic; /**< ML_TENSORS_BLOB_MAGIC */
+  guint16 version; /**< ML_TENSORS_BLOB_VERSION */
+  guint16 flags; /**< ML_TENSORS_BLOB_FLAG_* */
+  guint32 num_frames; /**< The number of frames */
+  guint32 checksum; /**< CRC32 of the frames if ML_TENSORS_BLOB_FLAG_CHECKSUM is set */
+  guint64 size; /**< The total size of the blob */
+  guint64 reserved; /**< Reserved, 0 */
+} ml_tensors_blob_header_s;
+
+/**
+ * @brief The header of a frame in the blob.
+ */
+typedef struct
+{
+  guint32 num_tensors; /**< The number of tensors in the frame */
+  guint32 reserved; /**< Reserved, 0 */
+  guint64 size; /**< The size of the frame including this header */
+} ml_tensors_blob_frame_s;
+
+G_STATIC_ASSERT (sizeof (ml_tensors_blob_header_s) == 32);
+G_STATIC_ASSERT (sizeof (ml_tensors_blob_frame_s) == 16);
+
+/**
+ * @brief The offset of the first frame. Every frame starts at the aligned offset.
+ */
+#define ML_TENSORS_BLOB_FRAME_START ML_TENSORS_BLOB_ALIGN_UP (sizeof (ml_tensors_blob_header_s))
+
+/**
+ * @brief Internal function to create the CRC32 (IEEE 802.3) table.
+ */
+static gpointer
+_crc32_table_init (gpointer data)
+{
+  static guint32 table[256];
+  guint32 c, i, k;
+
+  for (i = 0; i < 256; i++) {
+    c = i;
+    for (k = 0; k < 8; k++)
+      c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+    table[i] = c;
+  }
+
+  return table;
+}
+
+/**
+ * @brief Internal function to calculate CRC32 of the buffer.
+ */
+static guint32
+_crc32 (const guint8 * buf, gsize len)
+{
+  static GOnce once = G_ONCE_INIT;
+  const guint32 *table = (const guint32 *) g_once (&once, _crc32_table_init,
+      NULL);
+  guint32 crc = 0xFFFFFFFFU;
+  gsize i;
+
+  for (i = 0; i < len; i++)
+    crc = table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+
+  return crc ^ 0xFFFFFFFFU;
+}
+
+/**
+ * @brief Internal function to get the size of a serialized frame and the meta of its tensors.
+ */
+static int
+_ml_tensors_blob_get_frame_size (ml_tensors_data_s * data,
+    GstTensorMetaInfo * meta, gsize * size)
+{
+  ml_tensors_info_s *_info = (ml_tensors_info_s *) data->info;
+  GstTensorInfo *tinfo;
+  gsize offset;
+  guint i;
+
+  if (!_info || data->num_tensors == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The tensors data to be serialized does not have valid tensors information.");
+
+  offset = sizeof (ml_tensors_blob_frame_s);
+
+  G_LOCK_UNLESS_NOLOCK (*_info);
+  for (i = 0; i < data->num_tensors; i++) {
+    tinfo = gst_tensors_info_get_nth_info (&_info->info, i);
+    gst_tensor_info_convert_to_meta (tinfo, &meta[i]);
+    meta[i].format = _NNS_TENSOR_FORMAT_FLEXIBLE;
+
+    if (gst_tensor_meta_info_get_data_size (&meta[i]) != data->tensors[i].size) {
+      G_UNLOCK_UNLESS_NOLOCK (*_info);
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The size of %u-th tensor (%zu) mismatches its information (%zu).",
+          i, data->tensors[i].size,
+          gst_tensor_meta_info_get_data_size (&meta[i]));
+    }
+
+    offset += gst_tensor_meta_info_get_header_size (&meta[i]);
+    offset = ML_TENSORS_BLOB_ALIGN_UP (offset);
+    offset += data->tensors[i].size;
+    offset = ML_TENSORS_BLOB_ALIGN_UP (offset);
+  }
+  G_UNLOCK_UNLESS_NOLOCK (*_info);
+
+  *size = offset;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Serializes the tensor data frames and their information. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_serialize (const ml_tensors_data_h * frames,
+    unsigned int num_frames, const ml_option_h option, void **blob,
+    size_t *size)
+{
+  ml_tensors_blob_header_s header;
+  ml_tensors_blob_frame_s fheader;
+  ml_tensors_data_s *_data;
+  GstTensorMetaInfo *meta = NULL;
+  gsize *frame_size = NULL;
+  gsize total, offset, hsize;
+  guint8 *buf = NULL;
+  gboolean checksum = FALSE;
+  void *value;
+  guint f, i;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!frames || num_frames == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, frames, is NULL or num_frames is 0. It should be a valid array of ml_tensors_data_h handles.");
+  if (!blob || !size)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, blob or size, is NULL. It should be a valid pointer to get the serialized blob.");
+
+  *blob = NULL;
+  *size = 0;
+
+  if (option && ML_ERROR_NONE == ml_option_get (option, "checksum", &value))
+    checksum = (g_ascii_strcasecmp ((const gchar *) value, "true") == 0);
+
+  for (f = 0; f < num_frames; f++) {
+    if (!frames[f])
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The %u-th frame is NULL. It should be a valid ml_tensors_data_h handle.",
+          f);
+  }
+
+  frame_size = g_try_new0 (gsize, num_frames);
+  meta = g_try_new0 (GstTensorMetaInfo, ML_TENSOR_SIZE_LIMIT);
+  if (!frame_size || !meta) {
+    _ml_error_report
+        ("Failed to allocate the memory to serialize the tensors data. Out of memory?");
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  /* 1st pass, calculate the size of the blob. */
+  total = ML_TENSORS_BLOB_FRAME_START;
+  for (f = 0; f < num_frames; f++) {
+    _data = (ml_tensors_data_s *) frames[f];
+
+    G_LOCK_UNLESS_NOLOCK (*_data);
+    status = _ml_tensors_blob_get_frame_size (_data, meta, &frame_size[f]);
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue ("Cannot serialize the %u-th frame.", f);
+      goto done;
+    }
+
+    total += frame_size[f];
+  }
+
+  buf = g_try_malloc0 (total);
+  if (!buf) {
+    _ml_error_report
+        ("Failed to allocate the blob (%zu bytes) to serialize the tensors data. Out of memory?",
+        total);
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  /* 2nd pass, write the frames. */
+  offset = ML_TENSORS_BLOB_FRAME_START;
+  for (f = 0; f < num_frames; f++) {
+    _data = (ml_tensors_data_s *) frames[f];
+
+    G_LOCK_UNLESS_NOLOCK (*_data);
+    status = _ml_tensors_blob_get_frame_size (_data, meta, &hsize);
+    if (status != ML_ERROR_NONE || hsize != frame_size[f]) {
+      G_UNLOCK_UNLESS_NOLOCK (*_data);
+      _ml_error_report ("The %u-th frame is changed while serializing it.", f);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    status = _ml_tensors_data_map (_data, -1);
+    if (status != ML_ERROR_NONE) {
+      G_UNLOCK_UNLESS_NOLOCK (*_data);
+      goto done;
+    }
+
+    fheader.num_tensors = GUINT32_TO_LE (_data->num_tensors);
+    fheader.reserved = 0;
+    fheader.size = GUINT64_TO_LE ((guint64) frame_size[f]);
+    memcpy (buf + offset, &fheader, sizeof (fheader));
+    offset += sizeof (fheader);
+
+    for (i = 0; i < _data->num_tensors; i++) {
+      hsize = gst_tensor_meta_info_get_header_size (&meta[i]);
+      gst_tensor_meta_info_update_header (&meta[i], buf + offset);
+      offset = ML_TENSORS_BLOB_ALIGN_UP (offset + hsize);
+
+      memcpy (buf + offset, _data->tensors[i].data, _data->tensors[i].size);
+      offset = ML_TENSORS_BLOB_ALIGN_UP (offset + _data->tensors[i].size);
+    }
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+  }
+
+  header.magic = GUINT32_TO_LE (ML_TENSORS_BLOB_MAGIC);
+  header.version = GUINT16_TO_LE (ML_TENSORS_BLOB_VERSION);
+  header.flags = GUINT16_TO_LE (checksum ? ML_TENSORS_BLOB_FLAG_CHECKSUM : 0);
+  header.num_frames = GUINT32_TO_LE (num_frames);
+  header.checksum = checksum ? GUINT32_TO_LE (_crc32 (buf + sizeof (header),
+          total - sizeof (header))) : 0;
+  header.size = GUINT64_TO_LE ((guint64) total);
+  header.reserved = 0;
+  memcpy (buf, &header, sizeof (header));
+
+done:
+  g_free (frame_size);
+  g_free (meta);
+
+  if (status == ML_ERROR_NONE) {
+    *blob = buf;
+    *size = total;
+  } else {
+    g_free (buf);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to validate the header of the blob.
+ */
+static int
+_ml_tensors_blob_parse_header (const void *blob, size_t size,
+    ml_tensors_blob_header_s * header)
+{
+  if (!blob || size < sizeof (ml_tensors_blob_header_s))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, blob, is NULL or too small (%zu bytes). It should be a valid blob from ml_tensors_data_serialize().",
+        size);
+
+  memcpy (header, blob, sizeof (ml_tensors_blob_header_s));
+  header->magic = GUINT32_FROM_LE (header->magic);
+  header->version = GUINT16_FROM_LE (header->version);
+  header->flags = GUINT16_FROM_LE (header->flags);
+  header->num_frames = GUINT32_FROM_LE (header->num_frames);
+  header->checksum = GUINT32_FROM_LE (header->checksum);
+  header->size = GUINT64_FROM_LE (header->size);
+
+  if (header->magic != ML_TENSORS_BLOB_MAGIC)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, blob, is not a serialized tensors data. Invalid magic number 0x%08x.",
+        header->magic);
+
+  if (header->version == 0 || header->version > ML_TENSORS_BLOB_VERSION)
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "The version of the blob (%u) is not supported. The latest version is %u.",
+        header->version, ML_TENSORS_BLOB_VERSION);
+
+  if (header->size < ML_TENSORS_BLOB_FRAME_START ||
+      header->size > (guint64) size)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The blob is truncated. The size of the blob is %" G_GUINT64_FORMAT
+        " bytes, but %zu bytes are given.", header->size, size);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to parse a frame in the blob.
+ * @details If @a info is not NULL, the tensors information and the offset of tensor data are filled.
+ */
+static int
+_ml_tensors_blob_parse_frame (const guint8 * blob, gsize blob_size,
+    gsize offset, gsize * frame_size, GstTensorsInfo * info, gsize * data_offset)
+{
+  ml_tensors_blob_frame_s fheader;
+  GstTensorMetaInfo meta;
+  GstTensorInfo *tinfo;
+  gsize end, hsize, dsize;
+  guint i;
+
+  if (offset + sizeof (fheader) > blob_size)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The blob is truncated. The frame header at %zu exceeds the blob.",
+        offset);
+
+  memcpy (&fheader, blob + offset, sizeof (fheader));
+  fheader.num_tensors = GUINT32_FROM_LE (fheader.num_tensors);
+  fheader.size = GUINT64_FROM_LE (fheader.size);
+
+  if (fheader.num_tensors == 0 || fheader.num_tensors > ML_TENSOR_SIZE_LIMIT)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The frame at %zu has invalid number of tensors (%u).", offset,
+        fheader.num_tensors);
+
+  if (fheader.size < sizeof (fheader) ||
+      fheader.size > (guint64) (blob_size - offset))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The blob is truncated. The frame at %zu has %" G_GUINT64_FORMAT
+        " bytes.", offset, fheader.size);
+
+  *frame_size = (gsize) fheader.size;
+  if (!info)
+    return ML_ERROR_NONE;
+
+  end = offset + (gsize) fheader.size;
+  offset += sizeof (fheader);
+
+  gst_tensors_info_init (info);
+  info->num_tensors = fheader.num_tensors;
+  info->format = _NNS_TENSOR_FORMAT_STATIC;
+
+  for (i = 0; i < fheader.num_tensors; i++) {
+    /* the header size is at least the size of version 1 header. */
+    if (offset + sizeof (GstTensorMetaInfo) > end ||
+        !gst_tensor_meta_info_parse_header (&meta, (gpointer) (blob + offset)))
+      goto invalid;
+
+    hsize = gst_tensor_meta_info_get_header_size (&meta);
+    dsize = gst_tensor_meta_info_get_data_size (&meta);
+    offset = ML_TENSORS_BLOB_ALIGN_UP (offset + hsize);
+
+    if (hsize == 0 || offset > end || dsize == 0 || dsize > end - offset)
+      goto invalid;
+
+    tinfo = gst_tensors_info_get_nth_info (info, i);
+    if (!tinfo || !gst_tensor_meta_info_convert (&meta, tinfo))
+      goto invalid;
+
+    data_offset[i] = offset;
+    offset = ML_TENSORS_BLOB_ALIGN_UP (offset + dsize);
+  }
+
+  return ML_ERROR_NONE;
+
+invalid:
+  gst_tensors_info_free (info);
+  _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+      "The %u-th tensor header in the frame is invalid or truncated.", i);
+}
+
+/**
+ * @brief Validates the serialized blob and gets the number of frames. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_validate_serialized (const void *blob, size_t size,
+    unsigned int *num_frames)
+{
+  ml_tensors_blob_header_s header;
+  gsize offset, frame_size;
+  guint f;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!num_frames)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, num_frames, is NULL. It should be a valid pointer to get the number of frames.");
+
+  status = _ml_tensors_blob_parse_header (blob, size, &header);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  offset = ML_TENSORS_BLOB_FRAME_START;
+  for (f = 0; f < header.num_frames; f++) {
+    status = _ml_tensors_blob_parse_frame ((const guint8 *) blob,
+        (gsize) header.size, offset, &frame_size, NULL, NULL);
+    if (status != ML_ERROR_NONE)
+      _ml_error_report_return_continue (status,
+          "The %u-th frame in the blob is invalid.", f);
+
+    offset += frame_size;
+  }
+
+  if ((header.flags & ML_TENSORS_BLOB_FLAG_CHECKSUM) &&
+      _crc32 ((const guint8 *) blob + sizeof (header),
+          (gsize) header.size - sizeof (header)) != header.checksum)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The checksum of the blob mismatches. The blob is corrupted.");
+
+  *num_frames = header.num_frames;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Deserializes a tensor data frame from the blob. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_deserialize (const void *blob, size_t size,
+    unsigned int index, bool zero_copy, ml_data_destroy_cb destroy,
+    void *user_data, ml_tensors_data_h * data)
+{
+  ml_tensors_blob_header_s header;
+  ml_tensors_data_s *_data = NULL;
+  ml_tensors_info_h info = NULL;
+  GstTensorsInfo gst_info;
+  gsize offset, frame_size;
+  gsize *data_offset;
+  guint f, i;
+  int status;
+
+  check_feature_state (ML_FEATURE);
+
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid space to hold a ml_tensors_data_h handle.");
+
+  *data = NULL;
+
+  status = _ml_tensors_blob_parse_header (blob, size, &header);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  if (index >= header.num_frames)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index (%u), is out of range. The blob has %u frames.",
+        index, header.num_frames);
+
+  /* skip the frames before the index */
+  offset = ML_TENSORS_BLOB_FRAME_START;
+  for (f = 0; f < index; f++) {
+    status = _ml_tensors_blob_parse_frame ((const guint8 *) blob,
+        (gsize) header.size, offset, &frame_size, NULL, NULL);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    offset += frame_size;
+  }
+
+  data_offset = g_try_new0 (gsize, ML_TENSOR_SIZE_LIMIT);
+  if (!data_offset)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the memory to deserialize the tensors data. Out of memory?");
+
+  status = _ml_tensors_blob_parse_frame ((const guint8 *) blob,
+      (gsize) header.size, offset, &frame_size, &gst_info, data_offset);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = _ml_tensors_info_create_from_gst (&info, &gst_info);
+  gst_tensors_info_free (&gst_info);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  if (zero_copy) {
+    status = _ml_tensors_data_create_no_alloc (info,
+        (ml_tensors_data_h *) & _data);
+    if (status != ML_ERROR_NONE)
+      goto done;
+
+    /* The view releases the blob with the destroy callback. Writing the data makes a copy. */
+    _data->shared = _ml_tensors_data_shared_new (0, destroy, user_data);
+    if (!_data->shared) {
+      status = ML_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+
+    _data->shared->read_only = TRUE;
+    for (i = 0; i < _data->num_tensors; i++)
+      _data->tensors[i].data = (guint8 *) blob + data_offset[i];
+  } else {
+    status = ml_tensors_data_create (info, (ml_tensors_data_h *) & _data);
+    if (status != ML_ERROR_NONE)
+      goto done;
+
+    for (i = 0; i < _data->num_tensors; i++)
+      memcpy (_data->tensors[i].data, (const guint8 *) blob + data_offset[i],
+          _data->tensors[i].size);
+  }
+
+done:
+  g_free (data_offset);
+  if (info)
+    ml_tensors_info_destroy (info);
+
+  if (status == ML_ERROR_NONE) {
+    *data = _data;
+  } else {
+    if (_data)
+      _ml_tensors_data_destroy_internal (_data, FALSE);
+    _ml_error_report_return_continue (status,
+        "Failed to deserialize the %u-th frame from the blob.", index);
+  }
+
+  return ML_ERROR_NONE;
+}
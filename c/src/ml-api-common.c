@@ -37,19 +37,38 @@ typedef enum
  */
 typedef struct
 {
+  GQuark key; /**< The interned key. 0 if the key is not interned. */
+  gchar *name; /**< The key which is not interned, NULL if the key is interned. */
   void *value; /**< The data given by user. */
   ml_data_destroy_cb destroy; /**< The destroy func given by user. */
 } ml_info_value_s;
 
+/**
+ * @brief The number of values stored in ml_info without additional allocation.
+ */
+#define ML_INFO_INLINE_VALUES (8U)
+
+/**
+ * @brief The max number of keys interned by ml_info. The keys are interned for the process lifetime, other keys are copied in the value.
+ */
+#define ML_INFO_MAX_INTERNED_KEYS (256U)
+
 /**
  * @brief Data structure for ml_info.
+ * @details The values are stored in a small vector with interned keys. The inline array is used until the number of values exceeds ML_INFO_INLINE_VALUES.
  */
 typedef struct
 {
   ml_info_type_e type; /**< The type of ml_info. */
-  GHashTable *table; /**< hash table used by ml_info. */
+  guint num_values; /**< The number of values. */
+  guint max_values; /**< The capacity of values. */
+  ml_info_value_s *values; /**< The values, points to inline_values or allocated array. */
+  ml_info_value_s inline_values[ML_INFO_INLINE_VALUES]; /**< The inline storage of values. */
 } ml_info_s;
 
+G_LOCK_DEFINE_STATIC (info_key_lock);
+static guint info_num_keys = 0;
+
 /**
  * @brief Data structure for ml_info_list.
  */
@@ -241,14 +260,193 @@ ml_tensors_info_validate (const ml_tensors_info_h info, bool *valid)
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Data structure for the interned configuration of tensors information.
+ * @details The tensors information with the same configuration (the number of tensors, types and dimensions) shares an immutable instance, so that the comparison is pointer equality.
+ */
+typedef struct _ml_tensors_info_interned_s
+{
+  gint ref_count; /**< The number of tensors information referring this, protected by the lock of the shard */
+  guint hash; /**< The hash of the configuration */
+  GstTensorsInfo info; /**< The immutable copy of tensors information */
+} ml_tensors_info_interned_s;
+
+/**
+ * @brief The number of shards of the interned configurations. Each shard has its own lock, not to serialize the comparisons of different configurations.
+ */
+#define ML_TENSORS_INFO_INTERN_SHARDS (16U)
+
+/**
+ * @brief Data structure for a shard of the interned configurations.
+ */
+typedef struct
+{
+  GMutex lock; /**< Lock for the table */
+  GHashTable *table; /**< The interned configurations */
+} ml_tensors_info_intern_shard_s;
+
+static ml_tensors_info_intern_shard_s
+    intern_shards[ML_TENSORS_INFO_INTERN_SHARDS];
+
+/**
+ * @brief Internal function to get the hash of tensors information for interning.
+ * @note gst_tensors_info_is_equal() regards the dimensions as same if the remained values are 0 or 1, so the values are normalized and the trailing 1s are not hashed.
+ */
+static guint
+_ml_tensors_info_intern_hash (gconstpointer key)
+{
+  const GstTensorsInfo *info = (const GstTensorsInfo *) key;
+  GstTensorInfo *_info;
+  guint i, j, rank, d, hash;
+
+  hash = info->num_tensors;
+  for (i = 0; i < info->num_tensors; i++) {
+    _info = gst_tensors_info_get_nth_info ((GstTensorsInfo *) info, i);
+    if (!_info) {
+      hash = hash * 31U;
+      continue;
+    }
+
+    hash = hash * 31U + (guint) _info->type;
+
+    for (rank = NNS_TENSOR_RANK_LIMIT; rank > 0; rank--) {
+      if (_info->dimension[rank - 1] > 1U)
+        break;
+    }
+
+    for (j = 0; j < rank; j++) {
+      d = _info->dimension[j];
+      hash = hash * 31U + ((d > 1U) ? d : 1U);
+    }
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Internal function to compare the tensors information for interning.
+ */
+static gboolean
+_ml_tensors_info_intern_equal (gconstpointer a, gconstpointer b)
+{
+  return gst_tensors_info_is_equal ((const GstTensorsInfo *) a,
+      (const GstTensorsInfo *) b);
+}
+
+/**
+ * @brief Internal function to get the shard of the interned configurations with the hash.
+ */
+static inline ml_tensors_info_intern_shard_s *
+_ml_tensors_info_intern_shard (guint hash)
+{
+  return &intern_shards[hash % ML_TENSORS_INFO_INTERN_SHARDS];
+}
+
+/**
+ * @brief Internal function to increase the reference count of interned configuration.
+ */
+static ml_tensors_info_interned_s *
+_ml_tensors_info_interned_ref (ml_tensors_info_interned_s * interned)
+{
+  ml_tensors_info_intern_shard_s *shard;
+
+  shard = _ml_tensors_info_intern_shard (interned->hash);
+
+  g_mutex_lock (&shard->lock);
+  interned->ref_count++;
+  g_mutex_unlock (&shard->lock);
+
+  return interned;
+}
+
+/**
+ * @brief Internal function to check whether the tensors information can be interned.
+ * @details gst_tensors_info_is_equal() is not reflexive for invalid information.
+ */
+static gboolean
+_ml_tensors_info_is_internable (ml_tensors_info_s * info)
+{
+  return (info->info.format == _NNS_TENSOR_FORMAT_STATIC &&
+      gst_tensors_info_validate (&info->info));
+}
+
+/**
+ * @brief Internal function to get the interned configuration of the tensors information.
+ * @note The caller should lock the tensors information and check the information with _ml_tensors_info_is_internable().
+ */
+static ml_tensors_info_interned_s *
+_ml_tensors_info_get_interned (ml_tensors_info_s * info, guint hash)
+{
+  ml_tensors_info_intern_shard_s *shard;
+  ml_tensors_info_interned_s *interned;
+
+  if (info->interned)
+    return info->interned;
+
+  shard = _ml_tensors_info_intern_shard (hash);
+  g_mutex_lock (&shard->lock);
+
+  if (!shard->table)
+    shard->table = g_hash_table_new (_ml_tensors_info_intern_hash,
+        _ml_tensors_info_intern_equal);
+
+  interned = (ml_tensors_info_interned_s *) g_hash_table_lookup (shard->table,
+      &info->info);
+  if (interned) {
+    interned->ref_count++;
+  } else {
+    interned = g_try_new0 (ml_tensors_info_interned_s, 1);
+    if (interned) {
+      interned->ref_count = 1;
+      interned->hash = hash;
+      gst_tensors_info_init (&interned->info);
+      gst_tensors_info_copy (&interned->info, &info->info);
+      g_hash_table_insert (shard->table, &interned->info, interned);
+    }
+  }
+
+  g_mutex_unlock (&shard->lock);
+
+  info->interned = interned;
+  return interned;
+}
+
+/**
+ * @brief Releases the interned configuration of the tensors information.
+ */
+void
+_ml_tensors_info_reset_interned (ml_tensors_info_s * info)
+{
+  ml_tensors_info_intern_shard_s *shard;
+  ml_tensors_info_interned_s *interned;
+
+  if (!info || !info->interned)
+    return;
+
+  interned = info->interned;
+  info->interned = NULL;
+
+  shard = _ml_tensors_info_intern_shard (interned->hash);
+  g_mutex_lock (&shard->lock);
+  if (--interned->ref_count == 0) {
+    g_hash_table_remove (shard->table, &interned->info);
+    gst_tensors_info_free (&interned->info);
+    g_free (interned);
+  }
+  g_mutex_unlock (&shard->lock);
+}
+
 /**
  * @brief Compares the given tensors information.
+ * @details The information is interned only if the hashes are same, so the comparison of different configurations does not take the lock.
  */
 int
 _ml_tensors_info_compare (const ml_tensors_info_h info1,
     const ml_tensors_info_h info2, bool *equal)
 {
   ml_tensors_info_s *i1, *i2;
+  ml_tensors_info_interned_s *e1, *e2;
+  guint h1, h2;
 
   check_feature_state (ML_FEATURE);
 
@@ -267,7 +465,31 @@ _ml_tensors_info_compare (const ml_tensors_info_h info1,
   i2 = (ml_tensors_info_s *) info2;
   G_LOCK_UNLESS_NOLOCK (*i2);
 
-  *equal = gst_tensors_info_is_equal (&i1->info, &i2->info);
+  e1 = i1->interned;
+  e2 = i2->interned;
+
+  if (e1 && e2) {
+    /* Same configurations share the interned instance. */
+    *equal = (e1 == e2);
+  } else if (!_ml_tensors_info_is_internable (i1) ||
+      !_ml_tensors_info_is_internable (i2)) {
+    *equal = gst_tensors_info_is_equal (&i1->info, &i2->info);
+  } else {
+    h1 = e1 ? e1->hash : _ml_tensors_info_intern_hash (&i1->info);
+    h2 = e2 ? e2->hash : _ml_tensors_info_intern_hash (&i2->info);
+
+    if (h1 != h2) {
+      *equal = FALSE;
+    } else {
+      e1 = _ml_tensors_info_get_interned (i1, h1);
+      e2 = (i1 == i2) ? e1 : _ml_tensors_info_get_interned (i2, h2);
+
+      if (e1 && e2)
+        *equal = (e1 == e2);
+      else
+        *equal = gst_tensors_info_is_equal (&i1->info, &i2->info);
+    }
+  }
 
   G_UNLOCK_UNLESS_NOLOCK (*i2);
   G_UNLOCK_UNLESS_NOLOCK (*i1);
@@ -293,9 +515,14 @@ ml_tensors_info_set_count (ml_tensors_info_h info, unsigned int count)
         ML_TENSOR_SIZE_LIMIT, count);
 
   tensors_info = (ml_tensors_info_s *) info;
+  G_LOCK_UNLESS_NOLOCK (*tensors_info);
 
-  /* This is atomic. No need for locks */
-  tensors_info->info.num_tensors = count;
+  if (tensors_info->info.num_tensors != count) {
+    _ml_tensors_info_reset_interned (tensors_info);
+    tensors_info->info.num_tensors = count;
+  }
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
 
   return ML_ERROR_NONE;
 }
@@ -449,6 +676,7 @@ ml_tensors_info_set_tensor_type (ml_tensors_info_h info,
   }
 
   _info->type = convert_tensor_type_from (type);
+  _ml_tensors_info_reset_interned (tensors_info);
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
@@ -557,6 +785,8 @@ ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
     _info->dimension[i] = (tensors_info->is_extended ? dimension[i] : 0);
   }
 
+  _ml_tensors_info_reset_interned (tensors_info);
+
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
 }
@@ -670,9 +900,191 @@ _ml_tensors_info_free (ml_tensors_info_s * info)
   if (!info)
     return;
 
+  _ml_tensors_info_reset_interned (info);
   gst_tensors_info_free (&info->info);
 }
 
+/**
+ * @brief Creates a shared owner of tensor buffers with reference count 1.
+ */
+ml_tensors_data_shared_s *
+_ml_tensors_data_shared_new (unsigned int num_blocks, GDestroyNotify notify,
+    gpointer notify_data)
+{
+  ml_tensors_data_shared_s *shared;
+
+  shared = g_try_new0 (ml_tensors_data_shared_s, 1);
+  if (!shared)
+    return NULL;
+
+  if (num_blocks > 0) {
+    shared->blocks = g_try_new0 (gpointer, num_blocks);
+    if (!shared->blocks) {
+      g_free (shared);
+      return NULL;
+    }
+  }
+
+  shared->ref_count = 1;
+  shared->num_blocks = num_blocks;
+  shared->notify = notify;
+  shared->notify_data = notify_data;
+
+  return shared;
+}
+
+/**
+ * @brief Increases the reference count of shared tensor buffers.
+ */
+ml_tensors_data_shared_s *
+_ml_tensors_data_shared_ref (ml_tensors_data_shared_s * shared)
+{
+  if (shared)
+    g_atomic_int_inc (&shared->ref_count);
+
+  return shared;
+}
+
+/**
+ * @brief Decreases the reference count of shared tensor buffers and releases the buffers if the count reaches zero.
+ */
+void
+_ml_tensors_data_shared_unref (gpointer shared)
+{
+  ml_tensors_data_shared_s *_shared = (ml_tensors_data_shared_s *) shared;
+  guint i;
+
+  if (!_shared || !g_atomic_int_dec_and_test (&_shared->ref_count))
+    return;
+
+  for (i = 0; i < _shared->num_blocks; i++)
+    g_free (_shared->blocks[i]);
+
+  if (_shared->notify)
+    _shared->notify (_shared->notify_data);
+
+  if (_shared->accounted > 0)
+    _ml_memory_release (_shared->origin, _shared->accounted);
+
+  _ml_tensors_data_shared_unref (_shared->parent);
+
+  g_free (_shared->blocks);
+  g_free (_shared);
+}
+
+/**
+ * @brief Maps the buffers of tensors which are not mapped yet.
+ * @note The caller should lock the data handle.
+ */
+int
+_ml_tensors_data_map (ml_tensors_data_s * data, int index)
+{
+  guint i, start, end;
+  int status;
+
+  if (!data || !data->map)
+    return ML_ERROR_NONE;
+
+  start = (index < 0) ? 0U : (guint) index;
+  end = (index < 0) ? data->num_tensors : MIN (start + 1, data->num_tensors);
+
+  for (i = start; i < end; i++) {
+    if (data->tensors[i].data)
+      continue;
+
+    status = data->map (data, i, data->map_data);
+    if (status != ML_ERROR_NONE)
+      _ml_error_report_return_continue (status,
+          "Failed to map the buffer of %u'th tensor.", i);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to check whether the buffer of a tensor can be written without copying.
+ */
+static gboolean
+_ml_tensors_data_is_writable (ml_tensors_data_s * data, guint index)
+{
+  ml_tensors_data_shared_s *shared = data->shared;
+
+  if (!shared)
+    return TRUE;
+
+  if (shared->read_only || g_atomic_int_get (&shared->ref_count) != 1)
+    return FALSE;
+
+  /* The tensors not copied yet belong to the parent block. */
+  if (shared->parent)
+    return (index < shared->num_blocks && shared->blocks[index] != NULL);
+
+  return TRUE;
+}
+
+/**
+ * @brief Makes the buffer of a tensor writable, copying the shared or read-only buffer (copy-on-write).
+ * @note The caller should lock the data handle.
+ */
+int
+_ml_tensors_data_make_writable (ml_tensors_data_s * data, int index)
+{
+  ml_tensors_data_shared_s *shared;
+  gpointer block;
+  guint i, start, end;
+  int status;
+
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_s struct.");
+
+  status = _ml_tensors_data_map (data, index);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  start = (index < 0) ? 0U : (guint) index;
+  end = (index < 0) ? data->num_tensors : MIN (start + 1, data->num_tensors);
+
+  for (i = start; i < end; i++) {
+    if (_ml_tensors_data_is_writable (data, i))
+      continue;
+
+    shared = data->shared;
+    if (shared->read_only || g_atomic_int_get (&shared->ref_count) != 1) {
+      /**
+       * The handle moves to new block holding the copied buffers only.
+       * The reference of current block is kept as its parent, so the pointers given before are still valid.
+       */
+      shared = _ml_tensors_data_shared_new (data->num_tensors, NULL, NULL);
+      if (!shared)
+        goto failed_oom;
+
+      shared->origin = data->shared->origin;
+      shared->parent = data->shared;
+      data->shared = shared;
+    }
+
+    block = g_try_malloc (data->tensors[i].size);
+    if (!block)
+      goto failed_oom;
+
+    memcpy (block, data->tensors[i].data, data->tensors[i].size);
+
+    /* Accessing the data should not fail with the memory budget. */
+    _ml_memory_reserve (shared->origin, data->tensors[i].size, FALSE);
+    shared->accounted += data->tensors[i].size;
+
+    shared->blocks[i] = block;
+    data->tensors[i].data = block;
+  }
+
+  return ML_ERROR_NONE;
+
+failed_oom:
+  _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+      "Failed to allocate memory blocks to copy the shared tensors data. Check if it's out-of-memory.");
+}
+
 /**
  * @brief Frees the tensors data handle and its data.
  * @param[in] data The handle of tensors data.
@@ -702,7 +1114,7 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
             "Tried to destroy internal user_data of the given parameter, data, with its destroy callback; however, it has failed with %d.",
             status);
       }
-    } else {
+    } else if (!_data->shared) {
       for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
         if (_data->tensors[i].data) {
           g_free (_data->tensors[i].data);
@@ -712,6 +1124,14 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
     }
   }
 
+  _ml_tensors_data_unaccount (_data);
+
+  /* The handle always owns a reference of the shared buffers. */
+  if (_data->shared) {
+    _ml_tensors_data_shared_unref (_data->shared);
+    _data->shared = NULL;
+  }
+
   if (_data->info)
     ml_tensors_info_destroy (_data->info);
 
@@ -832,6 +1252,43 @@ _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to create new handle sharing the reference-counted buffers of given data.
+ * @note The caller should lock the data handle.
+ * @return ML_ERROR_NOT_SUPPORTED if the buffers cannot be shared.
+ */
+static int
+_ml_tensors_data_share (ml_tensors_data_s * in, ml_tensors_data_h * out)
+{
+  ml_tensors_data_s *_out;
+  int status;
+
+  /* The external buffers (e.g., pipeline buffers) are retained on demand. */
+  if (!in->shared && in->retain) {
+    status = in->retain (in, in->retain_data);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    /* The memory accounted for the handle now belongs to the retained block. */
+    if (in->shared && in->accounted > 0 && in->shared->accounted == 0) {
+      in->shared->origin = in->origin;
+      in->shared->accounted = in->accounted;
+      in->accounted = 0;
+    }
+  }
+
+  if (!in->shared || in->destroy)
+    return ML_ERROR_NOT_SUPPORTED;
+
+  status = _ml_tensors_data_clone_no_alloc (in, out);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  _out = (ml_tensors_data_s *) (*out);
+  _out->shared = _ml_tensors_data_shared_ref (in->shared);
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Copies the tensor data frame.
  */
@@ -855,23 +1312,75 @@ ml_tensors_data_clone (const ml_tensors_data_h in, ml_tensors_data_h * out)
   _in = (ml_tensors_data_s *) in;
   G_LOCK_UNLESS_NOLOCK (*_in);
 
+  /**
+   * Share the reference-counted buffers, these will be copied when writing.
+   * The application may write the buffers given by ml_tensors_data_get_tensor_data() at any time, these should be copied now.
+   */
+  if (!_in->exposed) {
+    status = _ml_tensors_data_share (_in, out);
+    if (status == ML_ERROR_NONE)
+      goto done;
+  }
+
   status = ml_tensors_data_create (_in->info, out);
   if (status != ML_ERROR_NONE) {
     _ml_loge ("Failed to create new handle to copy tensor data.");
-    goto error;
+    goto done;
   }
 
   _out = (ml_tensors_data_s *) (*out);
 
+  status = _ml_tensors_data_map (_in, -1);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_data_destroy (*out);
+    *out = NULL;
+    goto done;
+  }
+
   for (i = 0; i < _out->num_tensors; ++i) {
     memcpy (_out->tensors[i].data, _in->tensors[i].data, _in->tensors[i].size);
   }
 
-error:
+done:
   G_UNLOCK_UNLESS_NOLOCK (*_in);
   return status;
 }
 
+/**
+ * @brief Gets new handle referring the tensor buffers of given data without copying.
+ */
+int
+ml_tensors_data_ref (const ml_tensors_data_h in, ml_tensors_data_h * out)
+{
+  int status;
+  ml_tensors_data_s *_in;
+
+  check_feature_state (ML_FEATURE);
+
+  if (in == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in, is NULL. It should be a valid ml_tensors_data_h handle, which is usually given by the sink callback or created by ml_tensors_data_create ().");
+
+  if (out == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, out, is NULL. It should be a valid pointer to a space that can hold a ml_tensors_data_h handle. E.g., ml_tensors_data_h out; ml_tensors_data_ref (in, &out);.");
+
+  _in = (ml_tensors_data_s *) in;
+  G_LOCK_UNLESS_NOLOCK (*_in);
+  status = _ml_tensors_data_share (_in, out);
+  G_UNLOCK_UNLESS_NOLOCK (*_in);
+
+  if (status == ML_ERROR_NOT_SUPPORTED)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The buffers of the parameter, in, are not reference-counted, so they cannot be shared. Use ml_tensors_data_clone () to copy the data.");
+
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to create new handle referring the tensor data.");
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Gets the tensors information of given tensor data frame.
  */
@@ -915,6 +1424,7 @@ ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
 {
   gint status = ML_ERROR_STREAMS_PIPE;
   ml_tensors_data_s *_data = NULL;
+  gsize total = 0;
   guint i;
   bool valid;
 
@@ -944,11 +1454,33 @@ ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
         status);
   }
 
+  for (i = 0; i < _data->num_tensors; i++)
+    total += _data->tensors[i].size;
+
+  /* Fail early if the memory budget is exceeded. */
+  status = _ml_memory_reserve (ML_MEMORY_ORIGIN_USER, total, TRUE);
+  if (status != ML_ERROR_NONE) {
+    _ml_tensors_data_destroy_internal (_data, TRUE);
+    _ml_error_report_return_continue (status,
+        "Failed to allocate memory blocks for tensors data, the memory budget is exceeded.");
+  }
+
+  _data->shared = _ml_tensors_data_shared_new (_data->num_tensors, NULL, NULL);
+  if (_data->shared == NULL) {
+    _ml_memory_release (ML_MEMORY_ORIGIN_USER, total);
+    goto failed_oom;
+  }
+
+  _data->shared->origin = ML_MEMORY_ORIGIN_USER;
+  _data->shared->accounted = total;
+
   for (i = 0; i < _data->num_tensors; i++) {
     _data->tensors[i].data = g_malloc0 (_data->tensors[i].size);
     if (_data->tensors[i].data == NULL) {
       goto failed_oom;
     }
+
+    _data->shared->blocks[i] = _data->tensors[i].data;
   }
 
   *data = _data;
@@ -994,6 +1526,58 @@ ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
     goto report;
   }
 
+  /* The caller may update the returned memory block, copy the shared buffer of this tensor only. */
+  status = _ml_tensors_data_make_writable (_data, (int) index);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  _data->exposed = TRUE;
+  *raw_data = _data->tensors[index].data;
+  *data_size = _data->tensors[index].size;
+
+report:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  return status;
+}
+
+/**
+ * @brief Gets a read-only tensor data of given handle.
+ */
+int
+ml_tensors_data_peek_tensor_data (const ml_tensors_data_h data,
+    unsigned int index, const void **raw_data, size_t *data_size)
+{
+  ml_tensors_data_s *_data;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE);
+
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (raw_data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, raw_data, is NULL. It should be a valid, non-NULL, const void ** pointer, which is supposed to point to the raw data of tensors[index] after the call.");
+  if (data_size == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data_size, is NULL. It should be a valid, non-NULL, size_t * pointer, which is supposed to point to the size of returning raw_data after the call.");
+
+  _data = (ml_tensors_data_s *) data;
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (_data->num_tensors <= index) {
+    _ml_error_report
+        ("The parameter, index, is out of bound. The number of tensors of 'data' is %u while you requested %u'th tensor (index = %u).",
+        _data->num_tensors, index, index);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  /* The caller does not update the memory block, no copy is needed. */
+  status = _ml_tensors_data_map (_data, (int) index);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
   *raw_data = _data->tensors[index].data;
   *data_size = _data->tensors[index].size;
 
@@ -1041,8 +1625,17 @@ ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
     goto report;
   }
 
-  if (_data->tensors[index].data != raw_data)
+  status = _ml_tensors_data_map (_data, (int) index);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  if (_data->tensors[index].data != raw_data) {
+    status = _ml_tensors_data_make_writable (_data, (int) index);
+    if (status != ML_ERROR_NONE)
+      goto report;
+
     memcpy (_data->tensors[index].data, raw_data, data_size);
+  }
 
 report:
   G_UNLOCK_UNLESS_NOLOCK (*_data);
@@ -1076,6 +1669,11 @@ ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
   if (gst_tensors_info_validate (&src_info->info)) {
     dest_info->is_extended = src_info->is_extended;
     gst_tensors_info_copy (&dest_info->info, &src_info->info);
+
+    /* The clone shares the interned configuration of source. */
+    _ml_tensors_info_reset_interned (dest_info);
+    if (src_info->interned)
+      dest_info->interned = _ml_tensors_info_interned_ref (src_info->interned);
   } else {
     _ml_error_report
         ("The parameter, src, is a ml_tensors_info_h handle without valid data. Every tensor-info of tensors-info should have a valid type and dimension information and the number of tensors should be between 1 and %d.",
@@ -1312,7 +1910,7 @@ _ml_info_is_valid (gpointer handle, ml_info_type_e expected)
     {
       ml_info_s *_info = (ml_info_s *) handle;
 
-      if (!_info->table)
+      if (!_info->values)
         return false;
 
       break;
@@ -1328,19 +1926,64 @@ _ml_info_is_valid (gpointer handle, ml_info_type_e expected)
 }
 
 /**
- * @brief Internal function for destroy value of option table
+ * @brief Internal function for destroy value of ml_info
  */
 static void
-_ml_info_value_free (gpointer data)
+_ml_info_value_free (ml_info_value_s * info_value)
+{
+  if (info_value->destroy)
+    info_value->destroy (info_value->value);
+
+  info_value->value = NULL;
+  info_value->destroy = NULL;
+}
+
+/**
+ * @brief Internal function to get the interned key.
+ * @details This interns new key until the number of keys reaches ML_INFO_MAX_INTERNED_KEYS, not to grow the quark table with arbitrary keys.
+ * @return The quark of the key. 0 if the key is not interned.
+ */
+static GQuark
+_ml_info_intern_key (const char *key)
 {
-  ml_info_value_s *_value;
+  GQuark quark;
 
-  _value = (ml_info_value_s *) data;
-  if (_value) {
-    if (_value->destroy)
-      _value->destroy (_value->value);
-    g_free (_value);
+  quark = g_quark_try_string (key);
+  if (quark != 0)
+    return quark;
+
+  G_LOCK (info_key_lock);
+  if (info_num_keys < ML_INFO_MAX_INTERNED_KEYS) {
+    quark = g_quark_from_string (key);
+    info_num_keys++;
   }
+  G_UNLOCK (info_key_lock);
+
+  return quark;
+}
+
+/**
+ * @brief Internal function to find the value with given key.
+ * @note This does not register new key, the key which is never set cannot be found.
+ */
+static ml_info_value_s *
+_ml_info_find_value (ml_info_s * info, const char *key)
+{
+  GQuark quark;
+  guint i;
+
+  quark = g_quark_try_string (key);
+
+  for (i = 0; i < info->num_values; i++) {
+    if (info->values[i].key != 0) {
+      if (info->values[i].key == quark)
+        return &info->values[i];
+    } else if (g_str_equal (info->values[i].name, key)) {
+      return &info->values[i];
+    }
+  }
+
+  return NULL;
 }
 
 /**
@@ -1351,7 +1994,7 @@ _ml_info_create (ml_info_type_e type)
 {
   ml_info_s *info;
 
-  info = g_new0 (ml_info_s, 1);
+  info = g_try_new0 (ml_info_s, 1);
   if (info == NULL) {
     _ml_error_report
         ("Failed to allocate memory for the ml_info. Out of memory?");
@@ -1359,15 +2002,9 @@ _ml_info_create (ml_info_type_e type)
   }
 
   info->type = type;
-  info->table =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
-      _ml_info_value_free);
-  if (info->table == NULL) {
-    _ml_error_report
-        ("Failed to allocate memory for the table of ml_info. Out of memory?");
-    g_free (info);
-    return NULL;
-  }
+  info->num_values = 0;
+  info->max_values = ML_INFO_INLINE_VALUES;
+  info->values = info->inline_values;
 
   return info;
 }
@@ -1379,19 +2016,27 @@ static void
 _ml_info_destroy (gpointer data)
 {
   ml_info_s *info = (ml_info_s *) data;
+  guint i;
 
   if (!info)
     return;
 
   info->type = ML_INFO_TYPE_UNKNOWN;
 
-  if (info->table) {
-    g_hash_table_destroy (info->table);
-    info->table = NULL;
+  if (info->values) {
+    for (i = 0; i < info->num_values; i++) {
+      _ml_info_value_free (&info->values[i]);
+      g_free (info->values[i].name);
+    }
+
+    if (info->values != info->inline_values)
+      g_free (info->values);
+
+    info->values = NULL;
+    info->num_values = info->max_values = 0;
   }
 
   g_free (info);
-  return;
 }
 
 /**
@@ -1411,14 +2056,36 @@ _ml_info_set_value (ml_info_s * info, const char *key, void *value,
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, 'info' or 'value' is NULL. It should be a valid ml_info and value.");
 
-  info_value = g_new0 (ml_info_value_s, 1);
-  if (!info_value)
-    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
-        "Failed to allocate memory for the info value. Out of memory?");
+  info_value = _ml_info_find_value (info, key);
+  if (info_value) {
+    /* Update the value with the new one. */
+    _ml_info_value_free (info_value);
+  } else {
+    if (info->num_values == info->max_values) {
+      guint max_values = info->max_values * 2;
+      ml_info_value_s *values;
+
+      values = g_try_new (ml_info_value_s, max_values);
+      if (!values)
+        _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+            "Failed to allocate memory for the info value. Out of memory?");
+
+      memcpy (values, info->values,
+          sizeof (ml_info_value_s) * info->num_values);
+      if (info->values != info->inline_values)
+        g_free (info->values);
+
+      info->values = values;
+      info->max_values = max_values;
+    }
+
+    info_value = &info->values[info->num_values++];
+    info_value->key = _ml_info_intern_key (key);
+    info_value->name = (info_value->key == 0) ? g_strdup (key) : NULL;
+  }
 
   info_value->value = value;
   info_value->destroy = destroy;
-  g_hash_table_insert (info->table, g_strdup (key), (gpointer) info_value);
 
   return ML_ERROR_NONE;
 }
@@ -1435,7 +2102,7 @@ _ml_info_get_value (ml_info_s * info, const char *key, void **value)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, 'info', 'key' or 'value' is NULL. It should be a valid ml_info, key and value.");
 
-  info_value = g_hash_table_lookup (info->table, key);
+  info_value = _ml_info_find_value (info, key);
   if (!info_value)
     return ML_ERROR_INVALID_PARAMETER;
 
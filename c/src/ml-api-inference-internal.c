@@ -91,6 +91,7 @@ _ml_tensors_info_copy_from_gst (ml_tensors_info_h ml_info,
   _info = (ml_tensors_info_s *) ml_info;
 
   G_LOCK_UNLESS_NOLOCK (*_info);
+  _ml_tensors_info_reset_interned (_info);
   _info->is_extended = gst_info_is_extended (gst_info);
   gst_tensors_info_copy (&_info->info, gst_info);
   G_UNLOCK_UNLESS_NOLOCK (*_info);
@@ -123,3 +124,188 @@ _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
 
   return ML_ERROR_NONE;
 }
+
+/**
+ * @brief The max number of data handles cached in a thread.
+ */
+#define ML_TENSORS_DATA_CACHE_MAX (8U)
+
+/**
+ * @brief Data structure for the per-thread cache of temporary data handles.
+ */
+typedef struct
+{
+  ml_tensors_data_s *wrappers[ML_TENSORS_DATA_CACHE_MAX]; /**< The released data handles with tensors information */
+  guint num_wrappers; /**< The number of cached data handles */
+} ml_tensors_data_cache_s;
+
+/**
+ * @brief Internal function to free the per-thread cache when the thread exits.
+ */
+static void
+_ml_tensors_data_cache_free (gpointer data)
+{
+  ml_tensors_data_cache_s *cache = (ml_tensors_data_cache_s *) data;
+  guint i;
+
+  if (!cache)
+    return;
+
+  for (i = 0; i < cache->num_wrappers; i++)
+    _ml_tensors_data_destroy_internal (cache->wrappers[i], FALSE);
+
+  g_free (cache);
+}
+
+static GPrivate data_cache = G_PRIVATE_INIT (_ml_tensors_data_cache_free);
+
+/**
+ * @brief Internal function to get the cache of current thread.
+ */
+static ml_tensors_data_cache_s *
+_ml_tensors_data_cache_get (void)
+{
+  ml_tensors_data_cache_s *cache;
+
+  cache = (ml_tensors_data_cache_s *) g_private_get (&data_cache);
+  if (!cache) {
+    cache = g_try_new0 (ml_tensors_data_cache_s, 1);
+    if (cache)
+      g_private_set (&data_cache, cache);
+  }
+
+  return cache;
+}
+
+/**
+ * @brief Internal function to check the cached data handle has the same tensors information.
+ */
+static gboolean
+_ml_tensors_data_cache_match (ml_tensors_data_s * data,
+    const GstTensorsInfo * gst_info)
+{
+  ml_tensors_info_s *_info = (ml_tensors_info_s *) data->info;
+  GstTensorInfo *a, *b;
+  guint i;
+
+  if (!gst_tensors_info_is_equal (&_info->info, gst_info))
+    return FALSE;
+
+  /* The names are not compared in gst_tensors_info_is_equal(). */
+  for (i = 0; i < gst_info->num_tensors; i++) {
+    a = gst_tensors_info_get_nth_info (&_info->info, i);
+    b = gst_tensors_info_get_nth_info ((GstTensorsInfo *) gst_info, i);
+
+    if (!a || !b || g_strcmp0 (a->name, b->name) != 0)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Gets a temporary data handle without buffer for the callbacks in hot path.
+ */
+int
+_ml_tensors_data_acquire_temp (const GstTensorsInfo * gst_info,
+    ml_tensors_data_h * data)
+{
+  ml_tensors_data_cache_s *cache;
+  ml_tensors_data_s *_data = NULL;
+  ml_tensors_info_s *_info;
+  gint i, found = -1;
+  int status;
+
+  if (!gst_info || !data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, gst_info or data, is NULL. This is probably an internal bug of ML API.");
+
+  *data = NULL;
+
+  cache = _ml_tensors_data_cache_get ();
+  if (cache && cache->num_wrappers > 0) {
+    /* Prefer the handle with the same information to skip copying it. */
+    for (i = (gint) cache->num_wrappers - 1; i >= 0; i--) {
+      if (_ml_tensors_data_cache_match (cache->wrappers[i], gst_info)) {
+        found = i;
+        break;
+      }
+    }
+
+    if (found >= 0) {
+      _data = cache->wrappers[found];
+    } else {
+      found = (gint) cache->num_wrappers - 1;
+      _data = cache->wrappers[found];
+
+      _info = (ml_tensors_info_s *) _data->info;
+      G_LOCK_UNLESS_NOLOCK (*_info);
+      _ml_tensors_info_free (_info);
+      _info->is_extended = gst_info_is_extended (gst_info);
+      gst_tensors_info_copy (&_info->info, gst_info);
+      G_UNLOCK_UNLESS_NOLOCK (*_info);
+    }
+
+    cache->wrappers[found] = cache->wrappers[--cache->num_wrappers];
+  } else {
+    status = _ml_tensors_data_create_no_alloc (NULL,
+        (ml_tensors_data_h *) & _data);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    status = _ml_tensors_info_create_from_gst (&_data->info,
+        (GstTensorsInfo *) gst_info);
+    if (status != ML_ERROR_NONE) {
+      _ml_tensors_data_destroy_internal (_data, FALSE);
+      return status;
+    }
+  }
+
+  _data->num_tensors = gst_info->num_tensors;
+  for (i = 0; i < (gint) ML_TENSOR_SIZE_LIMIT; i++) {
+    _data->tensors[i].data = NULL;
+    _data->tensors[i].size = ((guint) i < _data->num_tensors) ?
+        gst_tensors_info_get_size (gst_info, i) : 0;
+  }
+
+  *data = _data;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Releases the temporary data handle from _ml_tensors_data_acquire_temp().
+ */
+void
+_ml_tensors_data_release_temp (ml_tensors_data_h data)
+{
+  ml_tensors_data_cache_s *cache;
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+
+  if (!_data)
+    return;
+
+  _ml_tensors_data_unaccount (_data);
+
+  if (_data->shared) {
+    _ml_tensors_data_shared_unref (_data->shared);
+    _data->shared = NULL;
+  }
+
+  _data->destroy = NULL;
+  _data->user_data = NULL;
+  _data->retain = NULL;
+  _data->retain_data = NULL;
+  _data->map = NULL;
+  _data->map_data = NULL;
+
+  /* The flag is set for the frame, the next frame in this thread is not given to the application yet. */
+  _data->exposed = FALSE;
+
+  cache = _ml_tensors_data_cache_get ();
+  if (cache && _data->info && cache->num_wrappers < ML_TENSORS_DATA_CACHE_MAX) {
+    cache->wrappers[cache->num_wrappers++] = _data;
+    return;
+  }
+
+  _ml_tensors_data_destroy_internal (_data, FALSE);
+}
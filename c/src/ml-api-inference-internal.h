@@ -43,6 +43,21 @@ int _ml_tensors_info_copy_from_gst (ml_tensors_info_h ml_info, const GstTensorsI
  */
 int _ml_tensors_info_copy_from_ml (GstTensorsInfo *gst_info, const ml_tensors_info_h ml_info);
 
+/**
+ * @brief Gets a temporary data handle without buffer, for the callbacks called in every frame.
+ * @details The data handle and its tensors information are reused from the cache of current thread, so that the steady-state processing does not allocate memory.
+ *          The caller should set the tensor buffers and release the handle with _ml_tensors_data_release_temp() in the same thread. The buffers are not freed.
+ * @param[in] gst_info The tensors information of the data.
+ * @param[out] data The handle of tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_data_acquire_temp (const GstTensorsInfo *gst_info, ml_tensors_data_h *data);
+
+/**
+ * @brief Releases the temporary data handle to the cache of current thread.
+ */
+void _ml_tensors_data_release_temp (ml_tensors_data_h data);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -72,6 +72,7 @@ typedef struct {
   ml_tensors_info_h out_info;
   ml_custom_easy_invoke_cb cb;
   void *pdata;
+  gboolean thread_safe; /**< The callback is invoked without the lock */
 } ml_custom_filter_s;
 
 /**
@@ -116,6 +117,16 @@ typedef struct {
   gpointer handle; /**< pointer to resource handle */
 } pipeline_resource_s;
 
+/**
+ * @brief Internal data structure for the statistics of pipeline elements.
+ */
+typedef struct _ml_pipeline_stats_s ml_pipeline_stats_s;
+
+/**
+ * @brief Data structure for the parallel replicas of tensor_filter.
+ */
+typedef struct _ml_pipeline_parallel_s ml_pipeline_parallel_s;
+
 /**
  * @brief Internal private representation of pipeline handle.
  * @details This should not be exposed to applications
@@ -127,10 +138,14 @@ typedef struct _ml_pipeline {
   GMutex lock;                    /**< Lock for pipeline operations */
   gboolean isEOS;                 /**< The pipeline is EOS state */
   ml_pipeline_state_e pipe_state; /**< The state of pipeline */
+  GMutex state_lock;              /**< Lock for the state of pipeline */
+  GCond state_cond;               /**< Notified when the state of pipeline is changed */
   GHashTable *namednodes;         /**< hash table of "element"s. */
   GHashTable *resources;          /**< hash table of resources to construct the pipeline */
   GHashTable *pipe_elm_type;      /**< hash table for type of pipeline element */
   pipeline_state_cb_s state_cb;   /**< Callback to notify the change of pipeline state */
+  ml_pipeline_stats_s *stats;     /**< The statistics of elements. NULL if disabled */
+  ml_pipeline_parallel_s *parallel; /**< The parallel replicas of tensor_filter. NULL if not replicated */
 } ml_pipeline;
 
 /**
@@ -155,8 +170,53 @@ typedef struct _ml_pipeline_element {
 
   ml_handle_destroy_cb custom_destroy;
   gpointer custom_data;
+
+  GstBufferPool *pool; /**< The buffer pool for the input frames of appsrc. NULL if not used. */
+  GstTensorsInfo pool_info; /**< The tensors information of the buffer pool */
+
+  GMutex flow_lock; /**< Lock for the flow control of appsrc */
+  GCond flow_cond; /**< Notified when appsrc pushes a buffer downstream */
+  gulong flow_probe; /**< The pad probe of appsrc for the flow control. 0 if not set. */
+  guint flow_timeout; /**< The time (ms) to wait for the room of appsrc when pushing data. 0 not to block. */
+  guint flow_waiters; /**< The number of threads waiting for the room of appsrc without the lock of pipeline, protected by flow_lock */
+  gboolean flow_closing; /**< TRUE if the pipeline is being destroyed, the waiting threads should return. Protected by flow_lock */
+
+  GAsyncQueue *pull_queue; /**< The buffers of tensor_sink to be pulled. NULL if not used. */
+  gulong pull_id; /**< The signal handler of tensor_sink queuing the buffers to be pulled */
+
+  gulong caps_probe; /**< The pad probe counting the caps events of src or sink pad. 0 if not set. */
+  gint caps_version; /**< Increased when the pad receives new caps (atomic) */
+  gint caps_parsed; /**< The caps version of tensors_info. -1 if not parsed. */
 } ml_pipeline_element;
 
+/**
+ * @brief Enumeration for the overflow policy of asynchronous sink queue.
+ */
+typedef enum {
+  ML_PIPELINE_SINK_OVERFLOW_BLOCK = 0, /**< Block the streaming thread until the queue has a room */
+  ML_PIPELINE_SINK_OVERFLOW_DROP_OLDEST, /**< Drop the oldest data in the queue */
+  ML_PIPELINE_SINK_OVERFLOW_DROP_NEWEST, /**< Drop the new data */
+} ml_pipeline_sink_overflow_e;
+
+/**
+ * @brief Internal private representation of asynchronous delivery for a sink callback.
+ * @details The streaming thread queues the data holding the mapped buffer, and the worker thread calls the sink callback.
+ */
+typedef struct {
+  GThread *thread; /**< The worker thread calling the sink callback */
+  gint ref_count; /**< The reference count, the streaming thread holds a reference while pushing the data */
+  GMutex lock; /**< Lock for the queue */
+  GCond cond; /**< Condition to notify the change of the queue */
+  GQueue queue; /**< The queue of ml_tensors_data_h to be delivered */
+  guint max_size; /**< The max number of data in the queue */
+  ml_pipeline_sink_overflow_e overflow; /**< The policy when the queue is full */
+  gboolean running; /**< FALSE if the worker thread should exit */
+  gboolean detached; /**< TRUE if the sink is released in the sink callback, the worker thread releases the sink */
+  guint64 dropped; /**< The number of dropped data */
+  ml_pipeline_sink_cb cb; /**< The sink callback */
+  void *pdata; /**< The user data of the sink callback */
+} ml_pipeline_sink_dispatch_s;
+
 /**
  * @brief Internal private representation sink callback function for GstTensorSink and GstAppSink
  * @details This represents a single instance of callback registration. This should not be exposed to applications.
@@ -166,6 +226,7 @@ typedef struct {
   void *sink_pdata;
   ml_pipeline_src_callbacks_s src_cb;
   void *src_pdata;
+  ml_pipeline_sink_dispatch_s *dispatch; /**< Asynchronous delivery of sink data. NULL if the callback is called in the streaming thread. */
 } callback_info_s;
 
 /**
@@ -210,6 +271,42 @@ GstElement* _ml_pipeline_get_gst_pipeline (ml_pipeline_h pipe);
  */
 GstElement* _ml_pipeline_get_gst_element (ml_pipeline_element_h handle);
 
+/**
+ * @brief Clears the state of elements set by the application, such as the flow control of src and the queue of sink.
+ * @note The caller should lock the pipeline. The pipeline should not have the handles of elements.
+ */
+void _ml_pipeline_reset_elements (ml_pipeline * p);
+
+/**
+ * @brief Starts measuring the statistics of the elements in the pipeline.
+ * @note The caller should lock the pipeline.
+ */
+int _ml_pipeline_stats_start (ml_pipeline * p);
+
+/**
+ * @brief Removes the probes and releases the statistics of the pipeline.
+ */
+void _ml_pipeline_stats_free (ml_pipeline_stats_s * pstats);
+
+/**
+ * @brief Replicates the tensor_filter in the pipeline with the option.
+ * @details The tensor_filter is replaced with the replicas between the splitter and merger, the output is reordered in the order of input.
+ * @note This should be called before iterating the elements of the pipeline. If the option does not have the key 'parallel_filter', @a parallel is NULL.
+ */
+int _ml_pipeline_parallel_new (GstElement * pipeline, const ml_option_h option, ml_pipeline_parallel_s ** parallel);
+
+/**
+ * @brief Removes the probes and releases the parallel replicas.
+ * @note The pipeline should not be running.
+ */
+void _ml_pipeline_parallel_free (ml_pipeline_parallel_s * parallel);
+
+/**
+ * @brief Gets the number of replicas and the throughput gain (percentage of a single tensor_filter) of the replicated tensor_filter.
+ * @return TRUE if the element with @a name is replicated.
+ */
+gboolean _ml_pipeline_parallel_get_stats (ml_pipeline_parallel_s * parallel, const gchar * name, guint * num_replicas, guint64 * gain);
+
 #if defined (__TIZEN__)
 /****** TIZEN PRIVILEGE CHECK BEGINS ******/
 /**
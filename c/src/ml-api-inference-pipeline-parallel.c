@@ -0,0 +1,823 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-inference-pipeline-parallel.c
+ * @date 18 October 2026
+ * @brief ML C-API, parallel replicas of tensor_filter in NNStreamer pipeline.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#if defined (__linux__)
+#include <sched.h>
+#endif
+#include <string.h>
+#include <glib.h>
+#include <gst/gst.h>
+
+#include "nnstreamer.h"
+#include "nnstreamer-tizen-internal.h"
+#include "ml-api-internal.h"
+#include "ml-api-inference-pipeline-internal.h"
+
+/**
+ * @brief The max number of replicas of tensor_filter.
+ */
+#define ML_PIPELINE_PARALLEL_MAX_REPLICAS (64U)
+
+/**
+ * @brief Data structure for a replica of tensor_filter.
+ * @details The replica receives the inputs of which sequence number is (index + N * num_replicas) in order.
+ */
+typedef struct
+{
+  ml_pipeline_parallel_s *parallel; /**< The parallel replicas */
+  guint index; /**< The index of the replica */
+  GstPad *split_pad; /**< The src pad of splitter linked to the replica */
+  gint cpu; /**< The CPU to run the replica, -1 if not set */
+  GThread *pinned; /**< The streaming thread of which affinity is set */
+#if defined (__linux__)
+  cpu_set_t saved; /**< The affinity of streaming thread before pinning it */
+#endif
+  GCond cond; /**< Notified when the output of this replica may be pushed */
+  guint64 received; /**< The number of inputs received by the filter */
+  guint64 current; /**< The sequence number of the input being processed */
+  gboolean done; /**< The output of current input is pushed */
+  gboolean eos; /**< The filter received EOS */
+  gint64 started; /**< The time (us) when the filter received current input */
+} ml_pipeline_replica_s;
+
+/**
+ * @brief Data structure for a pad probe installed for the replicas.
+ */
+typedef struct
+{
+  GstPad *pad; /**< The pad with the probe */
+  gulong id; /**< The probe id */
+} ml_pipeline_parallel_probe_s;
+
+/**
+ * @brief Data structure for the parallel replicas of tensor_filter.
+ */
+struct _ml_pipeline_parallel_s
+{
+  gchar *name; /**< The name of the replicated tensor_filter */
+  GstElement *splitter; /**< The output-selector distributing the inputs in round-robin */
+  GstElement *merger; /**< The funnel merging the outputs of replicas */
+  GArray *probes; /**< The list of ml_pipeline_parallel_probe_s */
+  GstBus *bus; /**< The bus of pipeline, to get the state of merger */
+  gulong signal_msg; /**< The handler id of sync message */
+  GMutex lock; /**< Lock for the values below */
+  guint num_replicas; /**< The number of replicas */
+  ml_pipeline_replica_s *replicas; /**< The replicas */
+  guint64 next_in; /**< The sequence number of next input */
+  guint64 next_out; /**< The sequence number of next output */
+  gboolean granted; /**< The output of next_out is being pushed */
+  gboolean flushing; /**< The splitter is flushing */
+  gint64 first_in; /**< The time (us) when the first input arrived, 0 if no input */
+  gint64 last_out; /**< The time (us) when the last output was pushed */
+  gint64 busy; /**< The sum of processing time (us) of replicas */
+};
+
+/**
+ * @brief Internal function to add a pad probe for the replicas.
+ */
+static gboolean
+_ml_pipeline_parallel_add_probe (ml_pipeline_parallel_s * parallel,
+    GstPad * pad, GstPadProbeType mask, GstPadProbeCallback callback,
+    gpointer user_data)
+{
+  ml_pipeline_parallel_probe_s probe;
+
+  probe.id = gst_pad_add_probe (pad, mask, callback, user_data, NULL);
+  if (probe.id == 0)
+    return FALSE;
+
+  probe.pad = gst_object_ref (pad);
+  g_array_append_val (parallel->probes, probe);
+  return TRUE;
+}
+
+#if defined (__linux__)
+/**
+ * @brief Internal function to restore the CPU affinity when the streaming thread leaves the task.
+ */
+static void
+_ml_pipeline_parallel_leave_task (GstTask * task, GThread * thread,
+    gpointer user_data)
+{
+  ml_pipeline_replica_s *replica = (ml_pipeline_replica_s *) user_data;
+
+  if (replica->pinned != thread)
+    return;
+
+  replica->pinned = NULL;
+
+  if (sched_setaffinity (0, sizeof (cpu_set_t), &replica->saved) != 0) {
+    _ml_logw ("Failed to restore the affinity of the thread running replica %u.",
+        replica->index);
+  }
+}
+#endif
+
+/**
+ * @brief Internal function to set the CPU affinity of the streaming thread.
+ * @details The streaming thread is the task of queue linked to the replica. The thread is pinned while the task is running, and the affinity is restored when the thread leaves the task and returns to the thread pool.
+ */
+static void
+_ml_pipeline_parallel_set_affinity (ml_pipeline_replica_s * replica,
+    GstPad * pad)
+{
+#if defined (__linux__)
+  GThread *self = g_thread_self ();
+  GstTask *task = NULL;
+  GstPad *peer;
+  cpu_set_t set;
+
+  if (replica->cpu < 0 || replica->pinned == self)
+    return;
+
+  peer = gst_pad_get_peer (pad);
+  if (peer) {
+    GST_OBJECT_LOCK (peer);
+    task = GST_PAD_TASK (peer);
+    if (task)
+      gst_object_ref (task);
+    GST_OBJECT_UNLOCK (peer);
+    gst_object_unref (peer);
+  }
+
+  /* Do not pin the thread which cannot be restored. */
+  if (!task)
+    return;
+
+  if (sched_getaffinity (0, sizeof (cpu_set_t), &replica->saved) != 0) {
+    _ml_logw ("Failed to get the affinity of the thread running replica %u.",
+        replica->index);
+    goto done;
+  }
+
+  CPU_ZERO (&set);
+  CPU_SET (replica->cpu, &set);
+
+  if (sched_setaffinity (0, sizeof (cpu_set_t), &set) != 0) {
+    _ml_logw ("Failed to set the affinity of replica %u to CPU %d.",
+        replica->index, replica->cpu);
+    goto done;
+  }
+
+  replica->pinned = self;
+  gst_task_set_leave_callback (task, _ml_pipeline_parallel_leave_task,
+      replica, NULL);
+
+done:
+  gst_object_unref (task);
+#endif
+}
+
+/**
+ * @brief Internal function to check the input of given sequence number is finished without output.
+ * @note The caller should hold the lock.
+ */
+static gboolean
+_ml_pipeline_parallel_is_skipped (ml_pipeline_parallel_s * parallel,
+    guint64 seq)
+{
+  ml_pipeline_replica_s *replica;
+  guint64 nth = seq / parallel->num_replicas;
+
+  replica = &parallel->replicas[seq % parallel->num_replicas];
+
+  /* The replica has moved to next input, or it will not receive the input anymore. */
+  return (replica->received > nth + 1 || replica->eos);
+}
+
+/**
+ * @brief Internal function to skip the inputs finished without output, and notify the replica of next output.
+ * @note The caller should hold the lock.
+ */
+static void
+_ml_pipeline_parallel_advance (ml_pipeline_parallel_s * parallel)
+{
+  while (!parallel->granted && parallel->next_out < parallel->next_in &&
+      _ml_pipeline_parallel_is_skipped (parallel, parallel->next_out))
+    parallel->next_out++;
+
+  g_cond_signal (&parallel->replicas[parallel->next_out %
+          parallel->num_replicas].cond);
+}
+
+/**
+ * @brief Internal function to set the flushing state and wake up the replicas waiting for the order of output.
+ * @note The caller should hold the lock.
+ */
+static void
+_ml_pipeline_parallel_set_flushing (ml_pipeline_parallel_s * parallel,
+    gboolean flushing)
+{
+  guint i;
+
+  parallel->flushing = flushing;
+
+  for (i = 0; i < parallel->num_replicas; i++) {
+    if (!flushing) {
+      parallel->replicas[i].received = 0;
+      parallel->replicas[i].done = TRUE;
+      parallel->replicas[i].eos = FALSE;
+    }
+
+    g_cond_signal (&parallel->replicas[i].cond);
+  }
+
+  if (!flushing) {
+    parallel->next_in = parallel->next_out = 0;
+    parallel->granted = FALSE;
+  }
+}
+
+/**
+ * @brief Internal function to push the buffers in the list one by one, to select the replica for each buffer.
+ */
+static GstPadProbeReturn
+_ml_pipeline_parallel_split_list (GstPad * pad, GstPadProbeInfo * info)
+{
+  GstBufferList *list = GST_PAD_PROBE_INFO_BUFFER_LIST (info);
+  GstFlowReturn flow = GST_FLOW_OK;
+  guint i, length;
+
+  length = gst_buffer_list_length (list);
+  for (i = 0; i < length && flow == GST_FLOW_OK; i++)
+    flow = gst_pad_chain (pad, gst_buffer_ref (gst_buffer_list_get (list, i)));
+
+  /* The probe handled the list, release it and return the flow of buffers. */
+  gst_buffer_list_unref (list);
+  GST_PAD_PROBE_INFO_FLOW_RETURN (info) = flow;
+  return GST_PAD_PROBE_HANDLED;
+}
+
+/**
+ * @brief Pad probe on the sink pad of splitter, selecting the replica for each input.
+ */
+static GstPadProbeReturn
+_ml_pipeline_parallel_split_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_parallel_s *parallel = (ml_pipeline_parallel_s *) user_data;
+  ml_pipeline_replica_s *replica;
+
+  if (info->type & GST_PAD_PROBE_TYPE_EVENT_FLUSH) {
+    GstEvent *event = GST_PAD_PROBE_INFO_EVENT (info);
+
+    g_mutex_lock (&parallel->lock);
+    if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_START)
+      _ml_pipeline_parallel_set_flushing (parallel, TRUE);
+    else if (GST_EVENT_TYPE (event) == GST_EVENT_FLUSH_STOP)
+      _ml_pipeline_parallel_set_flushing (parallel, FALSE);
+    g_mutex_unlock (&parallel->lock);
+
+    return GST_PAD_PROBE_OK;
+  }
+
+  if (info->type & GST_PAD_PROBE_TYPE_BUFFER_LIST)
+    return _ml_pipeline_parallel_split_list (pad, info);
+
+  g_mutex_lock (&parallel->lock);
+  replica =
+      &parallel->replicas[parallel->next_in % parallel->num_replicas];
+  parallel->next_in++;
+
+  if (parallel->first_in == 0)
+    parallel->first_in = g_get_monotonic_time ();
+  g_mutex_unlock (&parallel->lock);
+
+  /* The output-selector switches the pad before pushing the buffer. */
+  g_object_set (parallel->splitter, "active-pad", replica->split_pad, NULL);
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Pad probe on the sink pad of replica, updating the input being processed.
+ */
+static GstPadProbeReturn
+_ml_pipeline_parallel_input_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_replica_s *replica = (ml_pipeline_replica_s *) user_data;
+  ml_pipeline_parallel_s *parallel = replica->parallel;
+
+  if (info->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM) {
+    if (GST_EVENT_TYPE (GST_PAD_PROBE_INFO_EVENT (info)) == GST_EVENT_EOS) {
+      g_mutex_lock (&parallel->lock);
+      replica->eos = TRUE;
+      _ml_pipeline_parallel_advance (parallel);
+      g_mutex_unlock (&parallel->lock);
+    }
+
+    return GST_PAD_PROBE_OK;
+  }
+
+  _ml_pipeline_parallel_set_affinity (replica, pad);
+
+  g_mutex_lock (&parallel->lock);
+  replica->current =
+      replica->received * parallel->num_replicas + replica->index;
+  replica->received++;
+  replica->done = FALSE;
+  replica->started = g_get_monotonic_time ();
+
+  /* The previous input may be dropped in the filter. */
+  _ml_pipeline_parallel_advance (parallel);
+  g_mutex_unlock (&parallel->lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Pad probe on the src pad of replica, waiting until the previous outputs are pushed.
+ */
+static GstPadProbeReturn
+_ml_pipeline_parallel_output_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_replica_s *replica = (ml_pipeline_replica_s *) user_data;
+  ml_pipeline_parallel_s *parallel = replica->parallel;
+  GstPadProbeReturn ret = GST_PAD_PROBE_OK;
+  guint64 seq;
+
+  g_mutex_lock (&parallel->lock);
+  seq = replica->current;
+
+  if (!replica->done) {
+    replica->done = TRUE;
+    parallel->busy += g_get_monotonic_time () - replica->started;
+  }
+
+  /* Wait until the previous outputs are pushed or skipped, the replica is notified when next_out reaches its sequence number. */
+  _ml_pipeline_parallel_advance (parallel);
+
+  while (seq > parallel->next_out) {
+    if (parallel->flushing || GST_PAD_IS_FLUSHING (pad)) {
+      ret = GST_PAD_PROBE_DROP;
+      break;
+    }
+
+    g_cond_wait (&replica->cond, &parallel->lock);
+  }
+
+  /* The merger advances the order after pushing the output. */
+  if (ret == GST_PAD_PROBE_OK && seq == parallel->next_out)
+    parallel->granted = TRUE;
+
+  g_mutex_unlock (&parallel->lock);
+  return ret;
+}
+
+/**
+ * @brief Pad probe on the src pad of merger, advancing the order of output.
+ * @details The merger (funnel) pushes the buffers with the stream lock of src pad, the output of next replica waits until the push is done.
+ */
+static GstPadProbeReturn
+_ml_pipeline_parallel_merge_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_parallel_s *parallel = (ml_pipeline_parallel_s *) user_data;
+
+  g_mutex_lock (&parallel->lock);
+  if (parallel->granted) {
+    parallel->granted = FALSE;
+    parallel->next_out++;
+    _ml_pipeline_parallel_advance (parallel);
+  }
+  parallel->last_out = g_get_monotonic_time ();
+  g_mutex_unlock (&parallel->lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Sync message handler, updating the flushing state with the state of merger.
+ * @details The merger changes the state before the replicas. The outputs waiting for the order should be released before the replicas deactivate the pads.
+ */
+static void
+_ml_pipeline_parallel_sync_message (GstBus * bus, GstMessage * message,
+    gpointer user_data)
+{
+  ml_pipeline_parallel_s *parallel = (ml_pipeline_parallel_s *) user_data;
+  GstState old_state, new_state;
+
+  if (GST_MESSAGE_SRC (message) != GST_OBJECT_CAST (parallel->merger))
+    return;
+
+  gst_message_parse_state_changed (message, &old_state, &new_state, NULL);
+
+  g_mutex_lock (&parallel->lock);
+  if (old_state == GST_STATE_PAUSED && new_state == GST_STATE_READY)
+    _ml_pipeline_parallel_set_flushing (parallel, TRUE);
+  else if (old_state == GST_STATE_READY && new_state == GST_STATE_PAUSED)
+    _ml_pipeline_parallel_set_flushing (parallel, FALSE);
+  g_mutex_unlock (&parallel->lock);
+}
+
+/**
+ * @brief Internal function to copy the properties of tensor_filter to the replica.
+ */
+static void
+_ml_pipeline_parallel_copy_properties (GstElement * src, GstElement * dest)
+{
+  GParamSpec **specs;
+  GValue value = G_VALUE_INIT;
+  guint i, num = 0;
+
+  specs = g_object_class_list_properties (G_OBJECT_GET_CLASS (src), &num);
+
+  for (i = 0; i < num; i++) {
+    GParamSpec *spec = specs[i];
+
+    if ((spec->flags & G_PARAM_READWRITE) != G_PARAM_READWRITE ||
+        (spec->flags & G_PARAM_CONSTRUCT_ONLY) ||
+        g_str_equal (spec->name, "name") || g_str_equal (spec->name, "parent"))
+      continue;
+
+    g_value_init (&value, spec->value_type);
+    g_object_get_property (G_OBJECT (src), spec->name, &value);
+
+    if (!g_param_value_defaults (spec, &value))
+      g_object_set_property (G_OBJECT (dest), spec->name, &value);
+
+    g_value_unset (&value);
+  }
+
+  g_free (specs);
+}
+
+/**
+ * @brief Internal function to parse the options of parallel replicas.
+ */
+static int
+_ml_pipeline_parallel_parse_option (const ml_option_h option,
+    const gchar ** name, guint * num_replicas, gint ** cpus)
+{
+  guint64 value64;
+  void *value;
+  gchar **tokens;
+  guint i, num;
+
+  *name = NULL;
+  *num_replicas = MIN (g_get_num_processors (),
+      ML_PIPELINE_PARALLEL_MAX_REPLICAS);
+  *cpus = NULL;
+
+  if (!option || ML_ERROR_NONE != ml_option_get (option, "parallel_filter",
+          &value)) {
+    if (option && (ML_ERROR_NONE == ml_option_get (option,
+                "parallel_replicas", &value) ||
+            ML_ERROR_NONE == ml_option_get (option, "parallel_affinity",
+                &value)))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'parallel_filter' is not set. It should be the name of tensor_filter to be replicated.");
+
+    return ML_ERROR_NONE;
+  }
+
+  *name = (const gchar *) value;
+
+  if (ML_ERROR_NONE == ml_option_get (option, "parallel_replicas", &value)) {
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 1,
+            ML_PIPELINE_PARALLEL_MAX_REPLICAS, &value64, NULL))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'parallel_replicas' (%s) is invalid. It should be an integer between 1 and %u.",
+          (const gchar *) value, ML_PIPELINE_PARALLEL_MAX_REPLICAS);
+
+    *num_replicas = (guint) value64;
+  }
+
+  if (ML_ERROR_NONE == ml_option_get (option, "parallel_affinity", &value)) {
+#if defined (__linux__)
+    tokens = g_strsplit ((const gchar *) value, ",", -1);
+    num = g_strv_length (tokens);
+
+    if (num != *num_replicas) {
+      g_strfreev (tokens);
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'parallel_affinity' (%s) is invalid. It should have the CPUs for %u replicas.",
+          (const gchar *) value, *num_replicas);
+    }
+
+    *cpus = g_new0 (gint, num);
+    for (i = 0; i < num; i++) {
+      if (!g_ascii_string_to_unsigned (g_strstrip (tokens[i]), 10, 0,
+              CPU_SETSIZE - 1, &value64, NULL)) {
+        g_strfreev (tokens);
+        g_free (*cpus);
+        *cpus = NULL;
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The option 'parallel_affinity' (%s) is invalid. It should be the comma-separated list of CPU numbers.",
+            (const gchar *) value);
+      }
+
+      (*cpus)[i] = (gint) value64;
+    }
+
+    g_strfreev (tokens);
+#else
+    (void) tokens;
+    (void) i;
+    (void) num;
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "The option 'parallel_affinity' is not supported in this platform.");
+#endif
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to link a replica between the splitter and the merger.
+ */
+static int
+_ml_pipeline_parallel_add_replica (ml_pipeline_parallel_s * parallel,
+    GstBin * bin, GstElement * origin, GstElement * merger, guint index)
+{
+  ml_pipeline_replica_s *replica = &parallel->replicas[index];
+  GstElement *queue, *filter = origin;
+  GstPad *pad;
+  gchar *name;
+  gboolean linked;
+
+  name = g_strdup_printf ("%s_queue_%u", parallel->name, index);
+  queue = gst_element_factory_make ("queue", name);
+  g_free (name);
+
+  if (index > 0) {
+    name = g_strdup_printf ("%s_replica_%u", parallel->name, index);
+    filter = gst_element_factory_make ("tensor_filter", name);
+    g_free (name);
+
+    if (filter)
+      _ml_pipeline_parallel_copy_properties (origin, filter);
+  }
+
+  if (!queue || !filter) {
+    if (queue)
+      gst_object_unref (queue);
+    if (filter && index > 0)
+      gst_object_unref (filter);
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to create the elements for replica %u of '%s'.", index,
+        parallel->name);
+  }
+
+  gst_bin_add (bin, queue);
+  if (index > 0)
+    gst_bin_add (bin, filter);
+
+  linked = gst_element_link_pads (parallel->splitter, NULL, queue, "sink") &&
+      gst_element_link_pads (queue, "src", filter, "sink") &&
+      gst_element_link_pads (filter, "src", merger, NULL);
+  if (!linked)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to link the elements for replica %u of '%s'.", index,
+        parallel->name);
+
+  pad = gst_element_get_static_pad (queue, "sink");
+  replica->split_pad = gst_pad_get_peer (pad);
+  gst_object_unref (pad);
+
+  pad = gst_element_get_static_pad (filter, "sink");
+  linked = _ml_pipeline_parallel_add_probe (parallel, pad,
+      GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+      _ml_pipeline_parallel_input_probe, replica);
+  gst_object_unref (pad);
+
+  pad = gst_element_get_static_pad (filter, "src");
+  linked = linked && _ml_pipeline_parallel_add_probe (parallel, pad,
+      GST_PAD_PROBE_TYPE_BUFFER, _ml_pipeline_parallel_output_probe, replica);
+  gst_object_unref (pad);
+
+  if (!linked || !replica->split_pad)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to prepare the replica %u of '%s'.", index, parallel->name);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Replicates the tensor_filter in the pipeline with the option.
+ */
+int
+_ml_pipeline_parallel_new (GstElement * pipeline, const ml_option_h option,
+    ml_pipeline_parallel_s ** parallel)
+{
+  ml_pipeline_parallel_s *_parallel = NULL;
+  const gchar *name;
+  guint num_replicas, i;
+  gint *cpus = NULL;
+  GstElement *filter = NULL, *merger;
+  GstElementFactory *factory;
+  GstPad *sink = NULL, *src = NULL, *upstream = NULL, *downstream = NULL;
+  GstPad *pad;
+  GstBin *bin;
+  gchar *elem_name;
+  int status;
+
+  *parallel = NULL;
+
+  status = _ml_pipeline_parallel_parse_option (option, &name, &num_replicas,
+      &cpus);
+  if (status != ML_ERROR_NONE || !name)
+    return status;
+
+  if (num_replicas < 2 && !cpus) {
+    _ml_logi ("The tensor_filter '%s' is not replicated, the number of replicas is 1.",
+        name);
+    return ML_ERROR_NONE;
+  }
+
+  filter = gst_bin_get_by_name (GST_BIN (pipeline), name);
+  factory = filter ? gst_element_get_factory (filter) : NULL;
+  if (!factory || !g_str_equal (gst_plugin_feature_get_name
+          (GST_PLUGIN_FEATURE (factory)), "tensor_filter")) {
+    _ml_error_report
+        ("The option 'parallel_filter' (%s) is invalid. There is no tensor_filter with the name in the pipeline.",
+        name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  sink = gst_element_get_static_pad (filter, "sink");
+  src = gst_element_get_static_pad (filter, "src");
+  upstream = gst_pad_get_peer (sink);
+  downstream = gst_pad_get_peer (src);
+  if (!upstream || !downstream) {
+    _ml_error_report
+        ("The tensor_filter '%s' should be linked with upstream and downstream elements to be replicated.",
+        name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  _parallel = g_new0 (ml_pipeline_parallel_s, 1);
+  _parallel->name = g_strdup (name);
+  _parallel->probes = g_array_new (FALSE, FALSE,
+      sizeof (ml_pipeline_parallel_probe_s));
+  g_mutex_init (&_parallel->lock);
+  _parallel->num_replicas = num_replicas;
+  _parallel->replicas = g_new0 (ml_pipeline_replica_s, num_replicas);
+
+  for (i = 0; i < num_replicas; i++) {
+    _parallel->replicas[i].parallel = _parallel;
+    _parallel->replicas[i].index = i;
+    _parallel->replicas[i].cpu = cpus ? cpus[i] : -1;
+    g_cond_init (&_parallel->replicas[i].cond);
+  }
+
+  /* Replace the filter with the splitter and merger. */
+  elem_name = g_strdup_printf ("%s_split", name);
+  _parallel->splitter = gst_element_factory_make ("output-selector", elem_name);
+  g_free (elem_name);
+
+  elem_name = g_strdup_printf ("%s_merge", name);
+  merger = gst_element_factory_make ("funnel", elem_name);
+  g_free (elem_name);
+
+  if (!_parallel->splitter || !merger) {
+    if (_parallel->splitter)
+      gst_object_unref (_parallel->splitter);
+    if (merger)
+      gst_object_unref (merger);
+    _parallel->splitter = NULL;
+
+    _ml_error_report
+        ("Failed to create the splitter (output-selector) and merger (funnel) to replicate '%s'.",
+        name);
+    status = ML_ERROR_STREAMS_PIPE;
+    goto done;
+  }
+
+  bin = GST_BIN (GST_ELEMENT_PARENT (filter));
+  gst_bin_add_many (bin, _parallel->splitter, merger, NULL);
+  _parallel->merger = merger;
+
+  _parallel->bus = gst_element_get_bus (pipeline);
+  gst_bus_enable_sync_message_emission (_parallel->bus);
+  _parallel->signal_msg = g_signal_connect (_parallel->bus,
+      "sync-message::state-changed",
+      G_CALLBACK (_ml_pipeline_parallel_sync_message), _parallel);
+
+  gst_pad_unlink (upstream, sink);
+  gst_pad_unlink (src, downstream);
+
+  pad = gst_element_get_static_pad (_parallel->splitter, "sink");
+  if (gst_pad_link (upstream, pad) != GST_PAD_LINK_OK ||
+      !_ml_pipeline_parallel_add_probe (_parallel, pad,
+          GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST |
+          GST_PAD_PROBE_TYPE_EVENT_FLUSH, _ml_pipeline_parallel_split_probe,
+          _parallel))
+    status = ML_ERROR_STREAMS_PIPE;
+  gst_object_unref (pad);
+
+  pad = gst_element_get_static_pad (merger, "src");
+  if (gst_pad_link (pad, downstream) != GST_PAD_LINK_OK ||
+      !_ml_pipeline_parallel_add_probe (_parallel, pad,
+          GST_PAD_PROBE_TYPE_BUFFER, _ml_pipeline_parallel_merge_probe,
+          _parallel))
+    status = ML_ERROR_STREAMS_PIPE;
+  gst_object_unref (pad);
+
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report ("Failed to link the splitter and merger to replicate '%s'.",
+        name);
+    goto done;
+  }
+
+  for (i = 0; i < num_replicas; i++) {
+    status = _ml_pipeline_parallel_add_replica (_parallel, bin, filter,
+        merger, i);
+    if (status != ML_ERROR_NONE)
+      goto done;
+  }
+
+done:
+  if (status == ML_ERROR_NONE) {
+    *parallel = _parallel;
+  } else {
+    _ml_pipeline_parallel_free (_parallel);
+  }
+
+  if (sink)
+    gst_object_unref (sink);
+  if (src)
+    gst_object_unref (src);
+  if (upstream)
+    gst_object_unref (upstream);
+  if (downstream)
+    gst_object_unref (downstream);
+  if (filter)
+    gst_object_unref (filter);
+  g_free (cpus);
+  return status;
+}
+
+/**
+ * @brief Removes the probes and releases the parallel replicas.
+ */
+void
+_ml_pipeline_parallel_free (ml_pipeline_parallel_s * parallel)
+{
+  ml_pipeline_parallel_probe_s *probe;
+  guint i;
+
+  if (!parallel)
+    return;
+
+  if (parallel->bus) {
+    g_signal_handler_disconnect (parallel->bus, parallel->signal_msg);
+    gst_bus_disable_sync_message_emission (parallel->bus);
+    gst_object_unref (parallel->bus);
+  }
+
+  for (i = 0; i < parallel->probes->len; i++) {
+    probe = &g_array_index (parallel->probes, ml_pipeline_parallel_probe_s, i);
+    gst_pad_remove_probe (probe->pad, probe->id);
+    gst_object_unref (probe->pad);
+  }
+
+  for (i = 0; i < parallel->num_replicas; i++) {
+    if (parallel->replicas[i].split_pad)
+      gst_object_unref (parallel->replicas[i].split_pad);
+    g_cond_clear (&parallel->replicas[i].cond);
+  }
+
+  g_array_free (parallel->probes, TRUE);
+  g_mutex_clear (&parallel->lock);
+  g_free (parallel->replicas);
+  g_free (parallel->name);
+  g_free (parallel);
+}
+
+/**
+ * @brief Gets the number of replicas and the throughput gain of the replicated tensor_filter.
+ */
+gboolean
+_ml_pipeline_parallel_get_stats (ml_pipeline_parallel_s * parallel,
+    const gchar * name, guint * num_replicas, guint64 * gain)
+{
+  gint64 elapsed;
+
+  if (!parallel || !name || !g_str_equal (parallel->name, name))
+    return FALSE;
+
+  g_mutex_lock (&parallel->lock);
+  elapsed = parallel->last_out - parallel->first_in;
+  *num_replicas = parallel->num_replicas;
+  *gain = (parallel->first_in > 0 && elapsed > 0) ?
+      (guint64) (parallel->busy * 100 / elapsed) : 0;
+  g_mutex_unlock (&parallel->lock);
+
+  return TRUE;
+}
@@ -0,0 +1,372 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-inference-pipeline-pool.c
+ * @date 18 October 2026
+ * @brief ML C-API, pool of pre-constructed NNStreamer pipelines.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+
+#include <glib.h>
+#include <gst/gst.h>
+
+#include "nnstreamer.h"
+#include "nnstreamer-tizen-internal.h"
+#include "ml-api-internal.h"
+#include "ml-api-inference-pipeline-internal.h"
+
+/**
+ * @brief Data structure for the pool of pipelines.
+ */
+typedef struct
+{
+  GMutex lock; /**< Lock for the pool */
+  guint max_idle; /**< The max number of idle pipelines for each description */
+  GHashTable *idle; /**< The queue of idle pipelines for each description */
+  GHashTable *acquired; /**< The description of each pipeline acquired from the pool */
+} ml_pipeline_pool_s;
+
+/**
+ * @brief Internal function to destroy the queue of idle pipelines.
+ */
+static void
+_ml_pipeline_pool_free_queue (gpointer data)
+{
+  GQueue *queue = (GQueue *) data;
+  ml_pipeline_h pipe;
+
+  while ((pipe = g_queue_pop_head (queue)) != NULL)
+    ml_pipeline_destroy (pipe);
+
+  g_queue_free (queue);
+}
+
+/**
+ * @brief Internal function to pause the pipeline, so that the elements are prepared and the stream is negotiated.
+ * @details This does not wait for the preroll. The live sources and appsrc without data do not preroll.
+ */
+static int
+_ml_pipeline_pool_pause (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = (ml_pipeline *) pipe;
+  GstStateChangeReturn scret;
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to pause the pipeline in the pool. For the detail, please check the GStreamer log messages.");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to reset the released pipeline, dropping the data in the pipeline.
+ * @details READY state resets the elements (e.g., EOS and the buffers queued in appsrc), then it is paused again.
+ *          The state set by the application (e.g., the flow control of src, the queue of sink and the statistics) is cleared, same as new pipeline.
+ */
+static int
+_ml_pipeline_pool_reset (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = (ml_pipeline *) pipe;
+  GstStateChangeReturn scret;
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_set_state (p->element, GST_STATE_READY);
+  if (scret != GST_STATE_CHANGE_FAILURE)
+    scret = gst_element_get_state (p->element, NULL, NULL,
+        GST_CLOCK_TIME_NONE);
+  p->isEOS = FALSE;
+  _ml_pipeline_reset_elements (p);
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to reset the pipeline released to the pool. For the detail, please check the GStreamer log messages.");
+
+  return _ml_pipeline_pool_pause (pipe);
+}
+
+/**
+ * @brief Internal function to check the pipeline does not have the handles of application.
+ */
+static gboolean
+_ml_pipeline_pool_has_handles (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = (ml_pipeline *) pipe;
+  GHashTableIter iter;
+  gpointer value;
+  ml_pipeline_element *elem;
+  gboolean found = FALSE;
+
+  g_mutex_lock (&p->lock);
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (!found && g_hash_table_iter_next (&iter, NULL, &value)) {
+    elem = (ml_pipeline_element *) value;
+
+    g_mutex_lock (&elem->lock);
+    found = (elem->handles != NULL);
+    g_mutex_unlock (&elem->lock);
+  }
+  g_mutex_unlock (&p->lock);
+
+  return found;
+}
+
+/**
+ * @brief Internal function to construct new pipeline for the pool.
+ */
+static int
+_ml_pipeline_pool_construct (const char *description, ml_pipeline_h * pipe)
+{
+  ml_pipeline_h _pipe = NULL;
+  int status;
+
+  status = ml_pipeline_construct (description, NULL, NULL, &_pipe);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to construct the pipeline for the pool.");
+
+  status = _ml_pipeline_pool_pause (_pipe);
+  if (status != ML_ERROR_NONE) {
+    ml_pipeline_destroy (_pipe);
+    return status;
+  }
+
+  *pipe = _pipe;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to push the idle pipeline to the pool.
+ * @note The caller should lock the pool.
+ * @return FALSE if the pool is full.
+ */
+static gboolean
+_ml_pipeline_pool_push_idle (ml_pipeline_pool_s * pool,
+    const gchar * description, ml_pipeline_h pipe)
+{
+  GQueue *queue;
+
+  queue = (GQueue *) g_hash_table_lookup (pool->idle, description);
+  if (!queue) {
+    queue = g_queue_new ();
+    g_hash_table_insert (pool->idle, g_strdup (description), queue);
+  }
+
+  if (g_queue_get_length (queue) >= pool->max_idle)
+    return FALSE;
+
+  g_queue_push_tail (queue, pipe);
+  return TRUE;
+}
+
+/**
+ * @brief Creates a pool of pipelines (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_create (unsigned int max_idle, ml_pipeline_pool_h * pool)
+{
+  ml_pipeline_pool_s *_pool;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool, is NULL. It should be a valid pointer to ml_pipeline_pool_h.");
+  if (max_idle == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, max_idle, is 0. It should be a positive number of idle pipelines for each description.");
+
+  _pool = g_try_new0 (ml_pipeline_pool_s, 1);
+  if (!_pool)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the pool of pipelines. Out of memory?");
+
+  g_mutex_init (&_pool->lock);
+  _pool->max_idle = max_idle;
+  _pool->idle = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      _ml_pipeline_pool_free_queue);
+  _pool->acquired = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+      NULL, g_free);
+
+  *pool = _pool;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Destroys the pool of pipelines (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_destroy (ml_pipeline_pool_h pool)
+{
+  ml_pipeline_pool_s *_pool = (ml_pipeline_pool_s *) pool;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!_pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool, is NULL. It should be a valid ml_pipeline_pool_h handle, which is usually created by ml_pipeline_pool_create().");
+
+  g_mutex_lock (&_pool->lock);
+  g_hash_table_destroy (_pool->idle);
+  g_hash_table_destroy (_pool->acquired);
+  _pool->idle = _pool->acquired = NULL;
+  g_mutex_unlock (&_pool->lock);
+
+  g_mutex_clear (&_pool->lock);
+  g_free (_pool);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Constructs the pipelines in advance (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_prepare (ml_pipeline_pool_h pool, const char *description,
+    unsigned int count)
+{
+  ml_pipeline_pool_s *_pool = (ml_pipeline_pool_s *) pool;
+  ml_pipeline_h pipe;
+  GQueue *queue;
+  guint i, num_idle;
+  gboolean pushed;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!_pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool, is NULL. It should be a valid ml_pipeline_pool_h handle, which is usually created by ml_pipeline_pool_create().");
+  if (!description || description[0] == '\0')
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, description, is NULL or empty. It should be a valid pipeline description.");
+
+  g_mutex_lock (&_pool->lock);
+  queue = (GQueue *) g_hash_table_lookup (_pool->idle, description);
+  num_idle = queue ? g_queue_get_length (queue) : 0U;
+  g_mutex_unlock (&_pool->lock);
+
+  count = MIN (count, _pool->max_idle);
+
+  /* Construct the pipelines without the lock, it takes long time. */
+  for (i = num_idle; i < count; i++) {
+    status = _ml_pipeline_pool_construct (description, &pipe);
+    if (status != ML_ERROR_NONE)
+      return status;
+
+    g_mutex_lock (&_pool->lock);
+    pushed = _ml_pipeline_pool_push_idle (_pool, description, pipe);
+    g_mutex_unlock (&_pool->lock);
+
+    if (!pushed) {
+      ml_pipeline_destroy (pipe);
+      break;
+    }
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets a pipeline from the pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_acquire (ml_pipeline_pool_h pool, const char *description,
+    ml_pipeline_h * pipe)
+{
+  ml_pipeline_pool_s *_pool = (ml_pipeline_pool_s *) pool;
+  ml_pipeline_h _pipe = NULL;
+  GQueue *queue;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!_pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool, is NULL. It should be a valid ml_pipeline_pool_h handle, which is usually created by ml_pipeline_pool_create().");
+  if (!description || description[0] == '\0')
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, description, is NULL or empty. It should be a valid pipeline description.");
+  if (!pipe)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid pointer to ml_pipeline_h.");
+
+  g_mutex_lock (&_pool->lock);
+  queue = (GQueue *) g_hash_table_lookup (_pool->idle, description);
+  if (queue)
+    _pipe = g_queue_pop_head (queue);
+  g_mutex_unlock (&_pool->lock);
+
+  /* No idle pipeline, construct new one. */
+  if (!_pipe) {
+    status = _ml_pipeline_pool_construct (description, &_pipe);
+    if (status != ML_ERROR_NONE)
+      return status;
+  }
+
+  g_mutex_lock (&_pool->lock);
+  g_hash_table_insert (_pool->acquired, _pipe, g_strdup (description));
+  g_mutex_unlock (&_pool->lock);
+
+  *pipe = _pipe;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Returns the pipeline to the pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_release (ml_pipeline_pool_h pool, ml_pipeline_h pipe)
+{
+  ml_pipeline_pool_s *_pool = (ml_pipeline_pool_s *) pool;
+  gchar *description = NULL;
+  gboolean pushed = FALSE;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!_pool)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pool, is NULL. It should be a valid ml_pipeline_pool_h handle, which is usually created by ml_pipeline_pool_create().");
+  if (!pipe)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle acquired from the pool.");
+
+  /* Check and take the pipeline at once, not to release the pipeline twice. */
+  g_mutex_lock (&_pool->lock);
+  if (!g_hash_table_lookup_extended (_pool->acquired, pipe, NULL,
+          (gpointer *) & description)) {
+    g_mutex_unlock (&_pool->lock);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is not acquired from the pool with ml_pipeline_pool_acquire().");
+  }
+
+  if (_ml_pipeline_pool_has_handles (pipe)) {
+    g_mutex_unlock (&_pool->lock);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The pipeline has the handles of sink, src or other elements. Release the handles before returning the pipeline to the pool.");
+  }
+
+  /* The description is owned by this function now. */
+  g_hash_table_steal (_pool->acquired, pipe);
+  g_mutex_unlock (&_pool->lock);
+
+  status = _ml_pipeline_pool_reset (pipe);
+  if (status == ML_ERROR_NONE) {
+    g_mutex_lock (&_pool->lock);
+    pushed = _ml_pipeline_pool_push_idle (_pool, description, pipe);
+    g_mutex_unlock (&_pool->lock);
+  }
+
+  /* The pool is full or failed to reset the pipeline. */
+  if (!pushed)
+    ml_pipeline_destroy (pipe);
+
+  g_free (description);
+  return ML_ERROR_NONE;
+}
@@ -0,0 +1,567 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-inference-pipeline-stats.c
+ * @date 18 October 2026
+ * @brief ML C-API, per-element statistics of NNStreamer pipeline.
+ * @see	https://github.com/nnstreamer/api
+ * @bug Pads added after enabling the statistics (e.g., sometimes pads) are not measured.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+#include <gst/gst.h>
+
+#include "nnstreamer.h"
+#include "nnstreamer-tizen-internal.h"
+#include "ml-api-internal.h"
+#include "ml-api-inference-pipeline-internal.h"
+
+/**
+ * @brief The max number of latency samples kept for each element.
+ */
+#define ML_PIPELINE_STATS_SAMPLES (256U)
+
+/**
+ * @brief The max number of streaming threads measured for each element (e.g., the sink pads of tensor_mux).
+ */
+#define ML_PIPELINE_STATS_THREADS (8U)
+
+/**
+ * @brief Data structure for the buffer arrived at an element in a streaming thread, waiting for the push in the same thread.
+ */
+typedef struct
+{
+  GThread *thread; /**< The streaming thread */
+  gint64 time; /**< The time (us) when the buffer arrived, 0 if the buffer is pushed */
+} ml_pipeline_stats_arrival_s;
+
+/**
+ * @brief Data structure for the statistics of an element.
+ * @details The pad probes hold the references, the statistics is valid while a probe is running.
+ *          The latency is measured from the arrival of a buffer to the push in the same streaming thread. Thus, it is measured only for the elements processing the buffers synchronously in the chain function. The queues, sources and the elements pushing the buffers in their own threads do not have the latency.
+ */
+typedef struct
+{
+  gint ref_count; /**< The reference count, updated atomically */
+  GstElement *element; /**< The element to be measured */
+  gchar *name; /**< The name of the element */
+  gchar *factory; /**< The factory name of the element */
+  GMutex lock; /**< Lock for the values below */
+  guint64 buffers_in; /**< The number of buffers arrived at the sink pads */
+  guint64 buffers_out; /**< The number of buffers pushed from the src pads */
+  ml_pipeline_stats_arrival_s arrivals[ML_PIPELINE_STATS_THREADS]; /**< The buffers arrived in the streaming threads */
+  gint64 samples[ML_PIPELINE_STATS_SAMPLES]; /**< The ring of latency samples (us) */
+  guint num_samples; /**< The number of valid samples */
+  guint next_sample; /**< The index to write the next sample */
+} ml_pipeline_element_stats_s;
+
+/**
+ * @brief Data structure for a pad probe installed for the statistics.
+ */
+typedef struct
+{
+  GstPad *pad; /**< The pad with the probe */
+  gulong id; /**< The probe id */
+} ml_pipeline_stats_probe_s;
+
+/**
+ * @brief Data structure for the statistics of a pipeline.
+ */
+struct _ml_pipeline_stats_s
+{
+  GPtrArray *elements; /**< The list of ml_pipeline_element_stats_s */
+  GArray *probes; /**< The list of ml_pipeline_stats_probe_s */
+};
+
+/**
+ * @brief Internal function to release the reference of element statistics.
+ */
+static void
+_ml_pipeline_element_stats_unref (gpointer data)
+{
+  ml_pipeline_element_stats_s *stats = (ml_pipeline_element_stats_s *) data;
+
+  if (!stats || !g_atomic_int_dec_and_test (&stats->ref_count))
+    return;
+
+  gst_object_unref (stats->element);
+  g_free (stats->name);
+  g_free (stats->factory);
+  g_mutex_clear (&stats->lock);
+  g_free (stats);
+}
+
+/**
+ * @brief Internal function to get the number of buffers passed to the probe.
+ */
+static guint
+_ml_pipeline_stats_count_buffers (GstPadProbeInfo * info)
+{
+  if (info->type & GST_PAD_PROBE_TYPE_BUFFER_LIST)
+    return gst_buffer_list_length (GST_PAD_PROBE_INFO_BUFFER_LIST (info));
+
+  return 1U;
+}
+
+/**
+ * @brief Internal function to find the buffer arrived in the streaming thread.
+ * @note The caller should lock the statistics.
+ * @param[in] add TRUE to get an empty slot if the thread is not found.
+ */
+static ml_pipeline_stats_arrival_s *
+_ml_pipeline_stats_find_arrival (ml_pipeline_element_stats_s * stats,
+    GThread * thread, gboolean add)
+{
+  ml_pipeline_stats_arrival_s *empty = NULL;
+  guint i;
+
+  for (i = 0; i < ML_PIPELINE_STATS_THREADS; i++) {
+    if (stats->arrivals[i].thread == thread)
+      return &stats->arrivals[i];
+
+    if (!empty && stats->arrivals[i].thread == NULL)
+      empty = &stats->arrivals[i];
+  }
+
+  if (add && empty)
+    empty->thread = thread;
+
+  return add ? empty : NULL;
+}
+
+/**
+ * @brief Pad probe on the sink pads, counting the buffers arrived at the element.
+ */
+static GstPadProbeReturn
+_ml_pipeline_stats_sink_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_element_stats_s *stats =
+      (ml_pipeline_element_stats_s *) user_data;
+  ml_pipeline_stats_arrival_s *arrival;
+  guint count = _ml_pipeline_stats_count_buffers (info);
+
+  g_mutex_lock (&stats->lock);
+  stats->buffers_in += count;
+
+  arrival = _ml_pipeline_stats_find_arrival (stats, g_thread_self (), TRUE);
+  if (arrival)
+    arrival->time = g_get_monotonic_time ();
+  g_mutex_unlock (&stats->lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Pad probe on the src pads, counting the buffers and measuring the time since the buffer arrived in the same streaming thread.
+ */
+static GstPadProbeReturn
+_ml_pipeline_stats_src_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_element_stats_s *stats =
+      (ml_pipeline_element_stats_s *) user_data;
+  ml_pipeline_stats_arrival_s *arrival;
+  guint count = _ml_pipeline_stats_count_buffers (info);
+  gint64 now = g_get_monotonic_time ();
+
+  g_mutex_lock (&stats->lock);
+  stats->buffers_out += count;
+
+  /* Only the first push for an arrived buffer is measured. */
+  arrival = _ml_pipeline_stats_find_arrival (stats, g_thread_self (), FALSE);
+  if (arrival && arrival->time > 0) {
+    stats->samples[stats->next_sample] = now - arrival->time;
+    stats->next_sample = (stats->next_sample + 1) % ML_PIPELINE_STATS_SAMPLES;
+    if (stats->num_samples < ML_PIPELINE_STATS_SAMPLES)
+      stats->num_samples++;
+
+    arrival->time = 0;
+  }
+  g_mutex_unlock (&stats->lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Internal function to install the probes on the pads of an element.
+ */
+static void
+_ml_pipeline_stats_add_element (ml_pipeline_stats_s * pstats,
+    GstElement * element)
+{
+  ml_pipeline_element_stats_s *stats;
+  ml_pipeline_stats_probe_s probe;
+  GstElementFactory *factory;
+  GstIterator *it;
+  GValue item = G_VALUE_INIT;
+  GstPad *pad;
+  gboolean done = FALSE;
+
+  stats = g_new0 (ml_pipeline_element_stats_s, 1);
+  stats->ref_count = 1;
+  stats->element = gst_object_ref (element);
+  stats->name = gst_element_get_name (element);
+  factory = gst_element_get_factory (element);
+  stats->factory = g_strdup (factory ?
+      gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (factory)) : "");
+  g_mutex_init (&stats->lock);
+
+  it = gst_element_iterate_pads (element);
+  while (!done) {
+    switch (gst_iterator_next (it, &item)) {
+      case GST_ITERATOR_OK:
+        pad = GST_PAD (g_value_get_object (&item));
+
+        probe.pad = gst_object_ref (pad);
+        probe.id = gst_pad_add_probe (pad,
+            GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST,
+            (GST_PAD_IS_SINK (pad)) ? _ml_pipeline_stats_sink_probe :
+            _ml_pipeline_stats_src_probe, stats,
+            _ml_pipeline_element_stats_unref);
+
+        if (probe.id > 0) {
+          g_atomic_int_inc (&stats->ref_count);
+          g_array_append_val (pstats->probes, probe);
+        } else {
+          gst_object_unref (probe.pad);
+        }
+
+        g_value_reset (&item);
+        break;
+      case GST_ITERATOR_RESYNC:
+        gst_iterator_resync (it);
+        break;
+      default:
+        done = TRUE;
+        break;
+    }
+  }
+
+  g_value_unset (&item);
+  gst_iterator_free (it);
+
+  g_ptr_array_add (pstats->elements, stats);
+}
+
+/**
+ * @brief Internal function to create new statistics of a pipeline.
+ */
+static ml_pipeline_stats_s *
+_ml_pipeline_stats_new (void)
+{
+  ml_pipeline_stats_s *pstats;
+
+  pstats = g_new0 (ml_pipeline_stats_s, 1);
+  pstats->elements =
+      g_ptr_array_new_with_free_func (_ml_pipeline_element_stats_unref);
+  pstats->probes = g_array_new (FALSE, FALSE,
+      sizeof (ml_pipeline_stats_probe_s));
+
+  return pstats;
+}
+
+/**
+ * @brief Starts measuring the statistics of the elements in the pipeline.
+ */
+int
+_ml_pipeline_stats_start (ml_pipeline * p)
+{
+  ml_pipeline_stats_s *pstats;
+  GstIterator *it;
+  GValue item = G_VALUE_INIT;
+  GstElement *element;
+  gboolean done = FALSE;
+
+  if (p->stats)
+    return ML_ERROR_NONE;
+
+  pstats = _ml_pipeline_stats_new ();
+
+  it = gst_bin_iterate_recurse (GST_BIN (p->element));
+  while (!done) {
+    switch (gst_iterator_next (it, &item)) {
+      case GST_ITERATOR_OK:
+        element = GST_ELEMENT (g_value_get_object (&item));
+
+        /* The children of bin are measured. */
+        if (!GST_IS_BIN (element))
+          _ml_pipeline_stats_add_element (pstats, element);
+
+        g_value_reset (&item);
+        break;
+      case GST_ITERATOR_RESYNC:
+        /* Measure the elements again. */
+        _ml_pipeline_stats_free (pstats);
+        pstats = _ml_pipeline_stats_new ();
+        gst_iterator_resync (it);
+        break;
+      case GST_ITERATOR_ERROR:
+        g_value_unset (&item);
+        gst_iterator_free (it);
+        _ml_pipeline_stats_free (pstats);
+        _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+            "Failed to iterate the elements of the pipeline.");
+      default:
+        done = TRUE;
+        break;
+    }
+  }
+
+  g_value_unset (&item);
+  gst_iterator_free (it);
+
+  p->stats = pstats;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Removes the probes and releases the statistics of the pipeline.
+ */
+void
+_ml_pipeline_stats_free (ml_pipeline_stats_s * pstats)
+{
+  ml_pipeline_stats_probe_s *probe;
+  guint i;
+
+  if (!pstats)
+    return;
+
+  /* The probe running in streaming thread holds the reference of element statistics. */
+  for (i = 0; i < pstats->probes->len; i++) {
+    probe = &g_array_index (pstats->probes, ml_pipeline_stats_probe_s, i);
+    gst_pad_remove_probe (probe->pad, probe->id);
+    gst_object_unref (probe->pad);
+  }
+
+  g_array_free (pstats->probes, TRUE);
+  g_ptr_array_free (pstats->elements, TRUE);
+  g_free (pstats);
+}
+
+/**
+ * @brief Internal function to compare the latency samples.
+ */
+static int
+_ml_pipeline_stats_compare (const void *a, const void *b)
+{
+  gint64 va = *((const gint64 *) a);
+  gint64 vb = *((const gint64 *) b);
+
+  return (va > vb) - (va < vb);
+}
+
+/**
+ * @brief Internal function to get the numeric property of element, such as queue level.
+ */
+static gboolean
+_ml_pipeline_stats_get_property (GstElement * element, const gchar * name,
+    guint64 * value)
+{
+  GParamSpec *spec;
+  GValue val = G_VALUE_INIT;
+  GValue val64 = G_VALUE_INIT;
+  gboolean ret = FALSE;
+
+  spec = g_object_class_find_property (G_OBJECT_GET_CLASS (element), name);
+  if (!spec || !(spec->flags & G_PARAM_READABLE))
+    return FALSE;
+
+  g_value_init (&val, spec->value_type);
+  g_value_init (&val64, G_TYPE_UINT64);
+  g_object_get_property (G_OBJECT (element), name, &val);
+
+  if (g_value_type_transformable (spec->value_type, G_TYPE_UINT64) &&
+      g_value_transform (&val, &val64)) {
+    *value = g_value_get_uint64 (&val64);
+    ret = TRUE;
+  }
+
+  g_value_unset (&val);
+  g_value_unset (&val64);
+  return ret;
+}
+
+/**
+ * @brief Internal function to set the numeric value in the information handle.
+ */
+static int
+_ml_pipeline_stats_set_value (ml_information_h info, const gchar * key,
+    guint64 value)
+{
+  uint64_t *v;
+
+  v = g_try_new (uint64_t, 1);
+  if (!v)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the value of pipeline statistics. Out of memory?");
+
+  *v = value;
+  return _ml_information_set (info, key, v, g_free);
+}
+
+/**
+ * @brief Internal function to create the information handle with the statistics of an element.
+ */
+static int
+_ml_pipeline_stats_get_element (ml_pipeline * p,
+    ml_pipeline_element_stats_s * stats, ml_information_h * info)
+{
+  ml_information_h _info = NULL;
+  gint64 samples[ML_PIPELINE_STATS_SAMPLES];
+  guint64 buffers_in, buffers_out, value;
+  guint num_samples, num_replicas;
+  int status;
+
+  g_mutex_lock (&stats->lock);
+  buffers_in = stats->buffers_in;
+  buffers_out = stats->buffers_out;
+  num_samples = stats->num_samples;
+  memcpy (samples, stats->samples, sizeof (gint64) * num_samples);
+  g_mutex_unlock (&stats->lock);
+
+  status = _ml_information_create (&_info);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  status = _ml_information_set (_info, "name", g_strdup (stats->name), g_free);
+  if (status == ML_ERROR_NONE)
+    status = _ml_information_set (_info, "factory",
+        g_strdup (stats->factory), g_free);
+  if (status == ML_ERROR_NONE)
+    status = _ml_pipeline_stats_set_value (_info, "buffers_in", buffers_in);
+  if (status == ML_ERROR_NONE)
+    status = _ml_pipeline_stats_set_value (_info, "buffers_out", buffers_out);
+
+  /* The latency percentiles in microseconds. */
+  if (status == ML_ERROR_NONE && num_samples > 0) {
+    qsort (samples, num_samples, sizeof (gint64), _ml_pipeline_stats_compare);
+
+    status = _ml_pipeline_stats_set_value (_info, "latency_p50",
+        samples[(num_samples - 1) * 50 / 100]);
+    if (status == ML_ERROR_NONE)
+      status = _ml_pipeline_stats_set_value (_info, "latency_p90",
+          samples[(num_samples - 1) * 90 / 100]);
+    if (status == ML_ERROR_NONE)
+      status = _ml_pipeline_stats_set_value (_info, "latency_p99",
+          samples[(num_samples - 1) * 99 / 100]);
+    if (status == ML_ERROR_NONE)
+      status = _ml_pipeline_stats_set_value (_info, "latency_max",
+          samples[num_samples - 1]);
+  }
+
+  /* The queue level, if the element reports it. */
+  if (status == ML_ERROR_NONE &&
+      _ml_pipeline_stats_get_property (stats->element,
+          "current-level-buffers", &value))
+    status = _ml_pipeline_stats_set_value (_info, "queue_level", value);
+
+  /* The replicas and throughput gain, if the tensor_filter is replicated. */
+  if (status == ML_ERROR_NONE &&
+      _ml_pipeline_parallel_get_stats (p->parallel, stats->name,
+          &num_replicas, &value)) {
+    status = _ml_pipeline_stats_set_value (_info, "replicas", num_replicas);
+    if (status == ML_ERROR_NONE)
+      status = _ml_pipeline_stats_set_value (_info, "throughput_gain", value);
+  }
+
+  if (status != ML_ERROR_NONE) {
+    ml_information_destroy (_info);
+    return status;
+  }
+
+  *info = _info;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Enables or disables the statistics of the elements in the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_set_stats_enabled (ml_pipeline_h pipe, bool enable)
+{
+  ml_pipeline *p = pipe;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
+
+  g_mutex_lock (&p->lock);
+
+  if (enable) {
+    status = _ml_pipeline_stats_start (p);
+  } else {
+    _ml_pipeline_stats_free (p->stats);
+    p->stats = NULL;
+  }
+
+  g_mutex_unlock (&p->lock);
+  return status;
+}
+
+/**
+ * @brief Gets the statistics of the elements in the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_get_stats (ml_pipeline_h pipe, ml_information_list_h * stats)
+{
+  ml_pipeline *p = pipe;
+  ml_information_list_h list = NULL;
+  ml_information_h info;
+  guint i;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
+  if (stats == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, stats, is NULL. It should be a valid pointer to ml_information_list_h.");
+
+  g_mutex_lock (&p->lock);
+
+  if (!p->stats) {
+    _ml_error_report
+        ("The statistics of the pipeline is not enabled. Call ml_pipeline_set_stats_enabled() first.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  status = _ml_information_list_create (&list);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the information list for pipeline statistics.");
+    goto done;
+  }
+
+  for (i = 0; i < p->stats->elements->len; i++) {
+    status = _ml_pipeline_stats_get_element (p, g_ptr_array_index
+        (p->stats->elements, i), &info);
+    if (status == ML_ERROR_NONE) {
+      status = _ml_information_list_add (list, info);
+      if (status != ML_ERROR_NONE)
+        ml_information_destroy (info);
+    }
+
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue ("Failed to get the statistics of elements.");
+      ml_information_list_destroy (list);
+      list = NULL;
+      goto done;
+    }
+  }
+
+  *stats = list;
+
+done:
+  g_mutex_unlock (&p->lock);
+  return status;
+}
@@ -26,6 +26,7 @@
 #include "ml-api-internal.h"
 #include "ml-api-inference-internal.h"
 #include "ml-api-inference-pipeline-internal.h"
+#include "ml-api-trace.h"
 
 
 #define handle_init(name, h) \
@@ -95,6 +96,12 @@ static void ml_pipeline_custom_filter_ref (ml_custom_easy_filter_h custom);
 static void ml_pipeline_custom_filter_unref (ml_custom_easy_filter_h custom);
 static void ml_pipeline_if_custom_ref (ml_pipeline_if_h custom);
 static void ml_pipeline_if_custom_unref (ml_pipeline_if_h custom);
+static void _ml_pipeline_src_pool_release (ml_pipeline_element * elem);
+static void _ml_pipeline_src_flow_release (ml_pipeline_element * elem);
+static void _ml_pipeline_sink_pull_release (ml_pipeline_element * elem);
+static void _ml_pipeline_src_flow_close (ml_pipeline * p);
+static void _ml_pipeline_sink_dispatch_unref (ml_pipeline_sink_dispatch_s *
+    dispatch);
 
 /**
  * @brief Global lock for pipeline functions.
@@ -243,8 +250,21 @@ construct_element (GstElement * e, ml_pipeline * p, const char *name,
   ret->handle_id = 0;
   ret->is_media_stream = FALSE;
   ret->is_flexible_tensor = FALSE;
+  ret->pool = NULL;
+  ret->flow_probe = 0;
+  ret->flow_timeout = 0;
+  ret->flow_waiters = 0;
+  ret->flow_closing = FALSE;
+  ret->pull_queue = NULL;
+  ret->pull_id = 0;
+  ret->caps_probe = 0;
+  ret->caps_version = 0;
+  ret->caps_parsed = -1;
   g_mutex_init (&ret->lock);
+  g_mutex_init (&ret->flow_lock);
+  g_cond_init (&ret->flow_cond);
   gst_tensors_info_init (&ret->tensors_info);
+  gst_tensors_info_init (&ret->pool_info);
 
   return ret;
 }
@@ -282,1484 +302,3406 @@ get_tensors_info_from_caps (GstCaps * caps, GstTensorsInfo * info,
 }
 
 /**
- * @brief Handle a sink element for registered ml_pipeline_sink_cb
+ * @brief The default max number of data in the queue of asynchronous sink.
  */
-static void
-cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
-{
-  ml_pipeline_element *elem = user_data;
+#define ML_PIPELINE_SINK_QUEUE_SIZE_DEFAULT (16U)
 
-  /** @todo CRITICAL if the pipeline is being killed, don't proceed! */
-  GstMemory *mem[ML_TENSOR_SIZE_LIMIT];
-  GstMapInfo map[ML_TENSOR_SIZE_LIMIT];
-  guint i, num_tensors;
-  GList *l;
-  ml_tensors_data_s *_data = NULL;
-  GstTensorsInfo gst_info;
-  int status;
+/**
+ * @brief Data structure for the mapped memories of a buffer, which are released with the data handle.
+ */
+typedef struct
+{
+  guint num_mems; /**< The number of mapped memories */
+  GstMemory *mem[ML_TENSOR_SIZE_LIMIT]; /**< The memories of the buffer */
+  GstMapInfo map[ML_TENSOR_SIZE_LIMIT]; /**< The map info of the memories */
+} ml_pipeline_sink_frame_s;
 
-  gst_tensors_info_init (&gst_info);
-  gst_info.num_tensors = num_tensors = gst_tensor_buffer_get_count (b);
+/**
+ * @brief Internal function to unmap and release the memories of the sink frame.
+ */
+static void
+_ml_pipeline_sink_frame_free (gpointer data)
+{
+  ml_pipeline_sink_frame_s *frame = (ml_pipeline_sink_frame_s *) data;
+  guint i;
 
-  /* Set tensor data. The handle for tensors-info in data should be added. */
-  status =
-      _ml_tensors_data_create_no_alloc (NULL, (ml_tensors_data_h *) & _data);
-  if (status != ML_ERROR_NONE) {
-    _ml_loge (_ml_detail
-        ("Failed to allocate memory for tensors data in sink callback, which is registered by ml_pipeline_sink_register ()."));
+  if (!frame)
     return;
-  }
-
-  g_mutex_lock (&elem->lock);
-
-  _data->num_tensors = num_tensors;
-  for (i = 0; i < num_tensors; i++) {
-    mem[i] = gst_tensor_buffer_get_nth_memory (b, i);
-    if (!gst_memory_map (mem[i], &map[i], GST_MAP_READ)) {
-      _ml_loge (_ml_detail
-          ("Failed to map the output in sink '%s' callback, which is registered by ml_pipeline_sink_register ()",
-              elem->name));
-      gst_memory_unref (mem[i]);
-      num_tensors = i;
-      goto error;
-    }
 
-    _data->tensors[i].data = map[i].data;
-    _data->tensors[i].size = map[i].size;
+  for (i = 0; i < frame->num_mems; i++) {
+    gst_memory_unmap (frame->mem[i], &frame->map[i]);
+    gst_memory_unref (frame->mem[i]);
   }
 
-  /** @todo This assumes that padcap is static */
-  if (elem->sink == NULL) {
-    gboolean found = FALSE;
-    gboolean flexible = FALSE;
+  g_free (frame);
+}
 
-    /* Get the sink-pad-cap */
-    elem->sink = gst_element_get_static_pad (elem->element, "sink");
+/**
+ * @brief Internal function to set the shared owner of the sink data, holding the memories of the buffer.
+ * @details This is called when the sink data is referred or cloned in the sink callback.
+ *          The memories are referred and mapped again, so that the data is valid after the callback without copying it.
+ */
+static int
+_ml_pipeline_sink_data_retain (ml_tensors_data_h data, void *retain_data)
+{
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  GstBuffer *buffer = GST_BUFFER (retain_data);
+  ml_pipeline_sink_frame_s *frame;
+  gsize offset;
+  guint i;
 
-    if (elem->sink) {
-      /* sinkpadcap available (negotiated) */
-      GstCaps *caps = gst_pad_get_current_caps (elem->sink);
+  frame = g_try_new0 (ml_pipeline_sink_frame_s, 1);
+  if (!frame)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the sink data. Out of memory?");
 
-      if (caps) {
-        found = get_tensors_info_from_caps (caps, &elem->tensors_info,
-            &flexible);
-        gst_caps_unref (caps);
-      }
+  for (i = 0; i < _data->num_tensors; i++) {
+    frame->mem[i] = gst_tensor_buffer_get_nth_memory (buffer, i);
+    if (!gst_memory_map (frame->mem[i], &frame->map[i], GST_MAP_READ)) {
+      gst_memory_unref (frame->mem[i]);
+      _ml_pipeline_sink_frame_free (frame);
+      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+          "Failed to map the memory of the sink data.");
     }
 
-    if (found) {
-      elem->is_flexible_tensor = flexible;
-    } else {
-      /* It is not valid */
-      if (elem->sink) {
-        gst_object_unref (elem->sink);
-        elem->sink = NULL;
-      }
-
-      goto error;
-    }
+    frame->num_mems++;
   }
 
-  /* Prepare output and set data. */
-  if (elem->is_flexible_tensor) {
-    GstTensorMetaInfo meta;
-    gsize hsize;
+  _data->shared = _ml_tensors_data_shared_new (0, _ml_pipeline_sink_frame_free,
+      frame);
+  if (!_data->shared) {
+    _ml_pipeline_sink_frame_free (frame);
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for the sink data. Out of memory?");
+  }
 
-    /* handle header for flex tensor */
-    for (i = 0; i < num_tensors; i++) {
-      gst_tensor_meta_info_parse_header (&meta, map[i].data);
-      hsize = gst_tensor_meta_info_get_header_size (&meta);
+  /* The memories are owned by the pipeline. Skip the header of flexible tensor. */
+  for (i = 0; i < _data->num_tensors; i++) {
+    offset = frame->map[i].size - _data->tensors[i].size;
+    _data->tensors[i].data = frame->map[i].data + offset;
+  }
 
-      gst_tensor_meta_info_convert (&meta,
-          gst_tensors_info_get_nth_info (&gst_info, i));
+  /* The memory accounted in the sink callback moves to the block, see _ml_tensors_data_share(). */
+  _data->shared->read_only = TRUE;
 
-      _data->tensors[i].data = map[i].data + hsize;
-      _data->tensors[i].size = map[i].size - hsize;
-    }
-  } else {
-    gst_tensors_info_copy (&gst_info, &elem->tensors_info);
+  return ML_ERROR_NONE;
+}
 
-    /* Compare output info and buffer if gst-buffer is not flexible. */
-    if (gst_info.num_tensors != num_tensors) {
-      _ml_loge (_ml_detail
-          ("The sink event of [%s] cannot be handled because the number of tensors mismatches.",
-              elem->name));
+/**
+ * @brief Data structure for the sink data queued to asynchronous sink after unlocking the element.
+ */
+typedef struct
+{
+  ml_pipeline_sink_dispatch_s *dispatch; /**< The reference of asynchronous sink */
+  ml_tensors_data_h data; /**< The retained sink data */
+} ml_pipeline_sink_pending_s;
 
-      gst_object_unref (elem->sink);
-      elem->sink = NULL;
-      goto error;
+/**
+ * @brief The worker thread of asynchronous sink, calling the sink callback.
+ */
+static gpointer
+_ml_pipeline_sink_dispatch_thread (gpointer data)
+{
+  ml_pipeline_sink_dispatch_s *dispatch = (ml_pipeline_sink_dispatch_s *) data;
+  ml_tensors_data_s *item;
+  gboolean detached;
+
+  g_mutex_lock (&dispatch->lock);
+  while (dispatch->running) {
+    item = (ml_tensors_data_s *) g_queue_pop_head (&dispatch->queue);
+    if (!item) {
+      g_cond_wait (&dispatch->cond, &dispatch->lock);
+      continue;
     }
 
-    for (i = 0; i < num_tensors; i++) {
-      size_t sz = gst_tensors_info_get_size (&gst_info, i);
+    /* Wake up the streaming thread waiting for a room. */
+    g_cond_broadcast (&dispatch->cond);
+    g_mutex_unlock (&dispatch->lock);
 
-      /* Not configured, yet. */
-      if (sz == 0)
-        _ml_loge (_ml_detail
-            ("The caps for sink(%s) is not configured.", elem->name));
+    dispatch->cb (item, item->info, dispatch->pdata);
+    ml_tensors_data_destroy (item);
 
-      if (sz != map[i].size) {
-        _ml_loge (_ml_detail
-            ("The sink event of [%s] cannot be handled because the tensor dimension mismatches.",
-                elem->name));
+    g_mutex_lock (&dispatch->lock);
+  }
+  detached = dispatch->detached;
+  g_mutex_unlock (&dispatch->lock);
 
-        gst_object_unref (elem->sink);
-        elem->sink = NULL;
-        goto error;
-      }
-    }
+  /* Released in the sink callback, nobody joins this thread. */
+  if (detached) {
+    g_thread_unref (dispatch->thread);
+    _ml_pipeline_sink_dispatch_unref (dispatch);
   }
 
-  /* Create new output info, data handle should be updated here. */
-  _ml_tensors_info_create_from_gst (&_data->info, &gst_info);
+  return NULL;
+}
 
-  /* Iterate e->handles, pass the data to them */
-  for (l = elem->handles; l != NULL; l = l->next) {
-    ml_pipeline_sink_cb callback;
-    ml_pipeline_common_elem *sink = l->data;
-    if (sink->callback_info == NULL)
-      continue;
+/**
+ * @brief Internal function to queue the data to asynchronous sink. This takes the ownership of the data.
+ * @note Do not call this with the lock of element, this may wait for a room of the queue.
+ */
+static void
+_ml_pipeline_sink_dispatch_push (ml_pipeline_sink_dispatch_s * dispatch,
+    ml_tensors_data_h data)
+{
+  ml_tensors_data_h dropped = NULL;
 
-    callback = sink->callback_info->sink_cb;
-    if (callback)
-      callback (_data, _data->info, sink->callback_info->sink_pdata);
+  g_mutex_lock (&dispatch->lock);
 
-    /** @todo Measure time. Warn if it takes long. Kill if it takes too long. */
+  if (g_queue_get_length (&dispatch->queue) >= dispatch->max_size) {
+    switch (dispatch->overflow) {
+      case ML_PIPELINE_SINK_OVERFLOW_DROP_OLDEST:
+        dropped = g_queue_pop_head (&dispatch->queue);
+        dispatch->dropped++;
+        break;
+      case ML_PIPELINE_SINK_OVERFLOW_DROP_NEWEST:
+        dropped = data;
+        data = NULL;
+        dispatch->dropped++;
+        break;
+      case ML_PIPELINE_SINK_OVERFLOW_BLOCK:
+      default:
+        while (dispatch->running &&
+            g_queue_get_length (&dispatch->queue) >= dispatch->max_size)
+          g_cond_wait (&dispatch->cond, &dispatch->lock);
+        break;
+    }
   }
 
-error:
-  g_mutex_unlock (&elem->lock);
+  if (data && !dispatch->running) {
+    dropped = data;
+    data = NULL;
+  }
 
-  for (i = 0; i < num_tensors; i++) {
-    gst_memory_unmap (mem[i], &map[i]);
-    gst_memory_unref (mem[i]);
+  if (data) {
+    g_queue_push_tail (&dispatch->queue, data);
+    g_cond_broadcast (&dispatch->cond);
   }
 
-  _ml_tensors_data_destroy_internal (_data, FALSE);
-  _data = NULL;
+  g_mutex_unlock (&dispatch->lock);
 
-  gst_tensors_info_free (&gst_info);
-  return;
+  if (dropped)
+    ml_tensors_data_destroy (dropped);
 }
 
 /**
- * @brief Handle a appsink element for registered ml_pipeline_sink_cb
+ * @brief Internal function to count the data not delivered to asynchronous sink.
  */
-static GstFlowReturn
-cb_appsink_new_sample (GstElement * e, gpointer user_data)
+static void
+_ml_pipeline_sink_dispatch_drop (ml_pipeline_sink_dispatch_s * dispatch)
 {
-  GstSample *sample;
-  GstBuffer *buffer;
-
-  /* get the sample from appsink */
-  sample = gst_app_sink_pull_sample (GST_APP_SINK (e));
-  buffer = gst_sample_get_buffer (sample);
-
-  cb_sink_event (e, buffer, user_data);
-
-  gst_sample_unref (sample);
-  return GST_FLOW_OK;
+  g_mutex_lock (&dispatch->lock);
+  dispatch->dropped++;
+  g_mutex_unlock (&dispatch->lock);
 }
 
 /**
- * @brief Callback for bus message.
+ * @brief Internal function to stop the worker thread of asynchronous sink. This does not wait for the worker thread.
+ * @note The caller may hold the lock of pipeline, then release the sink with _ml_pipeline_sink_dispatch_free() after unlocking.
  */
 static void
-cb_bus_sync_message (GstBus * bus, GstMessage * message, gpointer user_data)
+_ml_pipeline_sink_dispatch_stop (ml_pipeline_sink_dispatch_s * dispatch)
 {
-  ml_pipeline *pipe_h;
-
-  pipe_h = (ml_pipeline *) user_data;
-
-  if (pipe_h == NULL)
+  if (!dispatch)
     return;
 
-  switch (GST_MESSAGE_TYPE (message)) {
-    case GST_MESSAGE_EOS:
-      pipe_h->isEOS = TRUE;
-      break;
-    case GST_MESSAGE_STATE_CHANGED:
-      if (GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (pipe_h->element)) {
-        GstState old_state, new_state;
+  g_mutex_lock (&dispatch->lock);
+  dispatch->running = FALSE;
+  g_cond_broadcast (&dispatch->cond);
+  g_mutex_unlock (&dispatch->lock);
+}
 
-        gst_message_parse_state_changed (message, &old_state, &new_state, NULL);
-        pipe_h->pipe_state = (ml_pipeline_state_e) new_state;
+/**
+ * @brief Internal function to get the reference of asynchronous sink, to push the data without the lock of element.
+ */
+static ml_pipeline_sink_dispatch_s *
+_ml_pipeline_sink_dispatch_ref (ml_pipeline_sink_dispatch_s * dispatch)
+{
+  g_atomic_int_inc (&dispatch->ref_count);
+  return dispatch;
+}
 
-        _ml_logd (_ml_detail ("The pipeline state changed from %s to %s.",
-                gst_element_state_get_name (old_state),
-                gst_element_state_get_name (new_state)));
+/**
+ * @brief Internal function to release the reference of asynchronous sink. The resources are released with the last reference.
+ */
+static void
+_ml_pipeline_sink_dispatch_unref (ml_pipeline_sink_dispatch_s * dispatch)
+{
+  if (!g_atomic_int_dec_and_test (&dispatch->ref_count))
+    return;
 
-        if (pipe_h->state_cb.cb) {
-          pipe_h->state_cb.cb (pipe_h->pipe_state, pipe_h->state_cb.user_data);
-        }
-      }
-      break;
-    default:
-      break;
-  }
+  g_queue_clear_full (&dispatch->queue,
+      (GDestroyNotify) ml_tensors_data_destroy);
+  g_cond_clear (&dispatch->cond);
+  g_mutex_clear (&dispatch->lock);
+  g_free (dispatch);
 }
 
 /**
- * @brief Clean up each element of the pipeline.
+ * @brief Internal function to stop and release asynchronous sink.
+ * @note This waits for the sink callback running in the worker thread. Do not call this with the lock of pipeline, the sink callback may call the pipeline functions.
  */
 static void
-free_element_handle (gpointer data)
+_ml_pipeline_sink_dispatch_free (ml_pipeline_sink_dispatch_s * dispatch)
 {
-  ml_pipeline_common_elem *item = (ml_pipeline_common_elem *) data;
-  ml_pipeline_element *elem;
+  if (!dispatch)
+    return;
 
-  if (!(item && item->callback_info)) {
-    g_free (item);
+  _ml_pipeline_sink_dispatch_stop (dispatch);
+
+  if (dispatch->thread && dispatch->thread == g_thread_self ()) {
+    /* Called in the sink callback, the worker thread releases itself after the callback. */
+    g_mutex_lock (&dispatch->lock);
+    dispatch->detached = TRUE;
+    g_mutex_unlock (&dispatch->lock);
     return;
   }
 
-  /* clear callbacks */
-  item->callback_info->sink_cb = NULL;
-  elem = item->element;
-  if (elem->type == ML_PIPELINE_ELEMENT_APP_SRC) {
-    GstAppSrcCallbacks appsrc_cb = { 0, };
-    gst_app_src_set_callbacks (GST_APP_SRC (elem->element), &appsrc_cb,
-        NULL, NULL);
-  }
+  if (dispatch->thread)
+    g_thread_join (dispatch->thread);
 
-  g_free (item->callback_info);
-  item->callback_info = NULL;
-  g_free (item);
+  _ml_pipeline_sink_dispatch_unref (dispatch);
 }
 
 /**
- * @brief Private function for ml_pipeline_destroy, cleaning up nodes in namednodes
+ * @brief Internal function to create asynchronous sink with the option.
  */
-static void
-cleanup_node (gpointer data)
+static int
+_ml_pipeline_sink_dispatch_new (const ml_option_h option,
+    ml_pipeline_sink_cb cb, void *pdata,
+    ml_pipeline_sink_dispatch_s ** dispatch)
 {
-  ml_pipeline_element *e = data;
-
-  g_mutex_lock (&e->lock);
-  /** @todo CRITICAL. Stop the handle callbacks if they are running/ready */
-  if (e->handle_id > 0) {
-    g_signal_handler_disconnect (e->element, e->handle_id);
-    e->handle_id = 0;
+  ml_pipeline_sink_dispatch_s *_dispatch;
+  ml_pipeline_sink_overflow_e overflow = ML_PIPELINE_SINK_OVERFLOW_BLOCK;
+  guint64 max_size = ML_PIPELINE_SINK_QUEUE_SIZE_DEFAULT;
+  GError *error = NULL;
+  void *value;
+
+  if (ML_ERROR_NONE == ml_option_get (option, "queue_size", &value)) {
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 1, G_MAXUINT,
+            &max_size, NULL))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'queue_size' (%s) is invalid. It should be a positive integer.",
+          (const gchar *) value);
   }
 
-  /* clear all handles first */
-  if (e->handles)
-    g_list_free_full (e->handles, free_element_handle);
-  e->handles = NULL;
-
-  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC && !e->pipe->isEOS) {
-    int eos_check_cnt = 0;
-
-    /** to push EOS event, the pipeline should be in PAUSED state */
-    gst_element_set_state (e->pipe->element, GST_STATE_PAUSED);
+  if (ML_ERROR_NONE == ml_option_get (option, "overflow", &value)) {
+    const gchar *str = (const gchar *) value;
 
-    if (gst_app_src_end_of_stream (GST_APP_SRC (e->element)) != GST_FLOW_OK) {
-      _ml_logw (_ml_detail
-          ("Cleaning up a pipeline has failed to set End-Of-Stream for the pipeline element of %s",
-              e->name));
-    }
-    g_mutex_unlock (&e->lock);
-    while (!e->pipe->isEOS) {
-      eos_check_cnt++;
-      /** check EOS every 1ms */
-      g_usleep (1000);
-      if (eos_check_cnt >= EOS_MESSAGE_TIME_LIMIT) {
-        _ml_loge (_ml_detail
-            ("Cleaning up a pipeline has requested to set End-Of-Stream. However, the pipeline has not become EOS after the timeout. It has failed to become EOS with the element of %s.",
-                e->name));
-        break;
-      }
+    if (g_ascii_strcasecmp (str, "block") == 0) {
+      overflow = ML_PIPELINE_SINK_OVERFLOW_BLOCK;
+    } else if (g_ascii_strcasecmp (str, "drop-oldest") == 0) {
+      overflow = ML_PIPELINE_SINK_OVERFLOW_DROP_OLDEST;
+    } else if (g_ascii_strcasecmp (str, "drop-newest") == 0) {
+      overflow = ML_PIPELINE_SINK_OVERFLOW_DROP_NEWEST;
+    } else {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The option 'overflow' (%s) is invalid. It should be one of 'block', 'drop-oldest' and 'drop-newest'.",
+          str);
     }
-    g_mutex_lock (&e->lock);
   }
 
-  if (e->custom_destroy) {
-    e->custom_destroy (e->custom_data, e);
+  _dispatch = g_try_new0 (ml_pipeline_sink_dispatch_s, 1);
+  if (!_dispatch)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory for asynchronous sink. Out of memory?");
+
+  g_mutex_init (&_dispatch->lock);
+  g_cond_init (&_dispatch->cond);
+  g_queue_init (&_dispatch->queue);
+  _dispatch->ref_count = 1;
+  _dispatch->max_size = (guint) max_size;
+  _dispatch->overflow = overflow;
+  _dispatch->cb = cb;
+  _dispatch->pdata = pdata;
+  _dispatch->running = TRUE;
+
+  _dispatch->thread = g_thread_try_new ("ml-pipeline-sink",
+      _ml_pipeline_sink_dispatch_thread, _dispatch, &error);
+  if (!_dispatch->thread) {
+    _ml_error_report ("Failed to create the thread for asynchronous sink: %s",
+        error ? error->message : "unknown error");
+    g_clear_error (&error);
+    _ml_pipeline_sink_dispatch_free (_dispatch);
+    return ML_ERROR_STREAMS_PIPE;
   }
 
-  g_free (e->name);
-  if (e->src)
-    gst_object_unref (e->src);
-  if (e->sink)
-    gst_object_unref (e->sink);
-
-  gst_object_unref (e->element);
+  *dispatch = _dispatch;
+  return ML_ERROR_NONE;
+}
 
-  gst_tensors_info_free (&e->tensors_info);
+/**
+ * @brief Pad probe to count the caps events, the cached tensors information is parsed again with new caps.
+ */
+static GstPadProbeReturn
+_ml_pipeline_caps_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_element *elem = user_data;
 
-  g_mutex_unlock (&e->lock);
-  g_mutex_clear (&e->lock);
+  if (GST_EVENT_TYPE (GST_PAD_PROBE_INFO_EVENT (info)) == GST_EVENT_CAPS)
+    g_atomic_int_inc (&elem->caps_version);
 
-  g_free (e);
+  return GST_PAD_PROBE_OK;
 }
 
 /**
- * @brief Private function to release the pipeline resources
+ * @brief Internal function to get the static pad of the element, watching the caps events of the pad.
+ * @note The caller should lock the element.
  */
-static void
-cleanup_resource (gpointer data)
+static GstPad *
+_ml_pipeline_element_get_pad (ml_pipeline_element * elem, const gchar * name)
 {
-  pipeline_resource_s *res = data;
+  GstPad *pad;
 
-  /* check resource type and free data */
-  if (g_str_has_prefix (res->type, "tizen")) {
-    release_tizen_resource (res->handle, res->type);
+  pad = gst_element_get_static_pad (elem->element, name);
+  if (pad) {
+    elem->caps_probe = gst_pad_add_probe (pad,
+        GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM, _ml_pipeline_caps_probe, elem,
+        NULL);
   }
 
-  g_free (res->type);
-  g_free (res);
+  elem->caps_parsed = -1;
+  return pad;
 }
 
 /**
- * @brief Converts predefined element in pipeline description.
+ * @brief Internal function to release the pad from _ml_pipeline_element_get_pad().
+ * @note The caller should lock the element.
  */
-static int
-convert_element (ml_pipeline_h pipe, const gchar * description, gchar ** result,
-    gboolean is_internal)
+static void
+_ml_pipeline_element_release_pad (ml_pipeline_element * elem, GstPad ** pad)
 {
-  gchar *converted;
-  int status = ML_ERROR_NONE;
-
-  g_return_val_if_fail (pipe, ML_ERROR_INVALID_PARAMETER);
-  g_return_val_if_fail (description && result, ML_ERROR_INVALID_PARAMETER);
-
-  /* init null */
-  *result = NULL;
-
-  converted = g_strdup (description);
-
-  /* convert pre-defined element for Tizen */
-  status = convert_tizen_element (pipe, &converted, is_internal);
-
-  if (status == ML_ERROR_NONE) {
-    _ml_logd (_ml_detail
-        ("Pipeline element converted with aliases for gstreamer (Tizen element aliases): %s",
-            converted));
-    *result = converted;
-  } else {
-    g_free (converted);
-    _ml_error_report_continue
-        ("Failed to convert element: convert_tizen_element() returned %d",
-        status);
+  if (*pad) {
+    if (elem->caps_probe > 0)
+      gst_pad_remove_probe (*pad, elem->caps_probe);
+    gst_object_unref (*pad);
+    *pad = NULL;
+    elem->caps_probe = 0;
   }
 
-  return status;
+  elem->caps_parsed = -1;
 }
 
 /**
- * @brief Handle tensor-filter options.
+ * @brief Data structure for the memories of a buffer in the sink callback, which are mapped when the application accesses the tensor.
  */
-static void
-process_tensor_filter_option (ml_pipeline_element * e)
+typedef struct
 {
-  gchar *fw = NULL;
-  gchar *model = NULL;
-  pipe_custom_data_s *custom_data;
-
-  g_object_get (G_OBJECT (e->element), "framework", &fw, "model", &model, NULL);
+  GstMemory *mem[ML_TENSOR_SIZE_LIMIT]; /**< The memories of the buffer */
+  GstMapInfo map[ML_TENSOR_SIZE_LIMIT]; /**< The map info of the memories */
+  gboolean mapped[ML_TENSOR_SIZE_LIMIT]; /**< TRUE if the memory is mapped */
+  gsize hsize[ML_TENSOR_SIZE_LIMIT]; /**< The header size of flexible tensor */
+} ml_pipeline_sink_lazy_map_s;
 
-  if (fw && g_ascii_strcasecmp (fw, "custom-easy") == 0) {
-    /* ref to tensor-filter custom-easy handle. */
-    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_FILTER, model);
-    if (custom_data) {
-      ml_pipeline_custom_filter_ref (custom_data->handle);
+/**
+ * @brief Internal function to map the nth memory of the buffer in the sink callback.
+ */
+static gboolean
+_ml_pipeline_sink_lazy_map (ml_pipeline_sink_lazy_map_s * lazy, guint index)
+{
+  if (!lazy->mapped[index]) {
+    if (!lazy->mem[index] ||
+        !gst_memory_map (lazy->mem[index], &lazy->map[index], GST_MAP_READ))
+      return FALSE;
 
-      e->custom_destroy = pipe_custom_destroy_cb;
-      e->custom_data = custom_data;
-    }
+    lazy->mapped[index] = TRUE;
   }
 
-  g_free (fw);
-  g_free (model);
+  return TRUE;
 }
 
 /**
- * @brief Handle tensor-if options.
+ * @brief Internal function to map the buffer of a tensor when the application accesses the tensor in the sink callback.
  */
-static void
-process_tensor_if_option (ml_pipeline_element * e)
+static int
+_ml_pipeline_sink_data_map (ml_tensors_data_h data, unsigned int index,
+    void *map_data)
 {
-  gint cv = 0;
-  gchar *cv_option = NULL;
-  pipe_custom_data_s *custom_data;
-
-  g_object_get (G_OBJECT (e->element), "compared-value", &cv,
-      "compared-value-option", &cv_option, NULL);
-
-  if (cv == 5) {
-    /* cv is TIFCV_CUSTOM, ref to tensor-if custom handle. */
-    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_IF, cv_option);
-    if (custom_data) {
-      ml_pipeline_if_custom_ref (custom_data->handle);
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  ml_pipeline_sink_lazy_map_s *lazy = (ml_pipeline_sink_lazy_map_s *) map_data;
 
-      e->custom_destroy = pipe_custom_destroy_cb;
-      e->custom_data = custom_data;
-    }
-  }
+  if (!_ml_pipeline_sink_lazy_map (lazy, index))
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to map the %u'th tensor of the sink data.", index);
 
-  g_free (cv_option);
+  _data->tensors[index].data = lazy->map[index].data + lazy->hsize[index];
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Initializes the GStreamer library. This is internal function.
+ * @brief Internal function to check the sink element has registered callbacks.
+ * @note The caller should lock the element.
  */
-int
-_ml_initialize_gstreamer (void)
+static gboolean
+_ml_pipeline_sink_has_callbacks (ml_pipeline_element * elem)
 {
-  GError *err = NULL;
+  ml_pipeline_common_elem *sink;
+  GList *l;
 
-  if (!gst_init_check (NULL, NULL, &err)) {
-    if (err) {
-      _ml_error_report
-          ("Initrializing ML-API failed: GStreamer has the following error from gst_init_check(): %s",
-          err->message);
-      g_clear_error (&err);
-    } else {
-      _ml_error_report ("Cannot initialize GStreamer. Unknown reason.");
-    }
+  for (l = elem->handles; l != NULL; l = l->next) {
+    sink = (ml_pipeline_common_elem *) l->data;
 
-    return ML_ERROR_STREAMS_PIPE;
+    if (sink->callback_info && sink->callback_info->sink_cb)
+      return TRUE;
   }
 
-  return ML_ERROR_NONE;
+  return FALSE;
 }
 
 /**
- * @brief Checks the element is registered and available on the pipeline.
+ * @brief Handle a sink element for registered ml_pipeline_sink_cb
  */
-int
-ml_check_element_availability (const char *element_name, bool *available)
+static void
+cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
 {
-  GstElementFactory *factory;
+  ml_pipeline_element *elem = user_data;
+
+  /** @todo CRITICAL if the pipeline is being killed, don't proceed! */
+  ml_pipeline_sink_lazy_map_s lazy;
+  guint i, num_tensors = 0;
+  GList *l;
+  ml_tensors_data_s *_data = NULL;
+  GstTensorsInfo gst_info;
+  const GstTensorsInfo *data_info;
+  GSList *pending = NULL;
+  ml_pipeline_sink_pending_s *item;
   int status;
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+  ml_trace (pipeline_sink_enter, elem, elem->pipe, gst_buffer_get_size (b));
 
-  if (!element_name)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, element_name, is NULL. It should be a name (string) to be queried if it exists as a GStreamer/NNStreamer element.");
+  gst_tensors_info_init (&gst_info);
 
-  if (!available)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, available, is NULL. It should be a valid pointer to a bool entry so that the API (ml_check_element_availability) may return the queried result via \"available\" parameter. E.g., bool available; ml_check_element_availability (\"tensor_converter\", &available);");
+  g_mutex_lock (&elem->lock);
 
-  _ml_error_report_return_continue_iferr (_ml_initialize_gstreamer (),
-      "Internal error of _ml_initialize_gstreamer(). Check the availability of gstreamer libraries in your system.");
+  /* Nothing to do if the callbacks are unregistered. */
+  if (!_ml_pipeline_sink_has_callbacks (elem))
+    goto error;
 
-  /* init false */
-  *available = false;
+  /* The memories are mapped when the application accesses the tensor. */
+  memset (&lazy, 0, sizeof (lazy));
+  gst_info.num_tensors = num_tensors = gst_tensor_buffer_get_count (b);
 
-  factory = gst_element_factory_find (element_name);
-  if (factory) {
-    GstPluginFeature *feature = GST_PLUGIN_FEATURE (factory);
-    const gchar *plugin_name = gst_plugin_feature_get_plugin_name (feature);
+  for (i = 0; i < num_tensors; i++)
+    lazy.mem[i] = gst_tensor_buffer_get_nth_memory (b, i);
 
-    /* check restricted element */
-    status = _ml_check_plugin_availability (plugin_name, element_name);
-    if (status == ML_ERROR_NONE)
-      *available = true;
+  /* Get the sink-pad-cap, parse it again only if new caps is received. */
+  if (elem->sink == NULL)
+    elem->sink = _ml_pipeline_element_get_pad (elem, "sink");
 
-    gst_object_unref (factory);
+  if (elem->sink &&
+      elem->caps_parsed != g_atomic_int_get (&elem->caps_version)) {
+    gboolean found = FALSE;
+    gboolean flexible = FALSE;
+    gint version = g_atomic_int_get (&elem->caps_version);
+
+    /* sinkpadcap available (negotiated) */
+    GstCaps *caps = gst_pad_get_current_caps (elem->sink);
+
+    if (caps) {
+      found = get_tensors_info_from_caps (caps, &elem->tensors_info,
+          &flexible);
+      gst_caps_unref (caps);
+    }
+
+    if (found) {
+      elem->is_flexible_tensor = flexible;
+      elem->caps_parsed = version;
+    } else {
+      elem->caps_parsed = -1;
+    }
   }
 
-  return ML_ERROR_NONE;
-}
+  if (elem->caps_parsed < 0) {
+    /* It is not valid */
+    _ml_pipeline_element_release_pad (elem, &elem->sink);
+    goto error;
+  }
 
-/**
- * @brief Checks the availability of the plugin.
- */
-int
-_ml_check_plugin_availability (const char *plugin_name,
-    const char *element_name)
-{
-  static gboolean list_loaded = FALSE;
-  static gchar **allowed_elements = NULL;
+  /* Prepare output and set data. */
+  if (elem->is_flexible_tensor) {
+    GstTensorMetaInfo meta;
 
-  if (!plugin_name)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, plugin_name, is NULL. It should be a valid string.");
+    /* handle header for flex tensor, the header should be mapped to get the information. */
+    for (i = 0; i < num_tensors; i++) {
+      if (!_ml_pipeline_sink_lazy_map (&lazy, i)) {
+        _ml_loge (_ml_detail
+            ("Failed to map the output in sink '%s' callback, which is registered by ml_pipeline_sink_register ()",
+                elem->name));
+        goto error;
+      }
 
-  if (!element_name)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, element_name, is NULL. It should be a valid string.");
+      gst_tensor_meta_info_parse_header (&meta, lazy.map[i].data);
+      lazy.hsize[i] = gst_tensor_meta_info_get_header_size (&meta);
 
-  if (!list_loaded) {
-    gboolean restricted;
+      gst_tensor_meta_info_convert (&meta,
+          gst_tensors_info_get_nth_info (&gst_info, i));
+    }
 
-    restricted =
-        nnsconf_get_custom_value_bool ("element-restriction",
-        "enable_element_restriction", FALSE);
-    if (restricted) {
-      gchar *elements;
+    data_info = &gst_info;
+  } else {
+    data_info = &elem->tensors_info;
 
-      /* check white-list of available plugins */
-      elements =
-          nnsconf_get_custom_value_string ("element-restriction",
-          "allowed_elements");
-      if (elements) {
-        allowed_elements = g_strsplit_set (elements, " ,;", -1);
-        g_free (elements);
-      }
+    /* Compare output info and buffer if gst-buffer is not flexible. */
+    if (data_info->num_tensors != num_tensors) {
+      _ml_loge (_ml_detail
+          ("The sink event of [%s] cannot be handled because the number of tensors mismatches.",
+              elem->name));
+
+      elem->caps_parsed = -1;
+      goto error;
     }
 
-    list_loaded = TRUE;
-  }
+    for (i = 0; i < num_tensors; i++) {
+      size_t sz = gst_tensors_info_get_size (data_info, i);
 
-  /* nnstreamer elements */
-  if (g_str_has_prefix (plugin_name, "nnstreamer") &&
-      g_str_has_prefix (element_name, "tensor_")) {
-    return ML_ERROR_NONE;
-  }
+      /* Not configured, yet. */
+      if (sz == 0)
+        _ml_loge (_ml_detail
+            ("The caps for sink(%s) is not configured.", elem->name));
 
-  if (allowed_elements &&
-      find_key_strv ((const gchar **) allowed_elements, element_name) < 0) {
-    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
-        "The element %s is restricted.", element_name);
+      if (sz != gst_memory_get_sizes (lazy.mem[i], NULL, NULL)) {
+        _ml_loge (_ml_detail
+            ("The sink event of [%s] cannot be handled because the tensor dimension mismatches.",
+                elem->name));
+
+        elem->caps_parsed = -1;
+        goto error;
+      }
+    }
   }
 
-  return ML_ERROR_NONE;
-}
+  /* Set tensor data. The data handle is reused in this thread, not to allocate memory in every buffer. */
+  status = _ml_tensors_data_acquire_temp (data_info,
+      (ml_tensors_data_h *) & _data);
+  if (status != ML_ERROR_NONE) {
+    _ml_loge (_ml_detail
+        ("Failed to allocate memory for tensors data in sink callback, which is registered by ml_pipeline_sink_register ()."));
+    goto error;
+  }
 
-/**
- * @brief Get the ml_pipeline_element_e type from its element name
- */
-static ml_pipeline_element_e
-get_elem_type_from_name (GHashTable * table, const gchar * name)
-{
-  gpointer value = g_hash_table_lookup (table, name);
-  if (!value)
-    return ML_PIPELINE_ELEMENT_UNKNOWN;
+  for (i = 0; i < num_tensors; i++) {
+    _data->tensors[i].data = lazy.mapped[i] ?
+        lazy.map[i].data + lazy.hsize[i] : NULL;
+    _data->tensors[i].size =
+        gst_memory_get_sizes (lazy.mem[i], NULL, NULL) - lazy.hsize[i];
+  }
 
-  return GPOINTER_TO_INT (value);
-}
+  /* The memory of a tensor is mapped only if the tensor is accessed in the callbacks. */
+  _data->map = _ml_pipeline_sink_data_map;
+  _data->map_data = &lazy;
 
-/**
- * @brief Iterate elements and prepare element handle.
- */
-static int
-iterate_element (ml_pipeline * pipe_h, GstElement * pipeline,
-    gboolean is_internal)
-{
-  GstIterator *it = NULL;
-  int status = ML_ERROR_NONE;
+  /* The buffer is retained only if the data is referred in the callbacks. */
+  _data->retain = _ml_pipeline_sink_data_retain;
+  _data->retain_data = b;
 
-  g_return_val_if_fail (pipe_h && pipeline, ML_ERROR_INVALID_PARAMETER);
+  /* Account the pipeline buffers while the sink callbacks hold them. */
+  _ml_tensors_data_account (_data, ML_MEMORY_ORIGIN_PIPELINE_SINK, FALSE);
 
-  g_mutex_lock (&pipe_h->lock);
+  /* Iterate e->handles, pass the data to them */
+  for (l = elem->handles; l != NULL; l = l->next) {
+    ml_pipeline_sink_cb callback;
+    ml_pipeline_common_elem *sink = l->data;
+    if (sink->callback_info == NULL)
+      continue;
 
-  it = gst_bin_iterate_elements (GST_BIN (pipeline));
-  if (it != NULL) {
+    /**
+     * Queue the data holding the buffer, the worker thread calls the callback.
+     * The queue may block the streaming thread, so the data is pushed after unlocking the element.
+     */
+    if (sink->callback_info->dispatch) {
+      ml_tensors_data_h retained;
+
+      if (ml_tensors_data_ref (_data, &retained) == ML_ERROR_NONE) {
+        item = g_new0 (ml_pipeline_sink_pending_s, 1);
+        item->dispatch =
+            _ml_pipeline_sink_dispatch_ref (sink->callback_info->dispatch);
+        item->data = retained;
+        pending = g_slist_prepend (pending, item);
+      } else {
+        _ml_logw (_ml_detail
+            ("Failed to retain the sink data of %s, the data is dropped.",
+                elem->name));
+        _ml_pipeline_sink_dispatch_drop (sink->callback_info->dispatch);
+      }
+      continue;
+    }
+
+    callback = sink->callback_info->sink_cb;
+    if (callback)
+      callback (_data, _data->info, sink->callback_info->sink_pdata);
+
+    /** @todo Measure time. Warn if it takes long. Kill if it takes too long. */
+  }
+
+error:
+  g_mutex_unlock (&elem->lock);
+
+  pending = g_slist_reverse (pending);
+  while (pending) {
+    item = (ml_pipeline_sink_pending_s *) pending->data;
+    pending = g_slist_delete_link (pending, pending);
+
+    _ml_pipeline_sink_dispatch_push (item->dispatch, item->data);
+    _ml_pipeline_sink_dispatch_unref (item->dispatch);
+    g_free (item);
+  }
+
+  if (_data) {
+    _ml_tensors_data_release_temp (_data);
+    _data = NULL;
+  }
+
+  for (i = 0; i < num_tensors; i++) {
+    if (lazy.mapped[i])
+      gst_memory_unmap (lazy.mem[i], &lazy.map[i]);
+    if (lazy.mem[i])
+      gst_memory_unref (lazy.mem[i]);
+  }
+
+  gst_tensors_info_free (&gst_info);
+  ml_trace (pipeline_sink_exit, elem, elem->pipe);
+  return;
+}
+
+/**
+ * @brief Handle a appsink element for registered ml_pipeline_sink_cb
+ */
+static GstFlowReturn
+cb_appsink_new_sample (GstElement * e, gpointer user_data)
+{
+  GstSample *sample;
+  GstBuffer *buffer;
+
+  /* get the sample from appsink */
+  sample = gst_app_sink_pull_sample (GST_APP_SINK (e));
+  buffer = gst_sample_get_buffer (sample);
+
+  cb_sink_event (e, buffer, user_data);
+
+  gst_sample_unref (sample);
+  return GST_FLOW_OK;
+}
+
+/**
+ * @brief Callback for bus message.
+ */
+static void
+cb_bus_sync_message (GstBus * bus, GstMessage * message, gpointer user_data)
+{
+  ml_pipeline *pipe_h;
+
+  pipe_h = (ml_pipeline *) user_data;
+
+  if (pipe_h == NULL)
+    return;
+
+  switch (GST_MESSAGE_TYPE (message)) {
+    case GST_MESSAGE_EOS:
+      pipe_h->isEOS = TRUE;
+      break;
+    case GST_MESSAGE_STATE_CHANGED:
+      if (GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (pipe_h->element)) {
+        GstState old_state, new_state;
+
+        gst_message_parse_state_changed (message, &old_state, &new_state, NULL);
+
+        g_mutex_lock (&pipe_h->state_lock);
+        pipe_h->pipe_state = (ml_pipeline_state_e) new_state;
+        g_cond_broadcast (&pipe_h->state_cond);
+        g_mutex_unlock (&pipe_h->state_lock);
+
+        _ml_logd (_ml_detail ("The pipeline state changed from %s to %s.",
+                gst_element_state_get_name (old_state),
+                gst_element_state_get_name (new_state)));
+
+        if (pipe_h->state_cb.cb) {
+          pipe_h->state_cb.cb (pipe_h->pipe_state, pipe_h->state_cb.user_data);
+        }
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Clean up each element of the pipeline.
+ */
+static void
+free_element_handle (gpointer data)
+{
+  ml_pipeline_common_elem *item = (ml_pipeline_common_elem *) data;
+  ml_pipeline_element *elem;
+
+  if (!(item && item->callback_info)) {
+    g_free (item);
+    return;
+  }
+
+  /* clear callbacks */
+  item->callback_info->sink_cb = NULL;
+  _ml_pipeline_sink_dispatch_free (item->callback_info->dispatch);
+  item->callback_info->dispatch = NULL;
+  elem = item->element;
+  if (elem->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+    GstAppSrcCallbacks appsrc_cb = { 0, };
+    gst_app_src_set_callbacks (GST_APP_SRC (elem->element), &appsrc_cb,
+        NULL, NULL);
+  }
+
+  g_free (item->callback_info);
+  item->callback_info = NULL;
+  g_free (item);
+}
+
+/**
+ * @brief Private function for ml_pipeline_destroy, cleaning up nodes in namednodes
+ */
+static void
+cleanup_node (gpointer data)
+{
+  ml_pipeline_element *e = data;
+
+  g_mutex_lock (&e->lock);
+  /** @todo CRITICAL. Stop the handle callbacks if they are running/ready */
+  if (e->handle_id > 0) {
+    g_signal_handler_disconnect (e->element, e->handle_id);
+    e->handle_id = 0;
+  }
+
+  /* clear all handles first */
+  if (e->handles)
+    g_list_free_full (e->handles, free_element_handle);
+  e->handles = NULL;
+
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC && !e->pipe->isEOS) {
+    int eos_check_cnt = 0;
+
+    /** to push EOS event, the pipeline should be in PAUSED state */
+    gst_element_set_state (e->pipe->element, GST_STATE_PAUSED);
+
+    if (gst_app_src_end_of_stream (GST_APP_SRC (e->element)) != GST_FLOW_OK) {
+      _ml_logw (_ml_detail
+          ("Cleaning up a pipeline has failed to set End-Of-Stream for the pipeline element of %s",
+              e->name));
+    }
+    g_mutex_unlock (&e->lock);
+    while (!e->pipe->isEOS) {
+      eos_check_cnt++;
+      /** check EOS every 1ms */
+      g_usleep (1000);
+      if (eos_check_cnt >= EOS_MESSAGE_TIME_LIMIT) {
+        _ml_loge (_ml_detail
+            ("Cleaning up a pipeline has requested to set End-Of-Stream. However, the pipeline has not become EOS after the timeout. It has failed to become EOS with the element of %s.",
+                e->name));
+        break;
+      }
+    }
+    g_mutex_lock (&e->lock);
+  }
+
+  if (e->custom_destroy) {
+    e->custom_destroy (e->custom_data, e);
+  }
+
+  _ml_pipeline_src_flow_release (e);
+  _ml_pipeline_sink_pull_release (e);
+
+  g_free (e->name);
+  _ml_pipeline_element_release_pad (e, &e->src);
+  _ml_pipeline_element_release_pad (e, &e->sink);
+
+  gst_object_unref (e->element);
+
+  gst_tensors_info_free (&e->tensors_info);
+  _ml_pipeline_src_pool_release (e);
+
+  g_mutex_unlock (&e->lock);
+  g_mutex_clear (&e->lock);
+  g_mutex_clear (&e->flow_lock);
+  g_cond_clear (&e->flow_cond);
+
+  g_free (e);
+}
+
+/**
+ * @brief Private function to release the pipeline resources
+ */
+static void
+cleanup_resource (gpointer data)
+{
+  pipeline_resource_s *res = data;
+
+  /* check resource type and free data */
+  if (g_str_has_prefix (res->type, "tizen")) {
+    release_tizen_resource (res->handle, res->type);
+  }
+
+  g_free (res->type);
+  g_free (res);
+}
+
+/**
+ * @brief Converts predefined element in pipeline description.
+ */
+static int
+convert_element (ml_pipeline_h pipe, const gchar * description, gchar ** result,
+    gboolean is_internal)
+{
+  gchar *converted;
+  int status = ML_ERROR_NONE;
+
+  g_return_val_if_fail (pipe, ML_ERROR_INVALID_PARAMETER);
+  g_return_val_if_fail (description && result, ML_ERROR_INVALID_PARAMETER);
+
+  /* init null */
+  *result = NULL;
+
+  converted = g_strdup (description);
+
+  /* convert pre-defined element for Tizen */
+  status = convert_tizen_element (pipe, &converted, is_internal);
+
+  if (status == ML_ERROR_NONE) {
+    _ml_logd (_ml_detail
+        ("Pipeline element converted with aliases for gstreamer (Tizen element aliases): %s",
+            converted));
+    *result = converted;
+  } else {
+    g_free (converted);
+    _ml_error_report_continue
+        ("Failed to convert element: convert_tizen_element() returned %d",
+        status);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Handle tensor-filter options.
+ */
+static void
+process_tensor_filter_option (ml_pipeline_element * e)
+{
+  gchar *fw = NULL;
+  gchar *model = NULL;
+  pipe_custom_data_s *custom_data;
+
+  g_object_get (G_OBJECT (e->element), "framework", &fw, "model", &model, NULL);
+
+  if (fw && g_ascii_strcasecmp (fw, "custom-easy") == 0) {
+    /* ref to tensor-filter custom-easy handle. */
+    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_FILTER, model);
+    if (custom_data) {
+      ml_pipeline_custom_filter_ref (custom_data->handle);
+
+      e->custom_destroy = pipe_custom_destroy_cb;
+      e->custom_data = custom_data;
+    }
+  }
+
+  g_free (fw);
+  g_free (model);
+}
+
+/**
+ * @brief Handle tensor-if options.
+ */
+static void
+process_tensor_if_option (ml_pipeline_element * e)
+{
+  gint cv = 0;
+  gchar *cv_option = NULL;
+  pipe_custom_data_s *custom_data;
+
+  g_object_get (G_OBJECT (e->element), "compared-value", &cv,
+      "compared-value-option", &cv_option, NULL);
+
+  if (cv == 5) {
+    /* cv is TIFCV_CUSTOM, ref to tensor-if custom handle. */
+    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_IF, cv_option);
+    if (custom_data) {
+      ml_pipeline_if_custom_ref (custom_data->handle);
+
+      e->custom_destroy = pipe_custom_destroy_cb;
+      e->custom_data = custom_data;
+    }
+  }
+
+  g_free (cv_option);
+}
+
+/**
+ * @brief Initializes the GStreamer library. This is internal function.
+ */
+int
+_ml_initialize_gstreamer (void)
+{
+  GError *err = NULL;
+
+  if (!gst_init_check (NULL, NULL, &err)) {
+    if (err) {
+      _ml_error_report
+          ("Initrializing ML-API failed: GStreamer has the following error from gst_init_check(): %s",
+          err->message);
+      g_clear_error (&err);
+    } else {
+      _ml_error_report ("Cannot initialize GStreamer. Unknown reason.");
+    }
+
+    return ML_ERROR_STREAMS_PIPE;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Checks the element is registered and available on the pipeline.
+ */
+int
+ml_check_element_availability (const char *element_name, bool *available)
+{
+  GstElementFactory *factory;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!element_name)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, element_name, is NULL. It should be a name (string) to be queried if it exists as a GStreamer/NNStreamer element.");
+
+  if (!available)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, available, is NULL. It should be a valid pointer to a bool entry so that the API (ml_check_element_availability) may return the queried result via \"available\" parameter. E.g., bool available; ml_check_element_availability (\"tensor_converter\", &available);");
+
+  _ml_error_report_return_continue_iferr (_ml_initialize_gstreamer (),
+      "Internal error of _ml_initialize_gstreamer(). Check the availability of gstreamer libraries in your system.");
+
+  /* init false */
+  *available = false;
+
+  factory = gst_element_factory_find (element_name);
+  if (factory) {
+    GstPluginFeature *feature = GST_PLUGIN_FEATURE (factory);
+    const gchar *plugin_name = gst_plugin_feature_get_plugin_name (feature);
+
+    /* check restricted element */
+    status = _ml_check_plugin_availability (plugin_name, element_name);
+    if (status == ML_ERROR_NONE)
+      *available = true;
+
+    gst_object_unref (factory);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Checks the availability of the plugin.
+ */
+int
+_ml_check_plugin_availability (const char *plugin_name,
+    const char *element_name)
+{
+  static gboolean list_loaded = FALSE;
+  static gchar **allowed_elements = NULL;
+
+  if (!plugin_name)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, plugin_name, is NULL. It should be a valid string.");
+
+  if (!element_name)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, element_name, is NULL. It should be a valid string.");
+
+  if (!list_loaded) {
+    gboolean restricted;
+
+    restricted =
+        nnsconf_get_custom_value_bool ("element-restriction",
+        "enable_element_restriction", FALSE);
+    if (restricted) {
+      gchar *elements;
+
+      /* check white-list of available plugins */
+      elements =
+          nnsconf_get_custom_value_string ("element-restriction",
+          "allowed_elements");
+      if (elements) {
+        allowed_elements = g_strsplit_set (elements, " ,;", -1);
+        g_free (elements);
+      }
+    }
+
+    list_loaded = TRUE;
+  }
+
+  /* nnstreamer elements */
+  if (g_str_has_prefix (plugin_name, "nnstreamer") &&
+      g_str_has_prefix (element_name, "tensor_")) {
+    return ML_ERROR_NONE;
+  }
+
+  if (allowed_elements &&
+      find_key_strv ((const gchar **) allowed_elements, element_name) < 0) {
+    _ml_error_report_return (ML_ERROR_NOT_SUPPORTED,
+        "The element %s is restricted.", element_name);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Get the ml_pipeline_element_e type from its element name
+ */
+static ml_pipeline_element_e
+get_elem_type_from_name (GHashTable * table, const gchar * name)
+{
+  gpointer value = g_hash_table_lookup (table, name);
+  if (!value)
+    return ML_PIPELINE_ELEMENT_UNKNOWN;
+
+  return GPOINTER_TO_INT (value);
+}
+
+/**
+ * @brief Iterate elements and prepare element handle.
+ */
+static int
+iterate_element (ml_pipeline * pipe_h, GstElement * pipeline,
+    gboolean is_internal)
+{
+  GstIterator *it = NULL;
+  int status = ML_ERROR_NONE;
+
+  g_return_val_if_fail (pipe_h && pipeline, ML_ERROR_INVALID_PARAMETER);
+
+  g_mutex_lock (&pipe_h->lock);
+
+  it = gst_bin_iterate_elements (GST_BIN (pipeline));
+  if (it != NULL) {
     gboolean done = FALSE;
     GValue item = G_VALUE_INIT;
     GObject *obj;
     gchar *name;
 
-    /* Fill in the hashtable, "namednodes" with named Elements */
-    while (!done) {
-      switch (gst_iterator_next (it, &item)) {
-        case GST_ITERATOR_OK:
-          obj = g_value_get_object (&item);
+    /* Fill in the hashtable, "namednodes" with named Elements */
+    while (!done) {
+      switch (gst_iterator_next (it, &item)) {
+        case GST_ITERATOR_OK:
+          obj = g_value_get_object (&item);
+
+          if (GST_IS_ELEMENT (obj)) {
+            GstElement *elem = GST_ELEMENT (obj);
+            GstPluginFeature *feature =
+                GST_PLUGIN_FEATURE (gst_element_get_factory (elem));
+            const gchar *plugin_name =
+                gst_plugin_feature_get_plugin_name (feature);
+            const gchar *element_name = gst_plugin_feature_get_name (feature);
+
+            /* validate the availability of the plugin */
+            if (!is_internal && _ml_check_plugin_availability (plugin_name,
+                    element_name) != ML_ERROR_NONE) {
+              _ml_error_report_continue
+                  ("There is a pipeline element (filter) that is not allowed for applications via ML-API (privilege not granted) or now available: '%s'/'%s'.",
+                  plugin_name, element_name);
+              status = ML_ERROR_NOT_SUPPORTED;
+              done = TRUE;
+              break;
+            }
+
+            name = gst_element_get_name (elem);
+            if (name != NULL) {
+              ml_pipeline_element_e element_type =
+                  get_elem_type_from_name (pipe_h->pipe_elm_type, element_name);
+
+              /* check 'sync' property in sink element */
+              if (element_type == ML_PIPELINE_ELEMENT_SINK ||
+                  element_type == ML_PIPELINE_ELEMENT_APP_SINK) {
+                gboolean sync = FALSE;
+
+                g_object_get (G_OBJECT (elem), "sync", &sync, NULL);
+                if (sync) {
+                  _ml_logw (_ml_detail
+                      ("It is recommended to apply 'sync=false' property to a sink element in most AI applications. Otherwise, inference results of large neural networks will be frequently dropped by the synchronization mechanism at the sink element."));
+                }
+              }
+
+              if (element_type != ML_PIPELINE_ELEMENT_UNKNOWN) {
+                ml_pipeline_element *e;
+
+                e = construct_element (gst_object_ref (elem), pipe_h, name,
+                    element_type);
+                if (e != NULL) {
+                  if (g_str_equal (element_name, "tensor_if"))
+                    process_tensor_if_option (e);
+                  else if (g_str_equal (element_name, "tensor_filter"))
+                    process_tensor_filter_option (e);
+
+                  g_hash_table_insert (pipe_h->namednodes, g_strdup (name), e);
+                } else {
+                  /* allocation failure */
+                  gst_object_unref (elem);
+                  _ml_error_report_continue
+                      ("Cannot allocate memory with construct_element().");
+                  status = ML_ERROR_OUT_OF_MEMORY;
+                  done = TRUE;
+                }
+              }
+
+              g_free (name);
+            }
+          }
+
+          g_value_reset (&item);
+          break;
+        case GST_ITERATOR_RESYNC:
+        case GST_ITERATOR_ERROR:
+          _ml_logw (_ml_detail
+              ("There is an error or a resync-event while inspecting a pipeline. However, we can still execute the pipeline."));
+          /* fallthrough */
+        case GST_ITERATOR_DONE:
+          done = TRUE;
+      }
+    }
+
+    g_value_unset (&item);
+    /** @todo CRITICAL check the validity of elem=item registered in e */
+    gst_iterator_free (it);
+  }
+
+  g_mutex_unlock (&pipe_h->lock);
+  return status;
+}
+
+/**
+ * @brief Internal function to create the hash table for managing internal resources
+ */
+static void
+create_internal_hash (ml_pipeline * pipe_h)
+{
+  pipe_h->namednodes =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_node);
+  pipe_h->resources =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_resource);
+
+  pipe_h->pipe_elm_type =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_sink"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SINK));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("appsrc"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_APP_SRC));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("appsink"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_APP_SINK));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("valve"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_VALVE));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("input-selector"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SWITCH_INPUT));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("output-selector"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SWITCH_OUTPUT));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_if"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_COMMON));
+  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_filter"),
+      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_COMMON));
+}
+
+/**
+ * @brief Internal function to construct the pipeline.
+ * If is_internal is true, this will ignore the permission in Tizen.
+ */
+static int
+construct_pipeline_internal (const char *pipeline_description,
+    const ml_option_h option, ml_pipeline_state_cb cb, void *user_data,
+    ml_pipeline_h * pipe, gboolean is_internal)
+{
+  GError *err = NULL;
+  GstElement *pipeline;
+  gchar *description = NULL;
+  int status = ML_ERROR_NONE;
+
+  ml_pipeline *pipe_h;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!pipe)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "ml_pipeline_construct error: parameter pipe is NULL. It should be a valid ml_pipeline_h pointer. E.g., ml_pipeline_h pipe; ml_pipeline_construct (..., &pip);");
+
+  if (!pipeline_description)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "ml_pipeline_construct error: parameter pipeline_description is NULL. It should be a valid string of Gstreamer/NNStreamer pipeline description.");
+
+  /* init null */
+  *pipe = NULL;
+
+  _ml_error_report_return_continue_iferr (_ml_initialize_gstreamer (),
+      "ml_pipeline_construct error: it has failed to initialize gstreamer(). Please check if you have a valid GStreamer library installed in your system.");
+
+  /* prepare pipeline handle */
+  pipe_h = g_new0 (ml_pipeline, 1);
+  if (pipe_h == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "ml_pipeline_construct error: failed to allocate memory for pipeline handle. Out of memory?");
+
+  g_mutex_init (&pipe_h->lock);
+  g_mutex_init (&pipe_h->state_lock);
+  g_cond_init (&pipe_h->state_cond);
+
+  pipe_h->isEOS = FALSE;
+  pipe_h->pipe_state = ML_PIPELINE_STATE_UNKNOWN;
+
+  create_internal_hash (pipe_h);
+
+  /* convert predefined element and launch the pipeline */
+  status =
+      convert_element ((ml_pipeline_h) pipe_h, pipeline_description,
+      &description, is_internal);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("ml_pipeline_construct error: failed while converting pipeline description for GStreamer w/ convert_element() function, which has returned %d",
+        status);
+    goto failed;
+  }
+
+  pipeline = gst_parse_launch (description, &err);
+  g_free (description);
+
+  if (pipeline == NULL || err) {
+    _ml_error_report
+        ("ml_pipeline_construct error: gst_parse_launch cannot parse and launch the given pipeline = [%s]. The error message from gst_parse_launch is '%s'.",
+        pipeline_description, (err) ? err->message : "unknown reason");
+    g_clear_error (&err);
+
+    if (pipeline)
+      gst_object_unref (pipeline);
+
+    status = ML_ERROR_STREAMS_PIPE;
+    goto failed;
+  }
+
+  g_assert (GST_IS_PIPELINE (pipeline));
+  pipe_h->element = pipeline;
+
+  /* replicate tensor_filter before preparing the element handles */
+  status = _ml_pipeline_parallel_new (pipeline, option, &pipe_h->parallel);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("ml_pipeline_construct error: failed to replicate tensor_filter with the given option.");
+    goto failed;
+  }
+
+  /* bus and message callback */
+  pipe_h->bus = gst_element_get_bus (pipeline);
+  g_assert (pipe_h->bus);
+
+  gst_bus_enable_sync_message_emission (pipe_h->bus);
+  pipe_h->signal_msg = g_signal_connect (pipe_h->bus, "sync-message",
+      G_CALLBACK (cb_bus_sync_message), pipe_h);
+
+  /* state change callback */
+  pipe_h->state_cb.cb = cb;
+  pipe_h->state_cb.user_data = user_data;
+
+  /* iterate elements and prepare element handle */
+  status = iterate_element (pipe_h, pipeline, is_internal);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue ("ml_pipeline_construct error: ...");
+    goto failed;
+  }
+
+  /* finally set pipeline state to PAUSED */
+  status = ml_pipeline_stop ((ml_pipeline_h) pipe_h);
+
+  if (status == ML_ERROR_NONE) {
+    /**
+     * Let's wait until the pipeline state is changed to paused.
+     * Otherwise, the following APIs like 'set_property' may incur
+     * unintended behaviors. But, don't need to return any error
+     * even if this state change is not finished within the timeout,
+     * just replying on the caller.
+     */
+    gst_element_get_state (pipeline, NULL, NULL, 10 * GST_MSECOND);
+  } else {
+    _ml_error_report_continue
+        ("ml_pipeline_construct error: ml_pipeline_stop has failed with %d return. The pipeline should be able to be stopped when it is constructed.",
+        status);
+  }
+
+failed:
+  if (status != ML_ERROR_NONE) {
+    /* failed to construct the pipeline */
+    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
+  } else {
+    *pipe = pipe_h;
+  }
+
+  return status;
+}
+
+/**
+ * @brief Construct the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_construct (const char *pipeline_description,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+{
+  /* not an internal pipeline construction */
+  return construct_pipeline_internal (pipeline_description, NULL, cb,
+      user_data, pipe, FALSE);
+}
+
+/**
+ * @brief Construct the pipeline with the option (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_construct_with_option (const char *pipeline_description,
+    const ml_option_h option, ml_pipeline_state_cb cb, void *user_data,
+    ml_pipeline_h * pipe)
+{
+  if (!option)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, option, is NULL. It should be a valid ml_option_h handle. Use ml_pipeline_construct() to construct the pipeline without the option.");
+
+  return construct_pipeline_internal (pipeline_description, option, cb,
+      user_data, pipe, FALSE);
+}
+
+#if defined (__TIZEN__)
+/**
+ * @brief Construct the pipeline (Tizen internal, see nnstreamer-tizen-internal.h)
+ */
+int
+ml_pipeline_construct_internal (const char *pipeline_description,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+{
+  /* Tizen internal pipeline construction */
+  return construct_pipeline_internal (pipeline_description, NULL, cb,
+      user_data, pipe, TRUE);
+}
+#endif /* __TIZEN__ */
+
+static GThreadPool *destroy_pool = NULL;
+static gboolean destroy_pool_closed = FALSE;
+G_LOCK_DEFINE_STATIC (destroy_pool_lock);
+
+static void fini_ml_pipeline_destroy_pool (void) __attribute__ ((destructor));
+
+/**
+ * @brief Data structure for the pipeline destroyed asynchronously.
+ */
+typedef struct
+{
+  ml_pipeline *pipe; /**< The pipeline to be destroyed */
+  ml_pipeline_destroy_cb cb; /**< The callback to notify the result */
+  void *user_data; /**< Private data for the callback */
+} ml_pipeline_destroy_task_s;
+
+/**
+ * @brief Internal function to wait until the pipeline is not playing, with the state-changed message from the bus.
+ */
+static gboolean
+_ml_pipeline_wait_paused (ml_pipeline * p)
+{
+  gint64 end_time;
+  gboolean paused = TRUE;
+
+  end_time = g_get_monotonic_time () +
+      WAIT_PAUSED_TIME_LIMIT * G_TIME_SPAN_MILLISECOND;
+
+  g_mutex_lock (&p->state_lock);
+  while (p->pipe_state == ML_PIPELINE_STATE_PLAYING) {
+    if (!g_cond_wait_until (&p->state_cond, &p->state_lock, end_time)) {
+      paused = (p->pipe_state != ML_PIPELINE_STATE_PLAYING);
+      break;
+    }
+  }
+  g_mutex_unlock (&p->state_lock);
+
+  return paused;
+}
+
+/**
+ * @brief Internal function to stop and release the pipeline.
+ */
+static int
+_ml_pipeline_destroy (ml_pipeline * p)
+{
+  GstStateChangeReturn scret;
+  GstState state;
+
+  /* Wake up the threads waiting for the room of src, before releasing the elements. */
+  _ml_pipeline_src_flow_close (p);
+
+  g_mutex_lock (&p->lock);
+
+  /* Before changing the state, remove all callbacks. */
+  p->state_cb.cb = NULL;
+
+  /* Destroy registered callback handles and resources */
+  g_hash_table_destroy (p->namednodes);
+  g_hash_table_destroy (p->resources);
+  g_hash_table_destroy (p->pipe_elm_type);
+  p->namednodes = p->resources = p->pipe_elm_type = NULL;
+
+  if (p->element) {
+    /* Pause the pipeline if it's playing */
+    scret = gst_element_get_state (p->element, &state, NULL, 10 * GST_MSECOND); /* 10ms */
+    if (scret != GST_STATE_CHANGE_FAILURE && state == GST_STATE_PLAYING) {
+      scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
+      if (scret == GST_STATE_CHANGE_FAILURE) {
+        g_mutex_unlock (&p->lock);
+        _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+            "gst_element_get_state() has failed to wait until state changed from PLAYING to PAUSED and returned GST_STATE_CHANGE_FAILURE. For the detail, please check the GStreamer log messages (or dlog messages in Tizen). It is possible that there is a filter or neural network that is taking too much time to finish.");
+      }
+    }
+
+    g_mutex_unlock (&p->lock);
+    if (!_ml_pipeline_wait_paused (p)) {
+      _ml_error_report
+          ("Timeout while waiting for a state change to 'PAUSED' from a 'sync-message' signal from the pipeline. It is possible that there is a filter or neural network that is taking too much time to finish.");
+    }
+    g_mutex_lock (&p->lock);
+
+    /* Stop (NULL State) the pipeline */
+    scret = gst_element_set_state (p->element, GST_STATE_NULL);
+    if (scret != GST_STATE_CHANGE_SUCCESS) {
+      g_mutex_unlock (&p->lock);
+      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+          "gst_element_set_state to stop the pipeline has failed after trying to stop the pipeline with PAUSE and waiting for stopping. For the detail, please check the GStreamer log messages. It is possible that there is a filter of neural network that is taking too much time to finish.");
+    }
+
+    if (p->bus) {
+      g_signal_handler_disconnect (p->bus, p->signal_msg);
+      gst_object_unref (p->bus);
+    }
+
+    _ml_pipeline_stats_free (p->stats);
+    p->stats = NULL;
+
+    _ml_pipeline_parallel_free (p->parallel);
+    p->parallel = NULL;
+
+    gst_object_unref (p->element);
+    p->element = NULL;
+  }
+
+  g_mutex_unlock (&p->lock);
+  g_mutex_clear (&p->lock);
+  g_mutex_clear (&p->state_lock);
+  g_cond_clear (&p->state_cond);
+
+  g_free (p);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to destroy the pipeline in the worker thread.
+ */
+static void
+_ml_pipeline_destroy_thread_func (gpointer data, gpointer user_data)
+{
+  ml_pipeline_destroy_task_s *task = (ml_pipeline_destroy_task_s *) data;
+  int status;
+
+  status = _ml_pipeline_destroy (task->pipe);
+
+  if (task->cb)
+    task->cb (status, task->user_data);
+
+  g_free (task);
+}
+
+/**
+ * @brief Internal function to push the task to the shared thread pool destroying the pipelines.
+ * @return FALSE if the pool is released or failed to create the pool.
+ */
+static gboolean
+_ml_pipeline_push_destroy_task (ml_pipeline_destroy_task_s * task)
+{
+  gboolean pushed = FALSE;
+  GError *err = NULL;
+
+  G_LOCK (destroy_pool_lock);
+  if (!destroy_pool && !destroy_pool_closed) {
+    destroy_pool = g_thread_pool_new (_ml_pipeline_destroy_thread_func, NULL,
+        (gint) g_get_num_processors (), FALSE, &err);
+  }
+
+  if (destroy_pool) {
+    /* The task is queued even if failed to start a new thread. */
+    g_thread_pool_push (destroy_pool, task, &err);
+    pushed = TRUE;
+  }
+  G_UNLOCK (destroy_pool_lock);
+
+  if (err) {
+    _ml_logw ("Failed to start the thread destroying the pipeline: %s",
+        err->message);
+    g_clear_error (&err);
+  }
+
+  return pushed;
+}
+
+/**
+ * @brief Releases the shared thread pool destroying the pipelines when the library is unloaded.
+ * @details This does not wait for the pipelines already pushed, the application should wait for the destroy callbacks before unloading. The new ones are destroyed in the caller thread.
+ */
+static void
+fini_ml_pipeline_destroy_pool (void)
+{
+  GThreadPool *pool;
+
+  G_LOCK (destroy_pool_lock);
+  pool = destroy_pool;
+  destroy_pool = NULL;
+  destroy_pool_closed = TRUE;
+  G_UNLOCK (destroy_pool_lock);
+
+  /* Do not run the state changes and callbacks in the destructor, the pool is released after the queued tasks are done. */
+  if (pool)
+    g_thread_pool_free (pool, FALSE, FALSE);
+}
+
+/**
+ * @brief Destroy the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_destroy (ml_pipeline_h pipe)
+{
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (pipe == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle instance, usually created by ml_pipeline_construct().");
+
+  return _ml_pipeline_destroy ((ml_pipeline *) pipe);
+}
+
+/**
+ * @brief Destroy the pipeline asynchronously (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_destroy_async (ml_pipeline_h pipe, ml_pipeline_destroy_cb cb,
+    void *user_data)
+{
+  ml_pipeline_destroy_task_s *task;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (pipe == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle instance, usually created by ml_pipeline_construct().");
+
+  task = g_try_new0 (ml_pipeline_destroy_task_s, 1);
+  if (!task)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate memory to destroy the pipeline. Out of memory?");
+
+  task->pipe = (ml_pipeline *) pipe;
+  task->cb = cb;
+  task->user_data = user_data;
+
+  if (!_ml_pipeline_push_destroy_task (task)) {
+    /* The pool is released (library unloading), destroy it in the caller thread. */
+    _ml_pipeline_destroy_thread_func (task, NULL);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Get the pipeline state (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e * state)
+{
+  ml_pipeline *p = pipe;
+  GstState _state;
+  GstStateChangeReturn scret;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
+  if (state == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, state, is NULL. It should be a valid pointer of ml_pipeline_state_e. E.g., ml_pipeline_state_e state; ml_pipeline_get_state(pipe, &state);");
+
+  *state = ML_PIPELINE_STATE_UNKNOWN;
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_get_state (p->element, &_state, NULL, GST_MSECOND);       /* Do it within 1ms! */
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to get the state of the pipeline. For the detail, please check the GStreamer log messages.");
+
+  *state = (ml_pipeline_state_e) _state;
+  return ML_ERROR_NONE;
+}
+
+/****************************************************
+ ** NNStreamer Pipeline Start/Stop Control         **
+ ****************************************************/
+/**
+ * @brief Start/Resume the pipeline! (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_start (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GstStateChangeReturn scret;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
+
+  g_mutex_lock (&p->lock);
+
+  /* check the resources when starting the pipeline */
+  if (g_hash_table_size (p->resources)) {
+    GHashTableIter iter;
+    gpointer key, value;
+
+    /* iterate all handle and acquire res if released */
+    g_hash_table_iter_init (&iter, p->resources);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+      if (g_str_has_prefix (key, "tizen")) {
+        status = get_tizen_resource (pipe, key);
+        if (status != ML_ERROR_NONE) {
+          _ml_error_report_continue
+              ("Internal API _ml_tizen_get_resource () has failed: Tizen mm resource manager has failed to acquire the resource of '%s'",
+              (gchar *) key);
+          goto done;
+        }
+      }
+    }
+  }
+
+  scret = gst_element_set_state (p->element, GST_STATE_PLAYING);
+  if (scret == GST_STATE_CHANGE_FAILURE) {
+    _ml_error_report
+        ("Failed to set the state of the pipeline to PLAYING. For the detail, please check the GStreamer log messages.");
+    status = ML_ERROR_STREAMS_PIPE;
+  }
+
+done:
+  g_mutex_unlock (&p->lock);
+  return status;
+}
+
+/**
+ * @brief Pause the pipeline! (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_stop (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GstStateChangeReturn scret;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to set the state of the pipeline to PAUSED. For the detail, please check the GStreamer log messages.");
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Clears all data and resets the running-time of the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_flush (ml_pipeline_h pipe, bool start)
+{
+  ml_pipeline *p = pipe;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (p == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
+
+  _ml_error_report_return_continue_iferr (ml_pipeline_stop (pipe),
+      "Failed to stop the pipeline with ml_pipeline_stop (). It has returned %d.",
+      _ERRNO);
+
+  _ml_logi ("The pipeline is stopped, clear all data from the pipeline.");
+
+  /* send flush event to pipeline */
+  g_mutex_lock (&p->lock);
+  if (!gst_element_send_event (p->element, gst_event_new_flush_start ())) {
+    _ml_logw ("Error occurs while sending flush_start event.");
+  }
+
+  if (!gst_element_send_event (p->element, gst_event_new_flush_stop (TRUE))) {
+    _ml_logw ("Error occurs while sending flush_stop event.");
+  }
+  g_mutex_unlock (&p->lock);
+
+  if (start && status == ML_ERROR_NONE)
+    status = ml_pipeline_start (pipe);
+
+  return status;
+}
+
+/****************************************************
+ ** NNStreamer Pipeline Sink/Src Control           **
+ ****************************************************/
+/**
+ * @brief Register a callback for sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
+    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+{
+  ml_pipeline_element *elem;
+  ml_pipeline *p = pipe;
+  ml_pipeline_common_elem *sink;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (h == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, h (ml_pipeline_sink_h), is NULL. It should be a valid pointer to a new ml_pipeline_sink_h instance. E.g., ml_pipeline_sink_h h; ml_pipeline_sink_register (...., &h);");
+
+  /* init null */
+  *h = NULL;
+
+  if (pipe == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, pipe (ml_pipeline_h), is NULL. It should be a valid ml_pipeline_h instance, usually created by ml_pipeline_construct.");
+
+  if (sink_name == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, sink_name (const char *), is NULL. It should be a valid string naming the sink handle (h).");
+
+  if (cb == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, cb (ml_pipeline_sink_cb), is NULL. It should be a call-back function called for data-sink events.");
+
+  g_mutex_lock (&p->lock);
+  elem = g_hash_table_lookup (p->namednodes, sink_name);
+
+  if (elem == NULL) {
+    _ml_error_report
+        ("There is no element named [%s](sink_name) in the pipeline. Please check your pipeline description.",
+        sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->type != ML_PIPELINE_ELEMENT_SINK &&
+      elem->type != ML_PIPELINE_ELEMENT_APP_SINK) {
+    _ml_error_report
+        ("The element [%s](sink_name) in the pipeline is not a sink element. Please supply the name of tensor_sink or appsink.",
+        sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->handle_id > 0) {
+    /* no need to connect signal to sink element */
+    _ml_logw ("Sink callback is already registered.");
+  } else {
+    /* set callback for new data */
+    if (elem->type == ML_PIPELINE_ELEMENT_SINK) {
+      /* tensor_sink */
+      g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
+          NULL);
+      elem->handle_id =
+          g_signal_connect (elem->element, "new-data",
+          G_CALLBACK (cb_sink_event), elem);
+    } else {
+      /* appsink */
+      g_object_set (G_OBJECT (elem->element), "emit-signals", (gboolean) TRUE,
+          NULL);
+      elem->handle_id =
+          g_signal_connect (elem->element, "new-sample",
+          G_CALLBACK (cb_appsink_new_sample), elem);
+    }
+
+    if (elem->handle_id == 0) {
+      _ml_error_report
+          ("Failed to connect a signal to the element [%s](sink_name). g_signal_connect has returned NULL.",
+          sink_name);
+      ret = ML_ERROR_STREAMS_PIPE;
+      goto unlock_return;
+    }
+  }
+
+  sink = g_new0 (ml_pipeline_common_elem, 1);
+  if (sink == NULL) {
+    _ml_error_report
+        ("Failed to allocate memory for the sink handle of %s. Out of memory?",
+        sink_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  sink->callback_info = g_new0 (callback_info_s, 1);
+  if (sink->callback_info == NULL) {
+    g_free (sink);
+    _ml_error_report
+        ("Failed to allocate memory for the sink handle of %s. Out of memory?",
+        sink_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  sink->pipe = p;
+  sink->element = elem;
+  sink->callback_info->sink_cb = cb;
+  sink->callback_info->sink_pdata = user_data;
+  *h = sink;
+
+  g_mutex_lock (&elem->lock);
+
+  elem->maxid++;
+  sink->id = elem->maxid;
+  elem->handles = g_list_append (elem->handles, sink);
+
+  g_mutex_unlock (&elem->lock);
+
+unlock_return:
+  g_mutex_unlock (&p->lock);
+  return ret;
+}
+
+/**
+ * @brief Unregister a callback for sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_unregister (ml_pipeline_sink_h h)
+{
+  ml_pipeline_sink_dispatch_s *dispatch = NULL;
+
+  handle_init (sink, h);
+
+  if (elem->handle_id > 0) {
+    g_signal_handler_disconnect (elem->element, elem->handle_id);
+    elem->handle_id = 0;
+  }
+
+  /* Stop the worker thread here, and wait for the sink callback after unlocking. */
+  if (sink->callback_info) {
+    dispatch = sink->callback_info->dispatch;
+    sink->callback_info->dispatch = NULL;
+    _ml_pipeline_sink_dispatch_stop (dispatch);
+  }
+
+  elem->handles = g_list_remove (elem->handles, sink);
+  free_element_handle (sink);
+
+unlock_return:
+  g_mutex_unlock (&elem->lock);
+  g_mutex_unlock (&p->lock);
+
+  _ml_pipeline_sink_dispatch_free (dispatch);
+  return ret;
+}
+
+/**
+ * @brief Sets the asynchronous delivery of sink data (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_set_async (ml_pipeline_sink_h h, const ml_option_h option)
+{
+  ml_pipeline_sink_dispatch_s *dispatch = NULL;
+  ml_pipeline_sink_dispatch_s *old = NULL;
+
+  handle_init (sink, h);
+
+  if (!sink->callback_info || !sink->callback_info->sink_cb) {
+    _ml_error_report
+        ("The handle (ml_pipeline_sink_h h) does not have the sink callback. It should be a sink handle registered with ml_pipeline_sink_register().");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (option) {
+    ret = _ml_pipeline_sink_dispatch_new (option,
+        sink->callback_info->sink_cb, sink->callback_info->sink_pdata,
+        &dispatch);
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to set the asynchronous delivery of sink data.");
+      goto unlock_return;
+    }
+  }
+
+  /* Stop the previous worker thread, and wait for the callback after unlocking. */
+  old = sink->callback_info->dispatch;
+  sink->callback_info->dispatch = dispatch;
+  _ml_pipeline_sink_dispatch_stop (old);
+
+unlock_return:
+  g_mutex_unlock (&elem->lock);
+  g_mutex_unlock (&p->lock);
+
+  _ml_pipeline_sink_dispatch_free (old);
+  return ret;
+}
+
+/**
+ * @brief Gets the number of data dropped by asynchronous sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_get_dropped_count (ml_pipeline_sink_h h, uint64_t *count)
+{
+  ml_pipeline_sink_dispatch_s *dispatch;
+
+  handle_init (sink, h);
+
+  if (!count) {
+    _ml_error_report
+        ("The parameter, count (uint64_t *), is NULL. It should be a valid pointer to get the number of dropped data.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  *count = 0;
+  dispatch = sink->callback_info ? sink->callback_info->dispatch : NULL;
+  if (dispatch) {
+    g_mutex_lock (&dispatch->lock);
+    *count = dispatch->dropped;
+    g_mutex_unlock (&dispatch->lock);
+  }
+
+  handle_exit (h);
+}
+
+/**
+ * @brief Handle a tensor_sink element to queue the buffer for ml_pipeline_sink_pull().
+ */
+static void
+cb_sink_pull_event (GstElement * e, GstBuffer * b, gpointer user_data)
+{
+  ml_pipeline_element *elem = user_data;
+  GstBuffer *oldest;
+
+  /* Keep the recent buffers only, the application may not pull the data. */
+  g_async_queue_lock (elem->pull_queue);
+  while (g_async_queue_length_unlocked (elem->pull_queue) >=
+      (gint) ML_PIPELINE_SINK_QUEUE_SIZE_DEFAULT) {
+    oldest = (GstBuffer *) g_async_queue_try_pop_unlocked (elem->pull_queue);
+    if (!oldest)
+      break;
+    gst_buffer_unref (oldest);
+  }
+  g_async_queue_push_unlocked (elem->pull_queue, gst_buffer_ref (b));
+  g_async_queue_unlock (elem->pull_queue);
+}
+
+/**
+ * @brief Internal function to release the queue of tensor_sink for ml_pipeline_sink_pull().
+ * @note The caller should lock the element.
+ */
+static void
+_ml_pipeline_sink_pull_release (ml_pipeline_element * elem)
+{
+  if (elem->pull_id > 0) {
+    g_signal_handler_disconnect (elem->element, elem->pull_id);
+    elem->pull_id = 0;
+  }
+
+  if (elem->pull_queue) {
+    g_async_queue_unref (elem->pull_queue);
+    elem->pull_queue = NULL;
+  }
+}
+
+/**
+ * @brief Internal function to create the data handle holding the buffer pulled from the sink element.
+ */
+static int
+_ml_pipeline_sink_pull_data (GstBuffer * buffer, GstCaps * caps,
+    ml_tensors_data_h * data)
+{
+  GstTensorsInfo gst_info;
+  GstTensorMetaInfo meta;
+  GstMemory *mem;
+  GstMapInfo map;
+  ml_tensors_info_h info = NULL;
+  ml_tensors_data_h _data = NULL;
+  gboolean flexible = FALSE;
+  guint i, num_tensors;
+  int status = ML_ERROR_NONE;
+
+  gst_tensors_info_init (&gst_info);
 
-          if (GST_IS_ELEMENT (obj)) {
-            GstElement *elem = GST_ELEMENT (obj);
-            GstPluginFeature *feature =
-                GST_PLUGIN_FEATURE (gst_element_get_factory (elem));
-            const gchar *plugin_name =
-                gst_plugin_feature_get_plugin_name (feature);
-            const gchar *element_name = gst_plugin_feature_get_name (feature);
+  if (!caps || !get_tensors_info_from_caps (caps, &gst_info, &flexible)) {
+    _ml_error_report
+        ("Failed to get the tensors information of the pulled data. The sink element is not negotiated yet.");
+    status = ML_ERROR_STREAMS_PIPE;
+    goto done;
+  }
 
-            /* validate the availability of the plugin */
-            if (!is_internal && _ml_check_plugin_availability (plugin_name,
-                    element_name) != ML_ERROR_NONE) {
-              _ml_error_report_continue
-                  ("There is a pipeline element (filter) that is not allowed for applications via ML-API (privilege not granted) or now available: '%s'/'%s'.",
-                  plugin_name, element_name);
-              status = ML_ERROR_NOT_SUPPORTED;
-              done = TRUE;
-              break;
-            }
+  num_tensors = gst_tensor_buffer_get_count (buffer);
 
-            name = gst_element_get_name (elem);
-            if (name != NULL) {
-              ml_pipeline_element_e element_type =
-                  get_elem_type_from_name (pipe_h->pipe_elm_type, element_name);
+  if (flexible) {
+    /* The information of flexible tensor is in the header of each memory. */
+    gst_info.num_tensors = num_tensors;
 
-              /* check 'sync' property in sink element */
-              if (element_type == ML_PIPELINE_ELEMENT_SINK ||
-                  element_type == ML_PIPELINE_ELEMENT_APP_SINK) {
-                gboolean sync = FALSE;
+    for (i = 0; i < num_tensors; i++) {
+      mem = gst_tensor_buffer_get_nth_memory (buffer, i);
+      if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
+        gst_memory_unref (mem);
+        _ml_error_report ("Failed to map the memory of the pulled data.");
+        status = ML_ERROR_STREAMS_PIPE;
+        goto done;
+      }
 
-                g_object_get (G_OBJECT (elem), "sync", &sync, NULL);
-                if (sync) {
-                  _ml_logw (_ml_detail
-                      ("It is recommended to apply 'sync=false' property to a sink element in most AI applications. Otherwise, inference results of large neural networks will be frequently dropped by the synchronization mechanism at the sink element."));
-                }
-              }
+      gst_tensor_meta_info_parse_header (&meta, map.data);
+      gst_tensor_meta_info_convert (&meta,
+          gst_tensors_info_get_nth_info (&gst_info, i));
+
+      gst_memory_unmap (mem, &map);
+      gst_memory_unref (mem);
+    }
+  } else if (gst_info.num_tensors != num_tensors) {
+    _ml_error_report
+        ("The number of tensors in the pulled data (%u) mismatches the negotiated caps (%u).",
+        num_tensors, gst_info.num_tensors);
+    status = ML_ERROR_STREAMS_PIPE;
+    goto done;
+  }
+
+  status = _ml_tensors_info_create_from_gst (&info, &gst_info);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  status = _ml_tensors_data_create_no_alloc (info, &_data);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  /* Hold the memories of the buffer, not to copy the data. */
+  status = _ml_pipeline_sink_data_retain (_data, buffer);
+  if (status != ML_ERROR_NONE) {
+    ml_tensors_data_destroy (_data);
+    goto done;
+  }
+
+  *data = _data;
+
+done:
+  if (info)
+    ml_tensors_info_destroy (info);
+  gst_tensors_info_free (&gst_info);
+  return status;
+}
+
+/**
+ * @brief Pulls the data from the sink element (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_pull (ml_pipeline_h pipe, const char *sink_name,
+    unsigned int timeout, ml_tensors_data_h * data)
+{
+  ml_pipeline *p = pipe;
+  ml_pipeline_element *elem;
+  GstElement *element = NULL;
+  GAsyncQueue *queue = NULL;
+  GstSample *sample = NULL;
+  GstBuffer *buffer = NULL;
+  GstCaps *caps = NULL;
+  GstPad *pad;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (pipe == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, pipe (ml_pipeline_h), is NULL. It should be a valid ml_pipeline_h instance, usually created by ml_pipeline_construct.");
+
+  if (sink_name == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, sink_name (const char *), is NULL. It should be a valid string naming the sink element.");
+
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The argument, data (ml_tensors_data_h *), is NULL. It should be a valid pointer to get the pulled data.");
+
+  /* init null */
+  *data = NULL;
+
+  g_mutex_lock (&p->lock);
+  elem = g_hash_table_lookup (p->namednodes, sink_name);
+
+  if (elem == NULL) {
+    _ml_error_report
+        ("There is no element named [%s](sink_name) in the pipeline. Please check your pipeline description.",
+        sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  g_mutex_lock (&elem->lock);
+
+  if (elem->type == ML_PIPELINE_ELEMENT_SINK) {
+    /* tensor_sink does not keep the buffers, queue them from now on. */
+    if (!elem->pull_queue) {
+      elem->pull_queue =
+          g_async_queue_new_full ((GDestroyNotify) gst_buffer_unref);
+      g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
+          NULL);
+      elem->pull_id = g_signal_connect (elem->element, "new-data",
+          G_CALLBACK (cb_sink_pull_event), elem);
+    }
+
+    queue = g_async_queue_ref (elem->pull_queue);
+  } else if (elem->type == ML_PIPELINE_ELEMENT_APP_SINK) {
+    if (elem->handle_id > 0) {
+      _ml_error_report
+          ("The appsink [%s](sink_name) has the sink callback registered by ml_pipeline_sink_register(). The data cannot be pulled.",
+          sink_name);
+      ret = ML_ERROR_INVALID_PARAMETER;
+    }
+  } else {
+    _ml_error_report
+        ("The element [%s](sink_name) in the pipeline is not a sink element. Please supply the name of tensor_sink or appsink.",
+        sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (ret == ML_ERROR_NONE)
+    element = gst_object_ref (elem->element);
+
+  g_mutex_unlock (&elem->lock);
+
+unlock_return:
+  g_mutex_unlock (&p->lock);
+
+  if (ret != ML_ERROR_NONE)
+    return ret;
+
+  /* Wait for the data without the lock. */
+  if (queue) {
+    if (timeout > 0)
+      buffer = (GstBuffer *) g_async_queue_timeout_pop (queue,
+          (guint64) timeout * G_TIME_SPAN_MILLISECOND);
+    else
+      buffer = (GstBuffer *) g_async_queue_try_pop (queue);
+
+    g_async_queue_unref (queue);
+
+    if (buffer) {
+      pad = gst_element_get_static_pad (element, "sink");
+      if (pad) {
+        caps = gst_pad_get_current_caps (pad);
+        gst_object_unref (pad);
+      }
+    }
+  } else {
+    sample = gst_app_sink_try_pull_sample (GST_APP_SINK (element),
+        (GstClockTime) timeout * GST_MSECOND);
+
+    if (sample) {
+      buffer = gst_sample_get_buffer (sample);
+      caps = gst_sample_get_caps (sample);
+      if (buffer)
+        gst_buffer_ref (buffer);
+      if (caps)
+        gst_caps_ref (caps);
+      gst_sample_unref (sample);
+    }
+  }
+
+  if (buffer) {
+    ret = _ml_pipeline_sink_pull_data (buffer, caps, data);
+    gst_buffer_unref (buffer);
+  } else {
+    ret = ML_ERROR_TIMED_OUT;
+  }
+
+  if (caps)
+    gst_caps_unref (caps);
+  gst_object_unref (element);
+  return ret;
+}
+
+/**
+ * @brief Parse tensors info of src element.
+ */
+static int
+ml_pipeline_src_parse_tensors_info (ml_pipeline_element * elem)
+{
+  GstCaps *caps = NULL;
+  gboolean found = FALSE, flexible = FALSE;
+  gint version;
+
+  if (elem->src == NULL) {
+    elem->src = _ml_pipeline_element_get_pad (elem, "src");
+  }
+
+  if (elem->src == NULL) {
+    _ml_error_report
+        ("Failed to get the src pad of the element[%s]. The designated source element does not have available src pad? For the detail, please check the GStreamer log messages.",
+        elem->name);
+    return ML_ERROR_STREAMS_PIPE;
+  }
+
+  /* The negotiated caps is parsed already, skip it until new caps is received. */
+  version = g_atomic_int_get (&elem->caps_version);
+  if (elem->caps_parsed == version)
+    return ML_ERROR_NONE;
+
+  /* If caps is given, use it. e.g. Use cap "image/png" when the pipeline is */
+  /* given as "appsrc caps=image/png ! pngdec ! ... " */
+  caps = gst_pad_get_current_caps (elem->src);
+  if (caps) {
+    elem->caps_parsed = version;
+  } else {
+    caps = gst_pad_get_allowed_caps (elem->src);
+  }
+
+  if (!caps) {
+    _ml_logw
+        ("Cannot find caps. The pipeline is not yet negotiated for src element [%s].",
+        elem->name);
+    _ml_pipeline_element_release_pad (elem, &elem->src);
+    return ML_ERROR_TRY_AGAIN;
+  }
+
+  found = get_tensors_info_from_caps (caps, &elem->tensors_info, &flexible);
+
+  if (found) {
+    elem->is_flexible_tensor = flexible;
+  } else {
+    if (gst_caps_is_fixed (caps)) {
+      GstStructure *st = gst_caps_get_structure (caps, 0);
+      elem->is_media_stream = !gst_structure_is_tensor_stream (st);
+    }
+  }
+
+  gst_caps_unref (caps);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Get a handle to operate a src (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_get_handle (ml_pipeline_h pipe, const char *src_name,
+    ml_pipeline_src_h * h)
+{
+  ml_pipeline *p = pipe;
+  ml_pipeline_element *elem;
+  ml_pipeline_common_elem *src;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (h == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, h (ml_pipeline_src_h), is NULL. It should be a valid pointer to a new (or to be cleared) instance. E.g., ml_pipeline_src_h h; ml_pipeline_src_get_handle (..., &h);");
+
+  /* init null */
+  *h = NULL;
+
+  if (pipe == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, pipe (ml_pipeline_h), is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
+
+  if (src_name == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, src_name (const char *), is NULL. This string is the name of source element (appsrc) you want to push data stream from your application threads.");
+
+  g_mutex_lock (&p->lock);
+
+  elem = g_hash_table_lookup (p->namednodes, src_name);
+
+  if (elem == NULL) {
+    _ml_error_report
+        ("Cannot find the name, '%s': there is no element named [%s] in the given pipeline.",
+        src_name, src_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->type != ML_PIPELINE_ELEMENT_APP_SRC) {
+    _ml_error_report
+        ("The element designated by '%s' is not a source element (appsrc). Please provide a name of source element for ml_pipeline_src_get_handle API.",
+        src_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  src = *h = g_new0 (ml_pipeline_common_elem, 1);
+  if (src == NULL) {
+    _ml_error_report
+        ("Failed to allocate the src handle for %s. Out of memory?", src_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  src->pipe = p;
+  src->element = elem;
 
-              if (element_type != ML_PIPELINE_ELEMENT_UNKNOWN) {
-                ml_pipeline_element *e;
+  g_mutex_lock (&elem->lock);
 
-                e = construct_element (gst_object_ref (elem), pipe_h, name,
-                    element_type);
-                if (e != NULL) {
-                  if (g_str_equal (element_name, "tensor_if"))
-                    process_tensor_if_option (e);
-                  else if (g_str_equal (element_name, "tensor_filter"))
-                    process_tensor_filter_option (e);
+  elem->maxid++;
+  src->id = elem->maxid;
+  elem->handles = g_list_append (elem->handles, src);
 
-                  g_hash_table_insert (pipe_h->namednodes, g_strdup (name), e);
-                } else {
-                  /* allocation failure */
-                  gst_object_unref (elem);
-                  _ml_error_report_continue
-                      ("Cannot allocate memory with construct_element().");
-                  status = ML_ERROR_OUT_OF_MEMORY;
-                  done = TRUE;
-                }
-              }
+  ml_pipeline_src_parse_tensors_info (elem);
+  g_mutex_unlock (&elem->lock);
 
-              g_free (name);
-            }
-          }
+unlock_return:
+  g_mutex_unlock (&p->lock);
 
-          g_value_reset (&item);
-          break;
-        case GST_ITERATOR_RESYNC:
-        case GST_ITERATOR_ERROR:
-          _ml_logw (_ml_detail
-              ("There is an error or a resync-event while inspecting a pipeline. However, we can still execute the pipeline."));
-          /* fallthrough */
-        case GST_ITERATOR_DONE:
-          done = TRUE;
-      }
-    }
+  return ret;
+}
 
-    g_value_unset (&item);
-    /** @todo CRITICAL check the validity of elem=item registered in e */
-    gst_iterator_free (it);
-  }
+/**
+ * @brief Close a src node (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_release_handle (ml_pipeline_src_h h)
+{
+  handle_init (src, h);
 
-  g_mutex_unlock (&pipe_h->lock);
-  return status;
+  elem->handles = g_list_remove (elem->handles, src);
+  free_element_handle (src);
+
+  handle_exit (h);
 }
 
 /**
- * @brief Internal function to create the hash table for managing internal resources
+ * @brief Internal function to check whether appsrc can accept a frame under its queue limits.
  */
-static void
-create_internal_hash (ml_pipeline * pipe_h)
+static gboolean
+_ml_pipeline_src_has_room (ml_pipeline_element * elem)
 {
-  pipe_h->namednodes =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_node);
-  pipe_h->resources =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_resource);
+  GstAppSrc *appsrc = GST_APP_SRC (elem->element);
+  guint64 max_level;
 
-  pipe_h->pipe_elm_type =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_sink"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SINK));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("appsrc"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_APP_SRC));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("appsink"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_APP_SINK));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("valve"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_VALVE));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("input-selector"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SWITCH_INPUT));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("output-selector"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_SWITCH_OUTPUT));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_if"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_COMMON));
-  g_hash_table_insert (pipe_h->pipe_elm_type, g_strdup ("tensor_filter"),
-      GINT_TO_POINTER (ML_PIPELINE_ELEMENT_COMMON));
+  max_level = gst_app_src_get_max_bytes (appsrc);
+  if (max_level > 0 && gst_app_src_get_current_level_bytes (appsrc) >= max_level)
+    return FALSE;
+
+#if GST_CHECK_VERSION(1, 20, 0)
+  max_level = gst_app_src_get_max_buffers (appsrc);
+  if (max_level > 0 &&
+      gst_app_src_get_current_level_buffers (appsrc) >= max_level)
+    return FALSE;
+#endif
+
+  return TRUE;
 }
 
 /**
- * @brief Internal function to construct the pipeline.
- * If is_internal is true, this will ignore the permission in Tizen.
+ * @brief Internal function to wait until appsrc can accept a frame.
+ * @details The locks of pipeline and element are released while waiting, not to block other functions of the pipeline for the timeout. The handle is validated again after locking.
+ * @note The caller should lock the pipeline and the element. The flow probe of src should be installed, which notifies when appsrc pushes a buffer downstream.
  */
 static int
-construct_pipeline_internal (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe,
-    gboolean is_internal)
+_ml_pipeline_src_wait_room (ml_pipeline * p, ml_pipeline_element * elem,
+    ml_pipeline_common_elem * handle, guint timeout)
 {
-  GError *err = NULL;
-  GstElement *pipeline;
-  gchar *description = NULL;
-  int status = ML_ERROR_NONE;
+  gint64 end_time;
+  gboolean ready, closing;
 
-  ml_pipeline *pipe_h;
+  end_time = g_get_monotonic_time () + timeout * G_TIME_SPAN_MILLISECOND;
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+  g_mutex_lock (&elem->flow_lock);
+  if (elem->flow_closing) {
+    g_mutex_unlock (&elem->flow_lock);
+    return ML_ERROR_STREAMS_PIPE;
+  }
 
-  if (!pipe)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "ml_pipeline_construct error: parameter pipe is NULL. It should be a valid ml_pipeline_h pointer. E.g., ml_pipeline_h pipe; ml_pipeline_construct (..., &pip);");
+  ready = _ml_pipeline_src_has_room (elem);
+  if (ready) {
+    g_mutex_unlock (&elem->flow_lock);
+    return ML_ERROR_NONE;
+  }
 
-  if (!pipeline_description)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "ml_pipeline_construct error: parameter pipeline_description is NULL. It should be a valid string of Gstreamer/NNStreamer pipeline description.");
+  /* The pipeline is not released until the waiting threads return, see _ml_pipeline_src_flow_close(). */
+  elem->flow_waiters++;
+  g_mutex_unlock (&elem->flow_lock);
 
-  /* init null */
-  *pipe = NULL;
+  g_mutex_unlock (&elem->lock);
+  g_mutex_unlock (&p->lock);
 
-  _ml_error_report_return_continue_iferr (_ml_initialize_gstreamer (),
-      "ml_pipeline_construct error: it has failed to initialize gstreamer(). Please check if you have a valid GStreamer library installed in your system.");
+  g_mutex_lock (&elem->flow_lock);
+  while (!elem->flow_closing && !(ready = _ml_pipeline_src_has_room (elem))) {
+    if (!g_cond_wait_until (&elem->flow_cond, &elem->flow_lock, end_time)) {
+      ready = _ml_pipeline_src_has_room (elem);
+      break;
+    }
+  }
+  g_mutex_unlock (&elem->flow_lock);
 
-  /* prepare pipeline handle */
-  pipe_h = g_new0 (ml_pipeline, 1);
-  if (pipe_h == NULL)
-    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
-        "ml_pipeline_construct error: failed to allocate memory for pipeline handle. Out of memory?");
+  g_mutex_lock (&p->lock);
+  g_mutex_lock (&elem->lock);
 
-  g_mutex_init (&pipe_h->lock);
+  g_mutex_lock (&elem->flow_lock);
+  closing = elem->flow_closing;
+  elem->flow_waiters--;
+  g_cond_broadcast (&elem->flow_cond);
+  g_mutex_unlock (&elem->flow_lock);
 
-  pipe_h->isEOS = FALSE;
-  pipe_h->pipe_state = ML_PIPELINE_STATE_UNKNOWN;
+  if (closing) {
+    _ml_loge ("The pipeline of src [%s] is being destroyed.", elem->name);
+    return ML_ERROR_STREAMS_PIPE;
+  }
 
-  create_internal_hash (pipe_h);
+  if (NULL == g_list_find (elem->handles, handle)) {
+    _ml_loge ("The handle of src [%s] is released while waiting.",
+        elem->name);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
 
-  /* convert predefined element and launch the pipeline */
-  status =
-      convert_element ((ml_pipeline_h) pipe_h, pipeline_description,
-      &description, is_internal);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue
-        ("ml_pipeline_construct error: failed while converting pipeline description for GStreamer w/ convert_element() function, which has returned %d",
-        status);
-    goto failed;
+  return ready ? ML_ERROR_NONE : ML_ERROR_TIMED_OUT;
+}
+
+/**
+ * @brief Internal function to wake up the threads waiting for the room of appsrc, and wait until they return before releasing the pipeline.
+ * @note The caller should not lock the pipeline, the waiting threads lock the pipeline before returning.
+ */
+static void
+_ml_pipeline_src_flow_close (ml_pipeline * p)
+{
+  GHashTableIter iter;
+  gpointer value;
+  ml_pipeline_element *elem;
+  GList *elems = NULL, *l;
+
+  g_mutex_lock (&p->lock);
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    elem = (ml_pipeline_element *) value;
+    if (elem->type != ML_PIPELINE_ELEMENT_APP_SRC)
+      continue;
+
+    g_mutex_lock (&elem->flow_lock);
+    elem->flow_closing = TRUE;
+    g_cond_broadcast (&elem->flow_cond);
+    g_mutex_unlock (&elem->flow_lock);
+
+    elems = g_list_prepend (elems, elem);
   }
+  g_mutex_unlock (&p->lock);
 
-  pipeline = gst_parse_launch (description, &err);
-  g_free (description);
+  for (l = elems; l != NULL; l = l->next) {
+    elem = (ml_pipeline_element *) l->data;
 
-  if (pipeline == NULL || err) {
-    _ml_error_report
-        ("ml_pipeline_construct error: gst_parse_launch cannot parse and launch the given pipeline = [%s]. The error message from gst_parse_launch is '%s'.",
-        pipeline_description, (err) ? err->message : "unknown reason");
-    g_clear_error (&err);
+    g_mutex_lock (&elem->flow_lock);
+    while (elem->flow_waiters > 0)
+      g_cond_wait (&elem->flow_cond, &elem->flow_lock);
+    g_mutex_unlock (&elem->flow_lock);
+  }
 
-    if (pipeline)
-      gst_object_unref (pipeline);
+  g_list_free (elems);
+}
 
-    status = ML_ERROR_STREAMS_PIPE;
-    goto failed;
+/**
+ * @brief Pad probe of appsrc, notifying the threads waiting for the room of appsrc.
+ */
+static GstPadProbeReturn
+_ml_pipeline_src_flow_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer user_data)
+{
+  ml_pipeline_element *elem = (ml_pipeline_element *) user_data;
+
+  g_mutex_lock (&elem->flow_lock);
+  g_cond_broadcast (&elem->flow_cond);
+  g_mutex_unlock (&elem->flow_lock);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Internal function to remove the flow probe of appsrc.
+ * @note The caller should lock the element.
+ */
+static void
+_ml_pipeline_src_flow_release (ml_pipeline_element * elem)
+{
+  GstPad *pad;
+
+  if (elem->flow_probe == 0)
+    return;
+
+  pad = gst_element_get_static_pad (elem->element, "src");
+  if (pad) {
+    gst_pad_remove_probe (pad, elem->flow_probe);
+    gst_object_unref (pad);
   }
 
-  g_assert (GST_IS_PIPELINE (pipeline));
-  pipe_h->element = pipeline;
+  elem->flow_probe = 0;
+  elem->flow_timeout = 0;
+}
 
-  /* bus and message callback */
-  pipe_h->bus = gst_element_get_bus (pipeline);
-  g_assert (pipe_h->bus);
+/**
+ * @brief Internal function to set the default value of the element property.
+ */
+static void
+_ml_pipeline_element_reset_property (GstElement * element, const gchar * name)
+{
+  GParamSpec *spec;
 
-  gst_bus_enable_sync_message_emission (pipe_h->bus);
-  pipe_h->signal_msg = g_signal_connect (pipe_h->bus, "sync-message",
-      G_CALLBACK (cb_bus_sync_message), pipe_h);
+  spec = g_object_class_find_property (G_OBJECT_GET_CLASS (element), name);
+  if (spec && (spec->flags & G_PARAM_WRITABLE))
+    g_object_set_property (G_OBJECT (element), name,
+        g_param_spec_get_default_value (spec));
+}
 
-  /* state change callback */
-  pipe_h->state_cb.cb = cb;
-  pipe_h->state_cb.user_data = user_data;
+/**
+ * @brief Clears the state of elements set by the application, such as the flow control of src and the queue of sink.
+ */
+void
+_ml_pipeline_reset_elements (ml_pipeline * p)
+{
+  GHashTableIter iter;
+  gpointer value;
+  ml_pipeline_element *elem;
 
-  /* iterate elements and prepare element handle */
-  status = iterate_element (pipe_h, pipeline, is_internal);
-  if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue ("ml_pipeline_construct error: ...");
-    goto failed;
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    elem = (ml_pipeline_element *) value;
+
+    g_mutex_lock (&elem->lock);
+    _ml_pipeline_sink_pull_release (elem);
+
+    if (elem->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+      _ml_pipeline_src_flow_release (elem);
+      _ml_pipeline_element_reset_property (elem->element, "max-bytes");
+      _ml_pipeline_element_reset_property (elem->element, "max-buffers");
+    }
+    g_mutex_unlock (&elem->lock);
   }
 
-  /* finally set pipeline state to PAUSED */
-  status = ml_pipeline_stop ((ml_pipeline_h) pipe_h);
+  _ml_pipeline_stats_free (p->stats);
+  p->stats = NULL;
+}
 
-  if (status == ML_ERROR_NONE) {
-    /**
-     * Let's wait until the pipeline state is changed to paused.
-     * Otherwise, the following APIs like 'set_property' may incur
-     * unintended behaviors. But, don't need to return any error
-     * even if this state change is not finished within the timeout,
-     * just replying on the caller.
-     */
-    gst_element_get_state (pipeline, NULL, NULL, 10 * GST_MSECOND);
-  } else {
-    _ml_error_report_continue
-        ("ml_pipeline_construct error: ml_pipeline_stop has failed with %d return. The pipeline should be able to be stopped when it is constructed.",
-        status);
+/**
+ * @brief Internal function to validate the data frame to be pushed to a src.
+ * @note The caller should lock the element and the data, and parse the tensors info of the element.
+ */
+static int
+_ml_pipeline_src_validate_data (ml_pipeline_element * elem,
+    ml_tensors_data_s * _data)
+{
+  unsigned int i;
+
+  if (_data->num_tensors < 1 || _data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The number of tensors of the given data (ml_tensors_data_h) is invalid. The number of tensors of data is %u. It should be between 1 and %u.",
+        _data->num_tensors, ML_TENSOR_SIZE_LIMIT);
   }
 
-failed:
-  if (status != ML_ERROR_NONE) {
-    /* failed to construct the pipeline */
-    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
-  } else {
-    *pipe = pipe_h;
+  /* The data may be given in the sink callback, map the buffers. */
+  if (_ml_tensors_data_map (_data, -1) != ML_ERROR_NONE)
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to map the buffers of the given data (ml_tensors_data_h).");
+
+  if (!elem->is_media_stream && !elem->is_flexible_tensor) {
+    if (elem->tensors_info.num_tensors != _data->num_tensors) {
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The src push of [%s] cannot be handled because the number of tensors in a frame mismatches. %u != %u",
+          elem->name, elem->tensors_info.num_tensors, _data->num_tensors);
+    }
+
+    for (i = 0; i < _data->num_tensors; i++) {
+      size_t sz = gst_tensors_info_get_size (&elem->tensors_info, i);
+
+      if (sz != _data->tensors[i].size) {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The given input tensor size (%d'th, %zu bytes) mismatches the source pad (%zu bytes)",
+            i, _data->tensors[i].size, sz);
+      }
+    }
   }
 
-  return status;
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Construct the pipeline (more info in nnstreamer.h)
+ * @brief Internal function to parse the tensors info of a src before pushing the data.
+ * @note The caller should lock the element.
  */
-int
-ml_pipeline_construct (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+static int
+_ml_pipeline_src_prepare (ml_pipeline_element * elem)
 {
-  /* not an internal pipeline construction */
-  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
-      FALSE);
+  int ret;
+
+  ret = ml_pipeline_src_parse_tensors_info (elem);
+
+  if (ret != ML_ERROR_NONE) {
+    if (ret == ML_ERROR_TRY_AGAIN)
+      _ml_error_report_continue
+          ("The pipeline is not ready to accept input streams. The input is ignored.");
+    else
+      _ml_error_report_continue
+          ("The pipeline is either not ready to accept input streams, yet, or does not have appropriate source elements to accept input streams.");
+  }
+
+  return ret;
 }
 
-#if defined (__TIZEN__)
 /**
- * @brief Construct the pipeline (Tizen internal, see nnstreamer-tizen-internal.h)
+ * @brief Buffer pool for the input frames of appsrc, allocating a memory for each tensor.
  */
-int
-ml_pipeline_construct_internal (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+typedef struct
 {
-  /* Tizen internal pipeline construction */
-  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
-      TRUE);
-}
-#endif /* __TIZEN__ */
+  GstBufferPool parent; /**< Parent instance */
+  guint num_mems; /**< The number of memories in a buffer */
+  gsize sizes[NNS_TENSOR_MEMORY_MAX]; /**< The size of each memory, including the header of flexible tensor */
+} MLPipelineSrcPool;
 
 /**
- * @brief Destroy the pipeline (more info in nnstreamer.h)
+ * @brief Class of the buffer pool for the input frames of appsrc.
  */
-int
-ml_pipeline_destroy (ml_pipeline_h pipe)
+typedef struct
 {
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
-  GstState state;
-  guint check_paused_cnt = 0;
+  GstBufferPoolClass parent_class; /**< Parent class */
+} MLPipelineSrcPoolClass;
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+G_DEFINE_TYPE (MLPipelineSrcPool, ml_pipeline_src_pool, GST_TYPE_BUFFER_POOL);
 
-  if (p == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle instance, usually created by ml_pipeline_construct().");
+/**
+ * @brief Allocates new buffer of the pool, with a memory for each tensor.
+ */
+static GstFlowReturn
+ml_pipeline_src_pool_alloc_buffer (GstBufferPool * pool, GstBuffer ** buffer,
+    GstBufferPoolAcquireParams * params)
+{
+  MLPipelineSrcPool *self = (MLPipelineSrcPool *) pool;
+  GstBuffer *buf;
+  GstMemory *mem;
+  guint i;
 
-  g_mutex_lock (&p->lock);
+  buf = gst_buffer_new ();
 
-  /* Before changing the state, remove all callbacks. */
-  p->state_cb.cb = NULL;
+  for (i = 0; i < self->num_mems; i++) {
+    mem = gst_allocator_alloc (NULL, self->sizes[i], NULL);
+    if (!mem) {
+      gst_buffer_unref (buf);
+      return GST_FLOW_ERROR;
+    }
 
-  /* Destroy registered callback handles and resources */
-  g_hash_table_destroy (p->namednodes);
-  g_hash_table_destroy (p->resources);
-  g_hash_table_destroy (p->pipe_elm_type);
-  p->namednodes = p->resources = p->pipe_elm_type = NULL;
+    gst_buffer_append_memory (buf, mem);
+  }
 
-  if (p->element) {
-    /* Pause the pipeline if it's playing */
-    scret = gst_element_get_state (p->element, &state, NULL, 10 * GST_MSECOND); /* 10ms */
-    if (scret != GST_STATE_CHANGE_FAILURE && state == GST_STATE_PLAYING) {
-      scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
-      if (scret == GST_STATE_CHANGE_FAILURE) {
-        g_mutex_unlock (&p->lock);
-        _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
-            "gst_element_get_state() has failed to wait until state changed from PLAYING to PAUSED and returned GST_STATE_CHANGE_FAILURE. For the detail, please check the GStreamer log messages (or dlog messages in Tizen). It is possible that there is a filter or neural network that is taking too much time to finish.");
-      }
-    }
+  *buffer = buf;
+  return GST_FLOW_OK;
+}
 
-    g_mutex_unlock (&p->lock);
-    while (p->pipe_state == ML_PIPELINE_STATE_PLAYING) {
-      check_paused_cnt++;
-      /** check PAUSED every 1ms */
-      g_usleep (1000);
-      if (check_paused_cnt >= WAIT_PAUSED_TIME_LIMIT) {
-        _ml_error_report
-            ("Timeout while waiting for a state change to 'PAUSED' from a 'sync-message' signal from the pipeline. It is possible that there is a filter or neural network that is taking too much time to finish.");
-        break;
-      }
-    }
-    g_mutex_lock (&p->lock);
+/**
+ * @brief Initializes the class of the buffer pool.
+ */
+static void
+ml_pipeline_src_pool_class_init (MLPipelineSrcPoolClass * klass)
+{
+  GstBufferPoolClass *pool_class = GST_BUFFER_POOL_CLASS (klass);
 
-    /* Stop (NULL State) the pipeline */
-    scret = gst_element_set_state (p->element, GST_STATE_NULL);
-    if (scret != GST_STATE_CHANGE_SUCCESS) {
-      g_mutex_unlock (&p->lock);
-      _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
-          "gst_element_set_state to stop the pipeline has failed after trying to stop the pipeline with PAUSE and waiting for stopping. For the detail, please check the GStreamer log messages. It is possible that there is a filter of neural network that is taking too much time to finish.");
-    }
+  pool_class->alloc_buffer = ml_pipeline_src_pool_alloc_buffer;
+}
 
-    if (p->bus) {
-      g_signal_handler_disconnect (p->bus, p->signal_msg);
-      gst_object_unref (p->bus);
-    }
+/**
+ * @brief Initializes the instance of the buffer pool.
+ */
+static void
+ml_pipeline_src_pool_init (MLPipelineSrcPool * self)
+{
+  self->num_mems = 0;
+}
 
-    gst_object_unref (p->element);
-    p->element = NULL;
-  }
+/**
+ * @brief Data structure for the input frame acquired from the buffer pool.
+ */
+typedef struct
+{
+  GstBuffer *buffer; /**< The pooled buffer, returned to the pool when released */
+  guint num_mems; /**< The number of mapped memories */
+  GstMapInfo map[NNS_TENSOR_MEMORY_MAX]; /**< The map info of the memories */
+} ml_pipeline_src_frame_s;
 
-  g_mutex_unlock (&p->lock);
-  g_mutex_clear (&p->lock);
+/**
+ * @brief Internal function to unmap the memories of the input frame.
+ */
+static void
+_ml_pipeline_src_frame_unmap (ml_pipeline_src_frame_s * frame)
+{
+  guint i;
 
-  g_free (p);
-  return ML_ERROR_NONE;
+  for (i = 0; i < frame->num_mems; i++)
+    gst_memory_unmap (gst_buffer_peek_memory (frame->buffer, i),
+        &frame->map[i]);
+
+  frame->num_mems = 0;
 }
 
 /**
- * @brief Get the pipeline state (more info in nnstreamer.h)
+ * @brief Internal function to release the input frame, returning the buffer to the pool.
  */
-int
-ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e * state)
+static void
+_ml_pipeline_src_frame_free (gpointer data)
 {
-  ml_pipeline *p = pipe;
-  GstState _state;
-  GstStateChangeReturn scret;
-
-  check_feature_state (ML_FEATURE_INFERENCE);
+  ml_pipeline_src_frame_s *frame = (ml_pipeline_src_frame_s *) data;
 
-  if (p == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
-  if (state == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, state, is NULL. It should be a valid pointer of ml_pipeline_state_e. E.g., ml_pipeline_state_e state; ml_pipeline_get_state(pipe, &state);");
+  if (!frame)
+    return;
 
-  *state = ML_PIPELINE_STATE_UNKNOWN;
+  if (frame->buffer) {
+    _ml_pipeline_src_frame_unmap (frame);
+    gst_buffer_unref (frame->buffer);
+  }
 
-  g_mutex_lock (&p->lock);
-  scret = gst_element_get_state (p->element, &_state, NULL, GST_MSECOND);       /* Do it within 1ms! */
-  g_mutex_unlock (&p->lock);
+  g_free (frame);
+}
 
-  if (scret == GST_STATE_CHANGE_FAILURE)
-    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
-        "Failed to get the state of the pipeline. For the detail, please check the GStreamer log messages.");
+/**
+ * @brief Internal function to release the buffer pool of a src.
+ * @note The caller should lock the element.
+ */
+static void
+_ml_pipeline_src_pool_release (ml_pipeline_element * elem)
+{
+  if (elem->pool) {
+    /* The buffers in use are released when the frames are destroyed. */
+    gst_buffer_pool_set_active (elem->pool, FALSE);
+    gst_object_unref (elem->pool);
+    elem->pool = NULL;
+  }
 
-  *state = (ml_pipeline_state_e) _state;
-  return ML_ERROR_NONE;
+  gst_tensors_info_free (&elem->pool_info);
 }
 
-/****************************************************
- ** NNStreamer Pipeline Start/Stop Control         **
- ****************************************************/
 /**
- * @brief Start/Resume the pipeline! (more info in nnstreamer.h)
+ * @brief Internal function to configure the buffer pool of a src with given tensors information.
+ * @note The caller should lock the element.
  */
-int
-ml_pipeline_start (ml_pipeline_h pipe)
+static int
+_ml_pipeline_src_pool_prepare (ml_pipeline_element * elem,
+    const GstTensorsInfo * info)
 {
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
-  int status = ML_ERROR_NONE;
+  MLPipelineSrcPool *pool;
+  GstStructure *config;
+  GstTensorMetaInfo meta;
+  gsize total = 0;
+  guint i;
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+  if (elem->pool && gst_tensors_info_is_equal (&elem->pool_info, info))
+    return ML_ERROR_NONE;
 
-  if (p == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h handle, which is usually created by ml_pipeline_construct ().");
+  /* The tensors information is changed (e.g., renegotiated). */
+  _ml_pipeline_src_pool_release (elem);
 
-  g_mutex_lock (&p->lock);
+  pool = (MLPipelineSrcPool *) g_object_new (ml_pipeline_src_pool_get_type (),
+      NULL);
+  pool->num_mems = info->num_tensors;
 
-  /* check the resources when starting the pipeline */
-  if (g_hash_table_size (p->resources)) {
-    GHashTableIter iter;
-    gpointer key, value;
+  for (i = 0; i < info->num_tensors; i++) {
+    GstTensorInfo *_info =
+        gst_tensors_info_get_nth_info ((GstTensorsInfo *) info, i);
 
-    /* iterate all handle and acquire res if released */
-    g_hash_table_iter_init (&iter, p->resources);
-    while (g_hash_table_iter_next (&iter, &key, &value)) {
-      if (g_str_has_prefix (key, "tizen")) {
-        status = get_tizen_resource (pipe, key);
-        if (status != ML_ERROR_NONE) {
-          _ml_error_report_continue
-              ("Internal API _ml_tizen_get_resource () has failed: Tizen mm resource manager has failed to acquire the resource of '%s'",
-              (gchar *) key);
-          goto done;
-        }
-      }
+    pool->sizes[i] = gst_tensor_info_get_size (_info);
+
+    if (elem->is_flexible_tensor) {
+      gst_tensor_info_convert_to_meta (_info, &meta);
+      pool->sizes[i] += gst_tensor_meta_info_get_header_size (&meta);
     }
+
+    total += pool->sizes[i];
   }
 
-  scret = gst_element_set_state (p->element, GST_STATE_PLAYING);
-  if (scret == GST_STATE_CHANGE_FAILURE) {
-    _ml_error_report
-        ("Failed to set the state of the pipeline to PLAYING. For the detail, please check the GStreamer log messages.");
-    status = ML_ERROR_STREAMS_PIPE;
+  config = gst_buffer_pool_get_config (GST_BUFFER_POOL (pool));
+  gst_buffer_pool_config_set_params (config, NULL, (guint) total, 0, 0);
+
+  if (!gst_buffer_pool_set_config (GST_BUFFER_POOL (pool), config) ||
+      !gst_buffer_pool_set_active (GST_BUFFER_POOL (pool), TRUE)) {
+    gst_object_unref (pool);
+    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
+        "Failed to configure the buffer pool of the src element [%s].",
+        elem->name);
   }
 
-done:
-  g_mutex_unlock (&p->lock);
-  return status;
+  elem->pool = GST_BUFFER_POOL (pool);
+  gst_tensors_info_copy (&elem->pool_info, info);
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Pause the pipeline! (more info in nnstreamer.h)
+ * @brief Internal function to acquire an input frame from the buffer pool of a src.
+ * @note The caller should lock the element and parse the tensors info of the element.
  */
-int
-ml_pipeline_stop (ml_pipeline_h pipe)
+static int
+_ml_pipeline_src_acquire_frame (ml_pipeline_element * elem,
+    const ml_tensors_info_h info, ml_tensors_data_h * data)
 {
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
+  GstTensorsInfo gst_info;
+  GstTensorMetaInfo meta;
+  GstBuffer *buffer = NULL;
+  GstMemory *mem;
+  ml_pipeline_src_frame_s *frame = NULL;
+  ml_tensors_info_h ml_info = NULL;
+  ml_tensors_data_s *_data = NULL;
+  gsize hsize;
+  guint i;
+  int status;
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+  gst_tensors_info_init (&gst_info);
 
-  if (p == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
+  if (info) {
+    status = _ml_tensors_info_copy_from_ml (&gst_info, info);
+    if (status != ML_ERROR_NONE)
+      goto done;
+  } else {
+    gst_tensors_info_copy (&gst_info, &elem->tensors_info);
+  }
 
-  g_mutex_lock (&p->lock);
-  scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
-  g_mutex_unlock (&p->lock);
+  if (!gst_tensors_info_validate (&gst_info)) {
+    _ml_error_report
+        ("The tensors information to acquire the data of src [%s] is invalid. If the src is flexible, the parameter, info, should be given.",
+        elem->name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
 
-  if (scret == GST_STATE_CHANGE_FAILURE)
-    _ml_error_report_return (ML_ERROR_STREAMS_PIPE,
-        "Failed to set the state of the pipeline to PAUSED. For the detail, please check the GStreamer log messages.");
+  if (!elem->is_flexible_tensor &&
+      !gst_tensors_info_is_equal (&gst_info, &elem->tensors_info)) {
+    _ml_error_report
+        ("The given tensors information mismatches the caps of src [%s].",
+        elem->name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
 
-  return ML_ERROR_NONE;
-}
+  if (gst_info.num_tensors > NNS_TENSOR_MEMORY_MAX) {
+    _ml_error_report
+        ("The buffer pool of src supports up to %d tensors, but the number of tensors is %u.",
+        NNS_TENSOR_MEMORY_MAX, gst_info.num_tensors);
+    status = ML_ERROR_NOT_SUPPORTED;
+    goto done;
+  }
 
-/**
- * @brief Clears all data and resets the running-time of the pipeline (more info in nnstreamer.h)
- */
-int
-ml_pipeline_flush (ml_pipeline_h pipe, bool start)
-{
-  ml_pipeline *p = pipe;
-  int status = ML_ERROR_NONE;
+  status = _ml_pipeline_src_pool_prepare (elem, &gst_info);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  if (gst_buffer_pool_acquire_buffer (elem->pool, &buffer,
+          NULL) != GST_FLOW_OK) {
+    _ml_error_report
+        ("Failed to acquire a buffer from the buffer pool of src [%s].",
+        elem->name);
+    status = ML_ERROR_STREAMS_PIPE;
+    goto done;
+  }
 
-  check_feature_state (ML_FEATURE_INFERENCE);
+  frame = g_new0 (ml_pipeline_src_frame_s, 1);
+  frame->buffer = buffer;
 
-  if (p == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe, is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
+  status = _ml_tensors_info_create_from_gst (&ml_info, &gst_info);
+  if (status != ML_ERROR_NONE)
+    goto done;
 
-  _ml_error_report_return_continue_iferr (ml_pipeline_stop (pipe),
-      "Failed to stop the pipeline with ml_pipeline_stop (). It has returned %d.",
-      _ERRNO);
+  status = _ml_tensors_data_create_no_alloc (ml_info,
+      (ml_tensors_data_h *) & _data);
+  if (status != ML_ERROR_NONE)
+    goto done;
 
-  _ml_logi ("The pipeline is stopped, clear all data from the pipeline.");
+  for (i = 0; i < gst_info.num_tensors; i++) {
+    mem = gst_buffer_peek_memory (buffer, i);
+    if (!gst_memory_map (mem, &frame->map[i], GST_MAP_READWRITE)) {
+      _ml_error_report ("Failed to map the memory of the pooled buffer.");
+      status = ML_ERROR_STREAMS_PIPE;
+      goto done;
+    }
 
-  /* send flush event to pipeline */
-  g_mutex_lock (&p->lock);
-  if (!gst_element_send_event (p->element, gst_event_new_flush_start ())) {
-    _ml_logw ("Error occurs while sending flush_start event.");
+    frame->num_mems++;
+    hsize = 0;
+
+    /* The header of flexible tensor is written in place. */
+    if (elem->is_flexible_tensor) {
+      gst_tensor_info_convert_to_meta (gst_tensors_info_get_nth_info
+          (&gst_info, i), &meta);
+      gst_tensor_meta_info_update_header (&meta, frame->map[i].data);
+      hsize = gst_tensor_meta_info_get_header_size (&meta);
+    }
+
+    _data->tensors[i].data = frame->map[i].data + hsize;
   }
 
-  if (!gst_element_send_event (p->element, gst_event_new_flush_stop (TRUE))) {
-    _ml_logw ("Error occurs while sending flush_stop event.");
+  _data->shared = _ml_tensors_data_shared_new (0, _ml_pipeline_src_frame_free,
+      frame);
+  if (!_data->shared) {
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
   }
-  g_mutex_unlock (&p->lock);
 
-  if (start && status == ML_ERROR_NONE)
-    status = ml_pipeline_start (pipe);
+  /* The frame is released with the data handle. */
+  frame = NULL;
+  *data = _data;
+  _data = NULL;
 
+done:
+  if (_data)
+    _ml_tensors_data_destroy_internal (_data, FALSE);
+  if (frame)
+    _ml_pipeline_src_frame_free (frame);
+  else if (buffer && status != ML_ERROR_NONE)
+    gst_buffer_unref (buffer);
+  if (ml_info)
+    ml_tensors_info_destroy (ml_info);
+  gst_tensors_info_free (&gst_info);
   return status;
 }
 
-/****************************************************
- ** NNStreamer Pipeline Sink/Src Control           **
- ****************************************************/
 /**
- * @brief Register a callback for sink (more info in nnstreamer.h)
+ * @brief Internal function to get the pooled buffer of the data to be pushed without copying.
+ * @note The caller should lock the data. Returns NULL if the data is not acquired from the buffer pool.
  */
-int
-ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
-    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+static GstBuffer *
+_ml_pipeline_src_take_pooled_buffer (ml_tensors_data_s * _data)
 {
-  ml_pipeline_element *elem;
-  ml_pipeline *p = pipe;
-  ml_pipeline_common_elem *sink;
-  int ret = ML_ERROR_NONE;
-
-  check_feature_state (ML_FEATURE_INFERENCE);
+  ml_pipeline_src_frame_s *frame;
+  GstBuffer *buffer;
 
-  if (h == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The argument, h (ml_pipeline_sink_h), is NULL. It should be a valid pointer to a new ml_pipeline_sink_h instance. E.g., ml_pipeline_sink_h h; ml_pipeline_sink_register (...., &h);");
+  if (!_data->shared || _data->shared->notify != _ml_pipeline_src_frame_free)
+    return NULL;
 
-  /* init null */
-  *h = NULL;
+  frame = (ml_pipeline_src_frame_s *) _data->shared->notify_data;
+  if (!frame->buffer)
+    return NULL;
 
-  if (pipe == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The argument, pipe (ml_pipeline_h), is NULL. It should be a valid ml_pipeline_h instance, usually created by ml_pipeline_construct.");
+  /* The pipeline reads the buffer, the handles sharing the frame should not write it. */
+  _ml_pipeline_src_frame_unmap (frame);
+  _data->shared->read_only = TRUE;
 
-  if (sink_name == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The argument, sink_name (const char *), is NULL. It should be a valid string naming the sink handle (h).");
+  if (g_atomic_int_get (&_data->shared->ref_count) == 1) {
+    /* Give the buffer to the pipeline, so that it is returned to the pool as soon as the pipeline releases it. */
+    buffer = frame->buffer;
+    frame->buffer = NULL;
+  } else {
+    buffer = gst_buffer_ref (frame->buffer);
+  }
 
-  if (cb == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The argument, cb (ml_pipeline_sink_cb), is NULL. It should be a call-back function called for data-sink events.");
+  return buffer;
+}
 
-  g_mutex_lock (&p->lock);
-  elem = g_hash_table_lookup (p->namednodes, sink_name);
+/**
+ * @brief Internal function to create a buffer to be pushed from the data frame.
+ * @note The caller should lock the data. If @a policy is auto-free, the buffer takes the tensor buffers of the data.
+ */
+static GstBuffer *
+_ml_pipeline_src_create_buffer (ml_pipeline_element * elem,
+    ml_tensors_data_s * _data, ml_pipeline_buf_policy_e policy)
+{
+  GstBuffer *buffer;
+  GstMemory *mem, *tmp;
+  gpointer mem_data;
+  gsize mem_size;
+  GstTensorsInfo gst_info;
+  unsigned int i;
 
-  if (elem == NULL) {
-    _ml_error_report
-        ("There is no element named [%s](sink_name) in the pipeline. Please check your pipeline description.",
-        sink_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+  /* The frame acquired from the buffer pool is pushed as it is. */
+  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+    buffer = _ml_pipeline_src_take_pooled_buffer (_data);
+    if (buffer)
+      return buffer;
   }
 
-  if (elem->type != ML_PIPELINE_ELEMENT_SINK &&
-      elem->type != ML_PIPELINE_ELEMENT_APP_SINK) {
-    _ml_error_report
-        ("The element [%s](sink_name) in the pipeline is not a sink element. Please supply the name of tensor_sink or appsink.",
-        sink_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
-  }
+  buffer = gst_buffer_new ();
+  _ml_tensors_info_copy_from_ml (&gst_info, _data->info);
 
-  if (elem->handle_id > 0) {
-    /* no need to connect signal to sink element */
-    _ml_logw ("Sink callback is already registered.");
-  } else {
-    /* set callback for new data */
-    if (elem->type == ML_PIPELINE_ELEMENT_SINK) {
-      /* tensor_sink */
-      g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
-          NULL);
-      elem->handle_id =
-          g_signal_connect (elem->element, "new-data",
-          G_CALLBACK (cb_sink_event), elem);
-    } else {
-      /* appsink */
-      g_object_set (G_OBJECT (elem->element), "emit-signals", (gboolean) TRUE,
-          NULL);
-      elem->handle_id =
-          g_signal_connect (elem->element, "new-sample",
-          G_CALLBACK (cb_appsink_new_sample), elem);
-    }
+  for (i = 0; i < _data->num_tensors; i++) {
+    GstTensorInfo *_gst_tensor_info =
+        gst_tensors_info_get_nth_info (&gst_info, i);
+    mem_data = _data->tensors[i].data;
+    mem_size = _data->tensors[i].size;
 
-    if (elem->handle_id == 0) {
-      _ml_error_report
-          ("Failed to connect a signal to the element [%s](sink_name). g_signal_connect has returned NULL.",
-          sink_name);
-      ret = ML_ERROR_STREAMS_PIPE;
-      goto unlock_return;
+    if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+      mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size, NULL, NULL);
+    } else if (_data->shared) {
+      /* The buffers may be shared with cloned handles. Each memory holds a reference. */
+      mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size,
+          _ml_tensors_data_shared_ref (_data->shared),
+          _ml_tensors_data_shared_unref);
+    } else {
+      mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size, mem_data, g_free);
     }
-  }
-
-  sink = g_new0 (ml_pipeline_common_elem, 1);
-  if (sink == NULL) {
-    _ml_error_report
-        ("Failed to allocate memory for the sink handle of %s. Out of memory?",
-        sink_name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
-    goto unlock_return;
-  }
-
-  sink->callback_info = g_new0 (callback_info_s, 1);
-  if (sink->callback_info == NULL) {
-    g_free (sink);
-    _ml_error_report
-        ("Failed to allocate memory for the sink handle of %s. Out of memory?",
-        sink_name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
-    goto unlock_return;
-  }
 
-  sink->pipe = p;
-  sink->element = elem;
-  sink->callback_info->sink_cb = cb;
-  sink->callback_info->sink_pdata = user_data;
-  *h = sink;
+    /* flex tensor, append header. */
+    if (elem->is_flexible_tensor) {
+      GstTensorMetaInfo meta;
 
-  g_mutex_lock (&elem->lock);
+      gst_tensor_info_convert_to_meta (_gst_tensor_info, &meta);
 
-  elem->maxid++;
-  sink->id = elem->maxid;
-  elem->handles = g_list_append (elem->handles, sink);
+      mem = gst_tensor_meta_info_append_header (&meta, tmp);
+      gst_memory_unref (tmp);
+    }
 
-  g_mutex_unlock (&elem->lock);
+    gst_tensor_buffer_append_memory (buffer, mem, _gst_tensor_info);
+    /** @todo Verify that gst_buffer_append lists tensors/gstmem in the correct order */
+  }
 
-unlock_return:
-  g_mutex_unlock (&p->lock);
-  return ret;
+  gst_tensors_info_free (&gst_info);
+  return buffer;
 }
 
 /**
- * @brief Unregister a callback for sink (more info in nnstreamer.h)
+ * @brief Internal function to get the error code from the result of pushing buffers.
  */
-int
-ml_pipeline_sink_unregister (ml_pipeline_sink_h h)
+static int
+_ml_pipeline_src_push_result (GstFlowReturn gret)
 {
-  handle_init (sink, h);
-
-  if (elem->handle_id > 0) {
-    g_signal_handler_disconnect (elem->element, elem->handle_id);
-    elem->handle_id = 0;
+  if (gret == GST_FLOW_FLUSHING) {
+    _ml_logw
+        ("The pipeline is not in PAUSED/PLAYING. The input may be ignored.");
+    return ML_ERROR_TRY_AGAIN;
+  } else if (gret == GST_FLOW_EOS) {
+    _ml_logw ("THe pipeline is in EOS state. The input is ignored.");
+    return ML_ERROR_STREAMS_PIPE;
   }
 
-  elem->handles = g_list_remove (elem->handles, sink);
-  free_element_handle (sink);
-
-  handle_exit (h);
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Parse tensors info of src element.
+ * @brief Push a data frame to a src (more info in nnstreamer.h)
  */
-static int
-ml_pipeline_src_parse_tensors_info (ml_pipeline_element * elem)
+int
+ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
+    ml_pipeline_buf_policy_e policy)
 {
-  GstCaps *caps = NULL;
-  gboolean found = FALSE, flexible = FALSE;
+  GstBuffer *buffer;
+  GstFlowReturn gret;
+  ml_tensors_data_s *_data;
 
-  if (elem->src == NULL) {
-    elem->src = gst_element_get_static_pad (elem->element, "src");
-  }
+  handle_init (src, h);
 
-  if (elem->src == NULL) {
+  _data = (ml_tensors_data_s *) data;
+  if (!_data) {
     _ml_error_report
-        ("Failed to get the src pad of the element[%s]. The designated source element does not have available src pad? For the detail, please check the GStreamer log messages.",
-        elem->name);
-    return ML_ERROR_STREAMS_PIPE;
+        ("The given parameter, data (ml_tensors_data_h), is NULL. It should be a valid ml_tensor_data_h instance, which is usually created by ml_tensors_data_create().");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
   }
+  G_LOCK_UNLESS_NOLOCK (*_data);
 
-  /* If caps is given, use it. e.g. Use cap "image/png" when the pipeline is */
-  /* given as "appsrc caps=image/png ! pngdec ! ... " */
-  caps = gst_pad_get_current_caps (elem->src);
-  if (!caps)
-    caps = gst_pad_get_allowed_caps (elem->src);
-
-  if (!caps) {
-    _ml_logw
-        ("Cannot find caps. The pipeline is not yet negotiated for src element [%s].",
-        elem->name);
-    gst_object_unref (elem->src);
-    elem->src = NULL;
-    return ML_ERROR_TRY_AGAIN;
+  /**
+   * Blocking push, wait until appsrc has a room under its queue limits.
+   * The element is unlocked while waiting, so check the caps after waiting.
+   */
+  if (elem->flow_timeout > 0) {
+    ret = _ml_pipeline_src_wait_room (p, elem, src, elem->flow_timeout);
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report
+          ("The src [%s] is not ready. Failed to push the data in %u ms.",
+          elem->name, elem->flow_timeout);
+      goto dont_destroy_data;
+    }
   }
 
-  found = get_tensors_info_from_caps (caps, &elem->tensors_info, &flexible);
+  ret = _ml_pipeline_src_prepare (elem);
+  if (ret != ML_ERROR_NONE)
+    goto dont_destroy_data;
 
-  if (found) {
-    elem->is_flexible_tensor = flexible;
-  } else {
-    if (gst_caps_is_fixed (caps)) {
-      GstStructure *st = gst_caps_get_structure (caps, 0);
-      elem->is_media_stream = !gst_structure_is_tensor_stream (st);
-    }
+  ret = _ml_pipeline_src_validate_data (elem, _data);
+  if (ret != ML_ERROR_NONE)
+    goto dont_destroy_data;
+
+  /* Create buffer to be pushed from buf[] */
+  buffer = _ml_pipeline_src_create_buffer (elem, _data, policy);
+
+  /* Unlock if it's not auto-free. We do not know when it'll be freed. */
+  if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE)
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+  /* Push the data! */
+  ml_trace (pipeline_src_push, h, elem->pipe, gst_buffer_get_size (buffer));
+  gret = gst_app_src_push_buffer (GST_APP_SRC (elem->element), buffer);
+
+  /* Free data ptr if buffer policy is auto-free */
+  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+    _ml_tensors_data_destroy_internal (_data, FALSE);
+    _data = NULL;
   }
 
-  gst_caps_unref (caps);
-  return ML_ERROR_NONE;
+  ret = _ml_pipeline_src_push_result (gret);
+  goto unlock_return;
+
+dont_destroy_data:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+  handle_exit (h);
 }
 
 /**
- * @brief Get a handle to operate a src (more info in nnstreamer.h)
+ * @brief Push multiple data frames to a src at once (more info in nnstreamer.h)
  */
 int
-ml_pipeline_src_get_handle (ml_pipeline_h pipe, const char *src_name,
-    ml_pipeline_src_h * h)
+ml_pipeline_src_input_data_batch (ml_pipeline_src_h h,
+    ml_tensors_data_h * data, unsigned int num_data,
+    ml_pipeline_buf_policy_e policy)
 {
-  ml_pipeline *p = pipe;
-  ml_pipeline_element *elem;
-  ml_pipeline_common_elem *src;
-  int ret = ML_ERROR_NONE;
-
-  check_feature_state (ML_FEATURE_INFERENCE);
-
-  if (h == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, h (ml_pipeline_src_h), is NULL. It should be a valid pointer to a new (or to be cleared) instance. E.g., ml_pipeline_src_h h; ml_pipeline_src_get_handle (..., &h);");
-
-  /* init null */
-  *h = NULL;
-
-  if (pipe == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, pipe (ml_pipeline_h), is NULL. It should be a valid ml_pipeline_h instance, which is usually created by ml_pipeline_construct().");
-
-  if (src_name == NULL)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, src_name (const char *), is NULL. This string is the name of source element (appsrc) you want to push data stream from your application threads.");
-
-  g_mutex_lock (&p->lock);
+  GstBufferList *list;
+  GstFlowReturn gret;
+  ml_tensors_data_s *_data;
+  unsigned int i, j;
 
-  elem = g_hash_table_lookup (p->namednodes, src_name);
+  handle_init (src, h);
 
-  if (elem == NULL) {
+  if (!data || num_data == 0) {
     _ml_error_report
-        ("Cannot find the name, '%s': there is no element named [%s] in the given pipeline.",
-        src_name, src_name);
+        ("The given parameter, data (ml_tensors_data_h *), is NULL or num_data is 0. It should be a valid array of ml_tensors_data_h instances, which are usually created by ml_tensors_data_create().");
     ret = ML_ERROR_INVALID_PARAMETER;
     goto unlock_return;
   }
 
-  if (elem->type != ML_PIPELINE_ELEMENT_APP_SRC) {
-    _ml_error_report
-        ("The element designated by '%s' is not a source element (appsrc). Please provide a name of source element for ml_pipeline_src_get_handle API.",
-        src_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+  /**
+   * Blocking push, wait until appsrc has a room under its queue limits.
+   * The element is unlocked while waiting, so check the caps after waiting.
+   */
+  if (elem->flow_timeout > 0) {
+    ret = _ml_pipeline_src_wait_room (p, elem, src, elem->flow_timeout);
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report
+          ("The src [%s] is not ready. Failed to push the data in %u ms.",
+          elem->name, elem->flow_timeout);
+      goto unlock_return;
+    }
   }
 
-  src = *h = g_new0 (ml_pipeline_common_elem, 1);
-  if (src == NULL) {
-    _ml_error_report
-        ("Failed to allocate the src handle for %s. Out of memory?", src_name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
+  /* Parse the caps once for all frames. */
+  ret = _ml_pipeline_src_prepare (elem);
+  if (ret != ML_ERROR_NONE)
     goto unlock_return;
+
+  /* Validate all frames first, so that no frame is consumed if one is invalid. */
+  for (i = 0; i < num_data; i++) {
+    _data = (ml_tensors_data_s *) data[i];
+    if (!_data) {
+      _ml_error_report
+          ("The %u'th data (ml_tensors_data_h) in the given array is NULL.",
+          i);
+      ret = ML_ERROR_INVALID_PARAMETER;
+      goto unlock_return;
+    }
+
+    /* The buffers of a handle are owned by a buffer only, with the policy auto-free. */
+    for (j = 0; j < i; j++) {
+      if (data[j] == data[i]) {
+        _ml_error_report
+            ("The %u'th data (ml_tensors_data_h) in the given array is same as the %u'th data. Each frame should be a different handle.",
+            i, j);
+        ret = ML_ERROR_INVALID_PARAMETER;
+        goto unlock_return;
+      }
+    }
+
+    G_LOCK_UNLESS_NOLOCK (*_data);
+    ret = _ml_pipeline_src_validate_data (elem, _data);
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+    if (ret != ML_ERROR_NONE) {
+      _ml_error_report_continue ("The %u'th data is invalid.", i);
+      goto unlock_return;
+    }
   }
 
-  src->pipe = p;
-  src->element = elem;
+  list = gst_buffer_list_new_sized (num_data);
 
-  g_mutex_lock (&elem->lock);
+  for (i = 0; i < num_data; i++) {
+    _data = (ml_tensors_data_s *) data[i];
 
-  elem->maxid++;
-  src->id = elem->maxid;
-  elem->handles = g_list_append (elem->handles, src);
+    G_LOCK_UNLESS_NOLOCK (*_data);
+    gst_buffer_list_add (list,
+        _ml_pipeline_src_create_buffer (elem, _data, policy));
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+  }
 
-  ml_pipeline_src_parse_tensors_info (elem);
-  g_mutex_unlock (&elem->lock);
+  /* Push the data! */
+  ml_trace (pipeline_src_push, h, elem->pipe,
+      gst_buffer_list_calculate_size (list));
+  gret = gst_app_src_push_buffer_list (GST_APP_SRC (elem->element), list);
 
-unlock_return:
-  g_mutex_unlock (&p->lock);
+  /* Free data handles if buffer policy is auto-free, the buffers are owned by the pipeline. */
+  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+    for (i = 0; i < num_data; i++) {
+      _ml_tensors_data_destroy_internal (data[i], FALSE);
+      data[i] = NULL;
+    }
+  }
 
-  return ret;
+  ret = _ml_pipeline_src_push_result (gret);
+
+  handle_exit (h);
 }
 
 /**
- * @brief Close a src node (more info in nnstreamer.h)
+ * @brief Gets a writable data frame from the buffer pool of a src (more info in nnstreamer.h)
  */
 int
-ml_pipeline_src_release_handle (ml_pipeline_src_h h)
+ml_pipeline_src_acquire_data (ml_pipeline_src_h h, const ml_tensors_info_h info,
+    ml_tensors_data_h * data)
 {
   handle_init (src, h);
 
-  elem->handles = g_list_remove (elem->handles, src);
-  free_element_handle (src);
+  if (!data) {
+    _ml_error_report
+        ("The given parameter, data (ml_tensors_data_h *), is NULL. It should be a valid pointer to get the data frame.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  *data = NULL;
+
+  ret = _ml_pipeline_src_prepare (elem);
+  if (ret != ML_ERROR_NONE)
+    goto unlock_return;
+
+  if (elem->is_media_stream) {
+    _ml_error_report
+        ("The src [%s] is not a tensor stream. The buffer pool is available for tensor stream only.",
+        elem->name);
+    ret = ML_ERROR_NOT_SUPPORTED;
+    goto unlock_return;
+  }
+
+  ret = _ml_pipeline_src_acquire_frame (elem, info, data);
+  if (ret != ML_ERROR_NONE)
+    _ml_error_report_continue
+        ("Failed to acquire the data frame from the buffer pool of src [%s].",
+        elem->name);
 
   handle_exit (h);
 }
 
 /**
- * @brief Push a data frame to a src (more info in nnstreamer.h)
+ * @brief Sets the flow control of a src (more info in nnstreamer.h)
  */
 int
-ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
-    ml_pipeline_buf_policy_e policy)
+ml_pipeline_src_set_flow_control (ml_pipeline_src_h h, const ml_option_h option)
 {
-  GstBuffer *buffer;
-  GstMemory *mem, *tmp;
-  gpointer mem_data;
-  gsize mem_size;
-  GstFlowReturn gret;
-  GstTensorsInfo gst_info;
-  ml_tensors_data_s *_data;
-  unsigned int i;
+  guint64 max_buffers = 0, max_bytes = 0, timeout = 0;
+  gboolean has_max_buffers = FALSE, has_max_bytes = FALSE;
+  GstPad *pad;
+  void *value;
 
   handle_init (src, h);
 
-  _data = (ml_tensors_data_s *) data;
-  if (!_data) {
+  if (!option) {
     _ml_error_report
-        ("The given parameter, data (ml_tensors_data_h), is NULL. It should be a valid ml_tensor_data_h instance, which is usually created by ml_tensors_data_create().");
+        ("The parameter, option (ml_option_h), is NULL. It should be a valid ml_option_h instance with the keys 'max_buffers', 'max_bytes' or 'timeout'.");
     ret = ML_ERROR_INVALID_PARAMETER;
     goto unlock_return;
   }
-  G_LOCK_UNLESS_NOLOCK (*_data);
 
-  if (_data->num_tensors < 1 || _data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
+  if (ML_ERROR_NONE == ml_option_get (option, "max_buffers", &value)) {
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 0,
+            G_MAXUINT, &max_buffers, NULL)) {
+      _ml_error_report
+          ("The option 'max_buffers' (%s) is invalid. It should be a non-negative integer.",
+          (const gchar *) value);
+      ret = ML_ERROR_INVALID_PARAMETER;
+      goto unlock_return;
+    }
+#if !GST_CHECK_VERSION(1, 20, 0)
     _ml_error_report
-        ("The number of tensors of the given data (ml_tensors_data_h) is invalid. The number of tensors of data is %u. It should be between 1 and %u.",
-        _data->num_tensors, ML_TENSOR_SIZE_LIMIT);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto dont_destroy_data;
-  }
-
-  ret = ml_pipeline_src_parse_tensors_info (elem);
-
-  if (ret != ML_ERROR_NONE) {
-    if (ret == ML_ERROR_TRY_AGAIN)
-      _ml_error_report_continue
-          ("The pipeline is not ready to accept input streams. The input is ignored.");
-    else
-      _ml_error_report_continue
-          ("The pipeline is either not ready to accept input streams, yet, or does not have appropriate source elements to accept input streams.");
-    goto dont_destroy_data;
+        ("The option 'max_buffers' is not supported with this version of GStreamer. Use 'max_bytes' instead.");
+    ret = ML_ERROR_NOT_SUPPORTED;
+    goto unlock_return;
+#endif
+    has_max_buffers = TRUE;
   }
 
-  if (!elem->is_media_stream && !elem->is_flexible_tensor) {
-    if (elem->tensors_info.num_tensors != _data->num_tensors) {
+  if (ML_ERROR_NONE == ml_option_get (option, "max_bytes", &value)) {
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 0,
+            G_MAXUINT64, &max_bytes, NULL)) {
       _ml_error_report
-          ("The src push of [%s] cannot be handled because the number of tensors in a frame mismatches. %u != %u",
-          elem->name, elem->tensors_info.num_tensors, _data->num_tensors);
-
+          ("The option 'max_bytes' (%s) is invalid. It should be a non-negative integer.",
+          (const gchar *) value);
       ret = ML_ERROR_INVALID_PARAMETER;
-      goto dont_destroy_data;
+      goto unlock_return;
     }
+    has_max_bytes = TRUE;
+  }
 
-    for (i = 0; i < _data->num_tensors; i++) {
-      size_t sz = gst_tensors_info_get_size (&elem->tensors_info, i);
-
-      if (sz != _data->tensors[i].size) {
-        _ml_error_report
-            ("The given input tensor size (%d'th, %zu bytes) mismatches the source pad (%zu bytes)",
-            i, _data->tensors[i].size, sz);
-
-        ret = ML_ERROR_INVALID_PARAMETER;
-        goto dont_destroy_data;
-      }
+  if (ML_ERROR_NONE == ml_option_get (option, "timeout", &value)) {
+    if (!g_ascii_string_to_unsigned ((const gchar *) value, 10, 0,
+            G_MAXUINT, &timeout, NULL)) {
+      _ml_error_report
+          ("The option 'timeout' (%s) is invalid. It should be a non-negative integer in milliseconds.",
+          (const gchar *) value);
+      ret = ML_ERROR_INVALID_PARAMETER;
+      goto unlock_return;
     }
   }
 
-  /* Create buffer to be pushed from buf[] */
-  buffer = gst_buffer_new ();
-  _ml_tensors_info_copy_from_ml (&gst_info, _data->info);
-
-  for (i = 0; i < _data->num_tensors; i++) {
-    GstTensorInfo *_gst_tensor_info =
-        gst_tensors_info_get_nth_info (&gst_info, i);
-    mem_data = _data->tensors[i].data;
-    mem_size = _data->tensors[i].size;
-
-    mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
-        mem_data, mem_size, 0, mem_size, mem_data,
-        (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
-
-    /* flex tensor, append header. */
-    if (elem->is_flexible_tensor) {
-      GstTensorMetaInfo meta;
-
-      gst_tensor_info_convert_to_meta (_gst_tensor_info, &meta);
-
-      mem = gst_tensor_meta_info_append_header (&meta, tmp);
-      gst_memory_unref (tmp);
+  /* Notify the waiting threads whenever appsrc pushes a buffer downstream. */
+  if (elem->flow_probe == 0) {
+    pad = gst_element_get_static_pad (elem->element, "src");
+    if (!pad) {
+      _ml_error_report ("Failed to get the src pad of the element [%s].",
+          elem->name);
+      ret = ML_ERROR_STREAMS_PIPE;
+      goto unlock_return;
     }
 
-    gst_tensor_buffer_append_memory (buffer, mem, _gst_tensor_info);
-    /** @todo Verify that gst_buffer_append lists tensors/gstmem in the correct order */
+    elem->flow_probe = gst_pad_add_probe (pad,
+        GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST,
+        _ml_pipeline_src_flow_probe, elem, NULL);
+    gst_object_unref (pad);
   }
 
-  gst_tensors_info_free (&gst_info);
+#if GST_CHECK_VERSION(1, 20, 0)
+  if (has_max_buffers)
+    gst_app_src_set_max_buffers (GST_APP_SRC (elem->element), max_buffers);
+#endif
+  if (has_max_bytes)
+    gst_app_src_set_max_bytes (GST_APP_SRC (elem->element), max_bytes);
 
-  /* Unlock if it's not auto-free. We do not know when it'll be freed. */
-  if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE)
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
+  elem->flow_timeout = (guint) timeout;
 
-  /* Push the data! */
-  gret = gst_app_src_push_buffer (GST_APP_SRC (elem->element), buffer);
+  /* Wake up the waiting threads to check the new limits. */
+  g_mutex_lock (&elem->flow_lock);
+  g_cond_broadcast (&elem->flow_cond);
+  g_mutex_unlock (&elem->flow_lock);
 
-  /* Free data ptr if buffer policy is auto-free */
-  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
-    _ml_tensors_data_destroy_internal (_data, FALSE);
-    _data = NULL;
-  }
+  handle_exit (h);
+}
 
-  if (gret == GST_FLOW_FLUSHING) {
-    _ml_logw
-        ("The pipeline is not in PAUSED/PLAYING. The input may be ignored.");
-    ret = ML_ERROR_TRY_AGAIN;
-  } else if (gret == GST_FLOW_EOS) {
-    _ml_logw ("THe pipeline is in EOS state. The input is ignored.");
-    ret = ML_ERROR_STREAMS_PIPE;
-  }
+/**
+ * @brief Waits until a src can accept an input frame (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_wait_ready (ml_pipeline_src_h h, unsigned int timeout)
+{
+  handle_init (src, h);
 
-  goto unlock_return;
+  if (elem->flow_probe == 0) {
+    _ml_error_report
+        ("The flow control of src [%s] is not set. Call ml_pipeline_src_set_flow_control() first.",
+        elem->name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
 
-dont_destroy_data:
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  ret = _ml_pipeline_src_wait_room (p, elem, src, timeout);
 
   handle_exit (h);
 }
@@ -2770,6 +4712,7 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
   ml_custom_filter_s *c;
   ml_tensors_data_h in_data, out_data;
   ml_tensors_data_s *_data;
+  gboolean locked;
   guint i;
 
   in_data = out_data = NULL;
@@ -2780,12 +4723,19 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "Internal error of callback function, ml_pipeline_custom_invoke. Its internal data structure is broken.");
 
-  g_mutex_lock (&c->lock);
+  /**
+   * The flag is not changed while the filter is used in the pipelines.
+   * The data handles are per thread, so the reentrant callback runs without the lock.
+   */
+  locked = !c->thread_safe;
+  if (locked)
+    g_mutex_lock (&c->lock);
 
-  /* prepare invoke */
-  status = _ml_tensors_data_create_no_alloc (c->in_info, &in_data);
+  /* prepare invoke, the data handles are reused not to allocate memory in every frame */
+  status = _ml_tensors_data_acquire_temp (
+      &((ml_tensors_info_s *) c->in_info)->info, &in_data);
   if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue ("_ml_tensors_data_create_no_alloc has failed.");
+    _ml_error_report_continue ("_ml_tensors_data_acquire_temp has failed.");
     goto done;
   }
 
@@ -2793,9 +4743,10 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
   for (i = 0; i < _data->num_tensors; i++)
     _data->tensors[i].data = in[i].data;
 
-  status = _ml_tensors_data_create_no_alloc (c->out_info, &out_data);
+  status = _ml_tensors_data_acquire_temp (
+      &((ml_tensors_info_s *) c->out_info)->info, &out_data);
   if (status != ML_ERROR_NONE) {
-    _ml_error_report_continue ("_ml_tensors_data_create_no_alloc has failed.");
+    _ml_error_report_continue ("_ml_tensors_data_acquire_temp has failed.");
     goto done;
   }
 
@@ -2807,10 +4758,11 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
   status = c->cb (in_data, out_data, c->pdata);
 
 done:
-  g_mutex_unlock (&c->lock);
+  if (locked)
+    g_mutex_unlock (&c->lock);
   /* NOTE: DO NOT free tensor data */
-  g_free (in_data);
-  g_free (out_data);
+  _ml_tensors_data_release_temp (in_data);
+  _ml_tensors_data_release_temp (out_data);
 
   return status;
 }
@@ -2915,6 +4867,38 @@ exit:
   return status;
 }
 
+/**
+ * @brief Sets the custom filter callback is thread-safe.
+ */
+int
+ml_pipeline_custom_easy_filter_set_thread_safe (ml_custom_easy_filter_h custom,
+    bool thread_safe)
+{
+  ml_custom_filter_s *c;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!custom)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, custom (ml_custom_easy_filter_h), is NULL. It should be a valid ml_custom_easy_filter_h instance, usually created by ml_pipeline_custom_easy_filter_register().");
+
+  c = (ml_custom_filter_s *) custom;
+  g_mutex_lock (&c->lock);
+
+  if (c->ref_count > 0) {
+    _ml_error_report
+        ("Failed to set the custom filter %s thread-safe, it is used in the pipeline. Its reference counter value is %u.",
+        c->name, c->ref_count);
+    status = ML_ERROR_INVALID_PARAMETER;
+  } else {
+    c->thread_safe = thread_safe;
+  }
+
+  g_mutex_unlock (&c->lock);
+  return status;
+}
+
 /**
  * @brief Unregisters the custom filter.
  */
@@ -3004,8 +4988,6 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
   ml_if_custom_s *c;
   ml_tensors_data_h in_data;
   ml_tensors_data_s *_data;
-  ml_tensors_info_h ml_info = NULL;
-  GstTensorsInfo in_info = *info;
   gboolean ret = FALSE;
 
   c = (ml_if_custom_s *) data;
@@ -3016,15 +4998,11 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
     _ml_error_report_return (FALSE,
         "Internal error: the parameter, data, is not valid. App thread might have touched internal data structure.");
 
-  status = _ml_tensors_info_create_from_gst (&ml_info, &in_info);
-  if (status != ML_ERROR_NONE)
-    _ml_error_report_return_continue (status,
-        "Cannot create tensors-info from the parameter, info (const GstTensorsInfo). _ml_tensors_info_create_from_gst has returned %d.",
-        status);
-  status = _ml_tensors_data_create_no_alloc (ml_info, &in_data);
+  /* The data handle and its info are reused not to allocate memory in every frame. */
+  status = _ml_tensors_data_acquire_temp (info, &in_data);
   if (status != ML_ERROR_NONE) {
     _ml_error_report_continue
-        ("Cannot create data entry from the given metadata, info (const GstTensorMemory, although we could create tensor-info from info. _ml_tensors_data_create_no_alloc() has returned %d.",
+        ("Cannot create data entry from the given metadata, info (const GstTensorsInfo). _ml_tensors_data_acquire_temp() has returned %d.",
         status);
     goto done;
   }
@@ -3035,7 +5013,7 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
 
   /* call invoke callback */
   g_mutex_lock (&c->lock);
-  status = c->cb (in_data, ml_info, result, c->pdata);
+  status = c->cb (in_data, _data->info, result, c->pdata);
   g_mutex_unlock (&c->lock);
 
   if (status == 0)
@@ -3045,9 +5023,7 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
         ("The callback function of if-statement has returned error: %d.", ret);
 
 done:
-  if (ml_info)
-    ml_tensors_info_destroy (ml_info);
-  g_free (in_data);
+  _ml_tensors_data_release_temp (in_data);
 
   return ret;
 }
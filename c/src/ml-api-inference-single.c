@@ -22,6 +22,7 @@
 #include "ml-api-inference-internal.h"
 #include "ml-api-internal.h"
 #include "ml-api-inference-single-internal.h"
+#include "ml-api-trace.h"
 
 #define ML_SINGLE_MAGIC 0xfeedfeed
 
@@ -137,6 +138,11 @@ typedef struct
   gboolean invoking;                  /**< invoke running flag */
   ml_tensors_data_h in_tensors;       /**< input tensor wrapper for processing */
   ml_tensors_data_h out_tensors;      /**< output tensor wrapper for processing */
+  ml_preprocess_s *preprocess;        /**< image pre-processing stage for input */
+  gboolean convert_input;             /**< true to convert the input to the tensor types of model */
+  gfloat convert_scale;               /**< quantization scale for input conversion */
+  gint convert_zero_point;            /**< quantization zero-point for input conversion */
+  gboolean convert_bf16;              /**< true if uint16 input of model is bfloat16 */
 
   GList *destroy_data_list;         /**< data to be freed by filter */
 } ml_single;
@@ -515,7 +521,9 @@ invoke_thread (void *arg)
     single_h->invoking = TRUE;
     alloc_output = single_h->free_output;
     g_mutex_unlock (&single_h->mutex);
+    ml_trace (single_thread_wake, single_h, _ml_trace_data_size (input));
     status = __invoke (single_h, input, output, alloc_output);
+    ml_trace (single_thread_complete, single_h, status);
     g_mutex_lock (&single_h->mutex);
     /* Clear input data after invoke is done. */
     ml_tensors_data_destroy (input);
@@ -1273,6 +1281,7 @@ ml_single_close (ml_single_h single)
 
   ml_tensors_data_destroy (single_h->in_tensors);
   ml_tensors_data_destroy (single_h->out_tensors);
+  _ml_preprocess_destroy (single_h->preprocess);
 
   g_cond_clear (&single_h->cond);
   g_mutex_clear (&single_h->mutex);
@@ -1312,6 +1321,12 @@ _ml_single_invoke_validate_data (ml_single_h single,
         (is_input) ? "input" : "output", _data->num_tensors,
         _model->num_tensors);
 
+  /* The data may be given in the sink callback, map the buffers. */
+  if (G_UNLIKELY (_ml_tensors_data_map (_data, -1) != ML_ERROR_NONE))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "Failed to map the buffers of %s tensors.",
+        (is_input) ? "input" : "output");
+
   for (i = 0; i < _data->num_tensors; i++) {
     if (G_UNLIKELY (!_data->tensors[i].data))
       _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
@@ -1328,6 +1343,41 @@ _ml_single_invoke_validate_data (ml_single_h single,
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to check whether the input data has different tensor types from the model.
+ */
+static gboolean
+_ml_single_input_needs_conversion (ml_single * single_h,
+    const ml_tensors_data_h data)
+{
+  ml_tensors_data_s *_data, *_model;
+  ml_tensors_info_s *_data_info, *_model_info;
+  GstTensorInfo *data_info, *model_info;
+  gboolean needed = FALSE;
+  guint i;
+
+  _data = (ml_tensors_data_s *) data;
+  _model = (ml_tensors_data_s *) single_h->in_tensors;
+
+  if (!_data || !_data->info || _data->num_tensors != _model->num_tensors)
+    return FALSE;
+
+  _data_info = (ml_tensors_info_s *) _data->info;
+  _model_info = (ml_tensors_info_s *) _model->info;
+
+  G_LOCK_UNLESS_NOLOCK (*_data_info);
+  for (i = 0; i < _data->num_tensors && !needed; i++) {
+    data_info = gst_tensors_info_get_nth_info (&_data_info->info, i);
+    model_info = gst_tensors_info_get_nth_info (&_model_info->info, i);
+
+    if (data_info && model_info && data_info->type != model_info->type)
+      needed = TRUE;
+  }
+  G_UNLOCK_UNLESS_NOLOCK (*_data_info);
+
+  return needed;
+}
+
 /**
  * @brief Internal function to invoke the model.
  *
@@ -1347,7 +1397,7 @@ _ml_single_invoke_internal (ml_single_h single,
     const gboolean need_alloc)
 {
   ml_single *single_h;
-  ml_tensors_data_h _in, _out;
+  ml_tensors_data_h _in, _out, _prep = NULL;
   gint64 end_time;
   int status = ML_ERROR_NONE;
 
@@ -1365,6 +1415,8 @@ _ml_single_invoke_internal (ml_single_h single,
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "(internal function) The parameter, output (ml_tensors_data_h *), is NULL. It should be a valid pointer to an instance of ml_tensors_data_h to store the inference results.");
 
+  ml_trace (single_invoke_enter, single, _ml_trace_data_size (input));
+
   ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
 
   if (G_UNLIKELY (!single_h->filter)) {
@@ -1374,8 +1426,34 @@ _ml_single_invoke_internal (ml_single_h single,
     goto exit;
   }
 
+  /* Pre-process the image into the input of the model */
+  if (single_h->preprocess) {
+    status = _ml_preprocess_run (single_h->preprocess, input,
+        ((ml_tensors_data_s *) single_h->in_tensors)->info, &_prep);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to pre-process the input data for the inference: error code %d.",
+          status);
+      goto exit;
+    }
+  } else if (single_h->convert_input &&
+      _ml_single_input_needs_conversion (single_h, input)) {
+    /* Convert the input into the tensor types of the model */
+    status = _ml_tensors_data_convert_to_info (input,
+        ((ml_tensors_data_s *) single_h->in_tensors)->info,
+        single_h->convert_scale, single_h->convert_zero_point,
+        single_h->convert_bf16, &_prep);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to convert the input data to the tensor types of the model: error code %d.",
+          status);
+      goto exit;
+    }
+  }
+
   /* Validate input/output data */
-  status = _ml_single_invoke_validate_data (single, input, TRUE);
+  status = _ml_single_invoke_validate_data (single, _prep ? _prep : input,
+      TRUE);
   if (status != ML_ERROR_NONE) {
     _ml_error_report_continue
         ("The input data for the inference is not valid: error code %d. Please check the dimensions, type, number-of-tensors, and size information of the input data.",
@@ -1413,6 +1491,15 @@ _ml_single_invoke_internal (ml_single_h single,
     status = _ml_tensors_data_clone_no_alloc (single_h->out_tensors, &_out);
     if (status != ML_ERROR_NONE)
       goto exit;
+
+    /* Fail early if the output would exceed the memory budget. */
+    status = _ml_tensors_data_account (_out, ML_MEMORY_ORIGIN_SINGLE_OUTPUT,
+        TRUE);
+    if (status != ML_ERROR_NONE) {
+      ml_tensors_data_destroy (_out);
+      _out = NULL;
+      goto exit;
+    }
   } else {
     _out = *output;
   }
@@ -1421,9 +1508,14 @@ _ml_single_invoke_internal (ml_single_h single,
    * Clone input data here to prevent use-after-free case.
    * We should release single_h->input after calling __invoke() function.
    */
-  status = ml_tensors_data_clone (input, &_in);
-  if (status != ML_ERROR_NONE)
-    goto exit;
+  if (_prep) {
+    _in = _prep;
+    _prep = NULL;
+  } else {
+    status = ml_tensors_data_clone (input, &_in);
+    if (status != ML_ERROR_NONE)
+      goto exit;
+  }
 
   single_h->state = RUNNING;
   single_h->free_output = need_alloc;
@@ -1478,8 +1570,13 @@ exit:
       *output = _out;
   }
 
+  if (_prep)
+    ml_tensors_data_destroy (_prep);
+
   single_h->input = single_h->output = NULL;
   ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+  ml_trace (single_invoke_exit, single, status);
   return status;
 }
 
@@ -1582,6 +1679,98 @@ ml_single_set_timeout (ml_single_h single, unsigned int timeout)
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Sets the image pre-processing stage applied to the input data before invoking the model.
+ */
+int
+ml_single_set_preprocess (ml_single_h single, const ml_option_h option)
+{
+  ml_single *single_h;
+  ml_preprocess_s *pp = NULL;
+  int status;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  if (option) {
+    status = _ml_preprocess_create (option, &pp);
+    if (status != ML_ERROR_NONE) {
+      ML_SINGLE_HANDLE_UNLOCK (single_h);
+      _ml_error_report_return_continue (status,
+          "Failed to parse the pre-processing option.");
+    }
+  }
+
+  _ml_preprocess_destroy (single_h->preprocess);
+  single_h->preprocess = pp;
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the conversion of input data to the tensor types of the model.
+ */
+int
+ml_single_set_input_conversion (ml_single_h single, const ml_option_h option)
+{
+  ml_single *single_h;
+  gfloat scale = 1.0f;
+  gint zero_point = 0;
+  gboolean bf16 = FALSE;
+  gchar *endptr;
+  void *value;
+
+  check_feature_state (ML_FEATURE_INFERENCE);
+
+  if (!single)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, single (ml_single_h), is NULL. It should be a valid instance of ml_single_h, which is usually created by ml_single_open().");
+
+  if (option) {
+    if (ML_ERROR_NONE == ml_option_get (option, "scale", &value)) {
+      scale = (gfloat) g_ascii_strtod ((const gchar *) value, &endptr);
+      if (endptr == (gchar *) value || *endptr != '\0' || scale <= 0.0f)
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The option 'scale' (%s) is invalid. It should be a positive number.",
+            (const gchar *) value);
+    }
+
+    if (ML_ERROR_NONE == ml_option_get (option, "zero_point", &value)) {
+      zero_point = (gint) g_ascii_strtoll ((const gchar *) value, &endptr, 10);
+      if (endptr == (gchar *) value || *endptr != '\0')
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The option 'zero_point' (%s) is invalid. It should be an integer.",
+            (const gchar *) value);
+    }
+
+    if (ML_ERROR_NONE == ml_option_get (option, "bfloat16", &value)) {
+      if (g_ascii_strcasecmp ((const gchar *) value, "true") == 0) {
+        bf16 = TRUE;
+      } else if (g_ascii_strcasecmp ((const gchar *) value, "false") != 0) {
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The option 'bfloat16' (%s) is invalid. It should be either 'true' or 'false'.",
+            (const gchar *) value);
+      }
+    }
+  }
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  single_h->convert_input = (option != NULL);
+  single_h->convert_scale = scale;
+  single_h->convert_zero_point = zero_point;
+  single_h->convert_bf16 = bf16;
+
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Sets the information (tensor dimension, type, name and so on) of required input data for the given model.
  */
@@ -146,6 +146,7 @@ typedef struct {
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
   bool is_extended; /**< True if tensors are extended */
   GstTensorsInfo info;
+  struct _ml_tensors_info_interned_s *interned; /**< The shared instance of the same configuration for fast comparison. NULL if not interned yet or the information is changed. */
 } ml_tensors_info_s;
 
 /**
@@ -206,6 +207,36 @@ typedef struct {
  */
 typedef int (*ml_handle_destroy_cb) (void *handle, void *user_data);
 
+/**
+ * @brief Enumeration for the origin of tensor memory, used for the memory accounting.
+ */
+typedef enum {
+  ML_MEMORY_ORIGIN_USER = 0, /**< Buffers allocated with ml_tensors_data_create() and its variants */
+  ML_MEMORY_ORIGIN_SINGLE_OUTPUT, /**< Output buffers of single-shot, including the outputs abandoned by timeout */
+  ML_MEMORY_ORIGIN_PIPELINE_SINK, /**< Pipeline buffers passed to the sink callbacks */
+  ML_MEMORY_ORIGIN_EXTENSION_QUEUE, /**< Input data queued in ml-service extension */
+  ML_MEMORY_ORIGIN_QUERY_QUEUE, /**< Output data queued in ml-service query client */
+
+  ML_MEMORY_ORIGIN_MAX
+} ml_memory_origin_e;
+
+/**
+ * @brief Reference-counted owner of tensor data buffers.
+ * @details Cloned tensors data handles share this block instead of copying the buffers (copy-on-write).
+ *          A handle copies the buffer of a tensor to its own block before writing if the block is shared or read-only.
+ */
+typedef struct _ml_tensors_data_shared_s {
+  gint ref_count; /**< The reference count, updated atomically */
+  gboolean read_only; /**< TRUE if the buffers should not be written (e.g., external memory) */
+  unsigned int num_blocks; /**< The number of memory blocks */
+  gpointer *blocks; /**< The memory blocks, released with g_free() unless notify is given */
+  GDestroyNotify notify; /**< The function to release external memory, called with notify_data */
+  gpointer notify_data; /**< The data to pass to the notify function */
+  ml_memory_origin_e origin; /**< The origin of the accounted memory */
+  gsize accounted; /**< The bytes accounted for the blocks, released with the last reference */
+  struct _ml_tensors_data_shared_s *parent; /**< The block holding the tensors not copied yet, released with the last reference. NULL if the block holds all tensors. */
+} ml_tensors_data_shared_s;
+
 /**
  * @brief An instance of input or output frames. #ml_tensors_info_h is the handle for tensors metadata.
  * @since_tizen 5.5
@@ -220,6 +251,14 @@ typedef struct {
   ml_handle_destroy_cb destroy; /**< The function to be called to release the allocated buffer */
   GMutex lock; /**< Lock for thread safety */
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
+  ml_tensors_data_shared_s *shared; /**< The owner of tensor buffers shared with cloned handles. NULL if the buffers are not reference-counted. */
+  ml_memory_origin_e origin; /**< The origin of the memory accounted for this handle */
+  gsize accounted; /**< The bytes accounted for this handle without the shared block, moved to the block when the buffers are retained */
+  int (*retain) (ml_tensors_data_h data, void *retain_data); /**< The function to set the shared owner of external buffers, called before sharing the buffers. NULL if the buffers cannot be retained. */
+  void *retain_data; /**< The data to pass to the retain function */
+  int (*map) (ml_tensors_data_h data, unsigned int index, void *map_data); /**< The function to map the buffer of a tensor on demand, called if the data of the tensor is NULL. NULL if the buffers are mapped. */
+  void *map_data; /**< The data to pass to the map function */
+  gboolean exposed; /**< TRUE if the writable buffer was given to the application. The clone copies the buffers in this case. */
 } ml_tensors_data_s;
 
 /**
@@ -283,6 +322,12 @@ gchar * _ml_replace_string (gchar * source, const gchar * what, const gchar * to
  */
 int _ml_tensors_info_compare (const ml_tensors_info_h info1, const ml_tensors_info_h info2, bool *equal);
 
+/**
+ * @brief Releases the interned configuration of the tensors information. This should be called whenever the type, dimension or the number of tensors is changed.
+ * @note This does not touch the lock. The caller should lock.
+ */
+void _ml_tensors_info_reset_interned (ml_tensors_info_s *info);
+
 /**
  * @brief Frees the tensors data handle and its data.
  * @param[in] data The handle of tensors data.
@@ -300,6 +345,148 @@ int _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_dat
  */
 int _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Creates a shared owner of tensor buffers with reference count 1.
+ * @param[in] num_blocks The number of memory blocks to be released with g_free().
+ * @param[in] notify The function to release the external memory. Set NULL to free the blocks.
+ * @param[in] notify_data The data to pass to @a notify.
+ * @return Newly created shared owner, NULL if failed to allocate memory.
+ */
+ml_tensors_data_shared_s * _ml_tensors_data_shared_new (unsigned int num_blocks, GDestroyNotify notify, gpointer notify_data);
+
+/**
+ * @brief Increases the reference count of shared tensor buffers.
+ */
+ml_tensors_data_shared_s * _ml_tensors_data_shared_ref (ml_tensors_data_shared_s *shared);
+
+/**
+ * @brief Decreases the reference count of shared tensor buffers and releases the buffers if the count reaches zero.
+ * @note The parameter type is gpointer to be used as GDestroyNotify.
+ */
+void _ml_tensors_data_shared_unref (gpointer shared);
+
+/**
+ * @brief Makes the buffer of a tensor writable, copying the shared or read-only buffer (copy-on-write).
+ * @details The buffers of other tensors are not copied. The pointers given before are still valid until the data is destroyed.
+ * @note The caller should lock the data handle.
+ * @param[in] data The tensors data.
+ * @param[in] index The index of tensor to be written. A negative value for all tensors.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int _ml_tensors_data_make_writable (ml_tensors_data_s *data, int index);
+
+/**
+ * @brief Maps the buffers of tensors which are not mapped yet (e.g., the pipeline buffers in the sink callback).
+ * @note The caller should lock the data handle. Call this before accessing the tensor buffers of the data given by the application.
+ * @param[in] data The tensors data.
+ * @param[in] index The index of tensor to be mapped. A negative value to map all tensors.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to map the buffer.
+ */
+int _ml_tensors_data_map (ml_tensors_data_s *data, int index);
+
+/**
+ * @brief Converts the elements of a tensor to the given type. The vectorized kernel is used if available.
+ * @details See ml_tensors_data_convert() for the quantization rule.
+ * @param[in] src_type The type of source elements.
+ * @param[in] src The source buffer.
+ * @param[in] dst_type The type of destination elements.
+ * @param[out] dst The destination buffer, which should hold @a count elements.
+ * @param[in] count The number of elements.
+ * @param[in] scale The quantization scale.
+ * @param[in] zero_point The quantization zero-point.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_convert_raw (ml_tensor_type_e src_type, const void *src, ml_tensor_type_e dst_type, void *dst, size_t count, float scale, int zero_point);
+
+/**
+ * @brief Converts the elements between bfloat16 and the floating point type.
+ * @param[in] type The floating point type of the elements, which are not bfloat16.
+ * @param[in] src The source buffer, which holds @a count elements.
+ * @param[out] dst The destination buffer, which should hold @a count elements.
+ * @param[in] count The number of elements.
+ * @param[in] to_bf16 TRUE to convert @a type to bfloat16, FALSE to convert bfloat16 to @a type.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_convert_bf16_raw (ml_tensor_type_e type, const void *src, void *dst, size_t count, gboolean to_bf16);
+
+/**
+ * @brief Converts the tensors data to newly allocated data with given tensors information.
+ * @details Each tensor should have the same number of elements in @a src and @a dst_info. The tensor types are converted with @a scale and @a zero_point as ml_tensors_data_convert() does.
+ *          If @a bf16 is TRUE, the tensor of type ML_TENSOR_TYPE_UINT16 is regarded as bfloat16 when it is converted from or to the floating point type.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_data_convert_to_info (const ml_tensors_data_h src, const ml_tensors_info_h dst_info, float scale, int zero_point, gboolean bf16, ml_tensors_data_h *dst);
+
+/**
+ * @brief Uses the scalar conversion kernels only. This is for testing and benchmarks.
+ */
+void _ml_tensors_convert_set_force_scalar (gboolean scalar);
+
+/**
+ * @brief Accounts the memory of given origin.
+ * @param[in] origin The origin of the memory.
+ * @param[in] size The size of the memory in bytes.
+ * @param[in] check_budget TRUE to fail if the memory budget is exceeded (see ml_api_set_memory_budget()).
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_OUT_OF_MEMORY The memory budget is exceeded.
+ */
+int _ml_memory_reserve (ml_memory_origin_e origin, gsize size, gboolean check_budget);
+
+/**
+ * @brief Releases the memory accounted with _ml_memory_reserve().
+ */
+void _ml_memory_release (ml_memory_origin_e origin, gsize size);
+
+/**
+ * @brief Accounts the tensor buffers of the data handle, until the handle is destroyed or _ml_tensors_data_unaccount() is called.
+ * @note If the handle has the shared block, the buffers are accounted once in the block and the handle moves the accounted memory of the block to the given origin. The memory of the block is released with the last reference of the block.
+ * @param[in] data The tensors data.
+ * @param[in] origin The origin of the memory.
+ * @param[in] check_budget TRUE to fail if the memory budget is exceeded.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_data_account (ml_tensors_data_s *data, ml_memory_origin_e origin, gboolean check_budget);
+
+/**
+ * @brief Releases the memory accounted for the data handle.
+ * @note This does not release the memory accounted in the shared block.
+ */
+void _ml_tensors_data_unaccount (ml_tensors_data_s *data);
+
+/**
+ * @brief Data structure for image pre-processing configuration.
+ */
+typedef struct _ml_preprocess_s ml_preprocess_s;
+
+/**
+ * @brief Creates the image pre-processing configuration from the option.
+ * @details See ml_tensors_data_preprocess() for the keys of the option.
+ * @param[in] option The handle of ml-option. It can be NULL.
+ * @param[out] pp The pre-processing configuration.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_preprocess_create (const ml_option_h option, ml_preprocess_s **pp);
+
+/**
+ * @brief Releases the image pre-processing configuration.
+ */
+void _ml_preprocess_destroy (ml_preprocess_s *pp);
+
+/**
+ * @brief Pre-processes the image tensor into newly allocated tensors data with the given information.
+ * @param[in] pp The pre-processing configuration.
+ * @param[in] src The handle of tensors data with an image tensor.
+ * @param[in] dst_info The handle of tensors information of the pre-processed data.
+ * @param[out] dst The handle of pre-processed tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_preprocess_run (const ml_preprocess_s *pp, const ml_tensors_data_h src, const ml_tensors_info_h dst_info, ml_tensors_data_h *dst);
+
 /**
  * @brief Creates ml-information instance.
  * @since_tizen 8.0
@@ -11,6 +11,7 @@
  */
 
 #include "ml-api-service-extension.h"
+#include "ml-api-trace.h"
 
 /**
  * @brief The time to wait for new input data in message thread, in millisecond.
@@ -257,6 +258,12 @@ _ml_extension_msg_thread (gpointer data)
         ext->timeout * G_TIME_SPAN_MILLISECOND);
 
     if (msg) {
+      ml_trace (extension_queue_pop, mls, _ml_trace_data_size (msg->input));
+
+      /* The message is not queued anymore. */
+      _ml_tensors_data_account ((ml_tensors_data_s *) msg->input,
+          ML_MEMORY_ORIGIN_USER, FALSE);
+
       switch (ext->type) {
         case ML_EXTENSION_TYPE_SINGLE:
         {
@@ -897,6 +904,16 @@ _ml_service_extension_request (ml_service_s * mls, const char *name,
     _ml_error_report_return (status, "Failed to clone input data.");
   }
 
+  status = _ml_tensors_data_account ((ml_tensors_data_s *) msg->input,
+      ML_MEMORY_ORIGIN_EXTENSION_QUEUE, TRUE);
+  if (status != ML_ERROR_NONE) {
+    _ml_extension_msg_free (msg);
+    _ml_error_report_return (status,
+        "Failed to push input data into the queue, the memory budget is exceeded.");
+  }
+
+  ml_trace (extension_queue_push, mls, _ml_trace_data_size (msg->input),
+      len + 1);
   g_async_queue_push (ext->msg_queue, msg);
 
   return ML_ERROR_NONE;
@@ -22,6 +22,7 @@
 #include <nnstreamer-edge.h>
 
 #include "ml-api-internal.h"
+#include "ml-api-trace.h"
 #include "ml-api-service.h"
 #include "ml-api-service-private.h"
 #include "ml-api-service-offloading.h"
@@ -367,6 +368,8 @@ _mlrs_process_service_offloading (nns_edge_data_h data_h, void *user_data)
         "Failed to get data while processing the ml-offloading service.");
   }
 
+  ml_trace (offloading_receive, mls, (gsize) data_len);
+
   ret = nns_edge_data_get_info (data_h, "service-type", &service_str);
   if (NNS_EDGE_ERROR_NONE != ret) {
     _ml_error_report_return (ret,
@@ -1162,16 +1165,27 @@ _ml_service_offloading_request (ml_service_h handle, const char *key,
     }
   }
   _in = (ml_tensors_data_s *) input;
+  G_LOCK_UNLESS_NOLOCK (*_in);
+  ret = _ml_tensors_data_map (_in, -1);
+  if (ML_ERROR_NONE != ret) {
+    G_UNLOCK_UNLESS_NOLOCK (*_in);
+    _ml_error_report ("Failed to map the tensors data to add the edge data.");
+    goto done;
+  }
+
   for (i = 0; i < _in->num_tensors; i++) {
     ret =
         nns_edge_data_add (data_h, _in->tensors[i].data, _in->tensors[i].size,
         NULL);
     if (NNS_EDGE_ERROR_NONE != ret) {
+      G_UNLOCK_UNLESS_NOLOCK (*_in);
       _ml_error_report ("Failed to add camera data to the edge data.");
       goto done;
     }
   }
+  G_UNLOCK_UNLESS_NOLOCK (*_in);
 
+  ml_trace (offloading_send, mls, _ml_trace_data_size (input));
   ret = nns_edge_send (offloading_s->edge_h, data_h);
   if (NNS_EDGE_ERROR_NONE != ret) {
     _ml_error_report
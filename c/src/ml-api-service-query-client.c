@@ -51,6 +51,8 @@ _sink_callback_for_query_client (const ml_tensors_data_h data,
     return;
   }
 
+  _ml_tensors_data_account ((ml_tensors_data_s *) copied,
+      ML_MEMORY_ORIGIN_QUERY_QUEUE, FALSE);
   g_async_queue_push (mls->out_data_queue, copied);
 }
 
@@ -256,5 +258,9 @@ ml_service_query_request (ml_service_h handle, const ml_tensors_data_h input,
     _ml_error_report_return (ML_ERROR_TIMED_OUT, "timeout!");
   }
 
+  /* The output is not queued anymore, it belongs to the user. */
+  _ml_tensors_data_account ((ml_tensors_data_s *) (*output),
+      ML_MEMORY_ORIGIN_USER, FALSE);
+
   return ML_ERROR_NONE;
 }
@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-trace.h
+ * @date 18 October 2026
+ * @brief ML C-API internal header for static tracepoints (USDT).
+ *        This file should NOT be exported to SDK or devel package.
+ * @see	https://github.com/nnstreamer/api
+ * @bug No known bugs except for NYI items
+ */
+#ifndef __ML_API_TRACE_H__
+#define __ML_API_TRACE_H__
+
+#include <glib.h>
+#include "ml-api-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * The tracepoints are defined in the provider "ml_api", and each probe passes the handle (as an id) first and the monotonic timestamp in microseconds last.
+ * See tools/tracing/ml-api-latency.bt for the list of probes and their arguments.
+ * If the build option 'enable-tracepoints' is disabled, the probes and their arguments are not compiled.
+ */
+#if defined (ENABLE_TRACEPOINTS)
+#include <sys/sdt.h>
+
+/**
+ * @brief Fires the static tracepoint with the handle, the given arguments and the timestamp.
+ */
+#define ml_trace(name, handle, ...) \
+    STAP_PROBEV (ml_api, name, (guintptr) (handle), ##__VA_ARGS__, g_get_monotonic_time ())
+
+/**
+ * @brief Internal function to get the total size of tensors data for the tracepoints.
+ */
+static inline gsize
+_ml_trace_data_size (const ml_tensors_data_h data)
+{
+  const ml_tensors_data_s *_data = (const ml_tensors_data_s *) data;
+  gsize size = 0;
+  guint i;
+
+  if (_data) {
+    for (i = 0; i < _data->num_tensors; i++)
+      size += _data->tensors[i].size;
+  }
+
+  return size;
+}
+#else
+#define ml_trace(name, handle, ...) do { } while (0)
+#endif /* ENABLE_TRACEPOINTS */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __ML_API_TRACE_H__ */
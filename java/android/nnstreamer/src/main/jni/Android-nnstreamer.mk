@@ -22,6 +22,11 @@ NNSTREAMER_CAPI_INCLUDES := \
 NNSTREAMER_SRC_FILES := \
     $(NNSTREAMER_COMMON_SRCS) \
     $(ML_API_ROOT)/c/src/ml-api-common.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-convert.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-preprocess.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-file.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-serialize.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-memory.c \
     $(ML_API_ROOT)/c/src/ml-api-inference-internal.c \
     $(ML_API_ROOT)/c/src/ml-api-inference-single.c
 
@@ -29,6 +34,9 @@ NNSTREAMER_SRC_FILES := \
 ifneq ($(NNSTREAMER_API_OPTION),single)
 NNSTREAMER_SRC_FILES += \
     $(ML_API_ROOT)/c/src/ml-api-inference-pipeline.c \
+    $(ML_API_ROOT)/c/src/ml-api-inference-pipeline-stats.c \
+    $(ML_API_ROOT)/c/src/ml-api-inference-pipeline-pool.c \
+    $(ML_API_ROOT)/c/src/ml-api-inference-pipeline-parallel.c \
     $(NNSTREAMER_PLUGINS_SRCS) \
     $(NNSTREAMER_SOURCE_AMC_SRCS) \
     $(NNSTREAMER_DECODER_BB_SRCS) \
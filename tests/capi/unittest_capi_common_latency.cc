@@ -0,0 +1,339 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file        unittest_capi_common_latency.cc
+ * @date        18 October 2026
+ * @brief       Unit test to measure the latency of common C-API data utilities.
+ * @see         https://github.com/nnstreamer/api
+ * @bug         No known bugs
+ */
+
+#define RUN_COUNT 100
+
+#include <gtest/gtest.h>
+#include <glib.h>
+#include <string.h>
+
+#include <ml-api-internal.h>
+#include <nnstreamer.h>
+
+/**
+ * @brief Internal function to create tensors data with given type and element count.
+ */
+static ml_tensors_data_h
+_create_data (ml_tensor_type_e type, unsigned int count)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = NULL;
+  ml_tensor_dimension dim = { count, 1, 1, 1 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, type);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+  ml_tensors_info_destroy (info);
+
+  return data;
+}
+
+/**
+ * @brief Internal function to measure the conversion latency.
+ */
+static gint64
+_measure_convert (ml_tensors_data_h src, ml_tensor_type_e type, gboolean scalar)
+{
+  ml_tensors_data_h dst;
+  gint64 start, total = 0;
+  int i, status;
+
+  _ml_tensors_convert_set_force_scalar (scalar);
+
+  for (i = 0; i < RUN_COUNT; i++) {
+    start = g_get_monotonic_time ();
+    status = ml_tensors_data_convert (src, type, 0.5f, 128, &dst);
+    total += g_get_monotonic_time () - start;
+
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (dst);
+  }
+
+  _ml_tensors_convert_set_force_scalar (FALSE);
+  return total / RUN_COUNT;
+}
+
+/**
+ * @brief Measure the latency of type conversion with vectorized and scalar kernels.
+ */
+TEST (nnstreamer_capi_common_latency, data_convert)
+{
+  const unsigned int count = 224 * 224 * 3;
+  ml_tensors_data_h u8_data, f32_data;
+  gint64 simd, scalar;
+
+  u8_data = _create_data (ML_TENSOR_TYPE_UINT8, count);
+  ASSERT_TRUE (u8_data != NULL);
+
+  ASSERT_EQ (ml_tensors_data_convert (u8_data, ML_TENSOR_TYPE_FLOAT32, 0.5f,
+      128, &f32_data), ML_ERROR_NONE);
+
+  simd = _measure_convert (u8_data, ML_TENSOR_TYPE_FLOAT32, FALSE);
+  scalar = _measure_convert (u8_data, ML_TENSOR_TYPE_FLOAT32, TRUE);
+  g_warning ("uint8 to float32 (%u elements): vectorized %" G_GINT64_FORMAT
+      " us, scalar %" G_GINT64_FORMAT " us", count, simd, scalar);
+
+  simd = _measure_convert (f32_data, ML_TENSOR_TYPE_UINT8, FALSE);
+  scalar = _measure_convert (f32_data, ML_TENSOR_TYPE_UINT8, TRUE);
+  g_warning ("float32 to uint8 (%u elements): vectorized %" G_GINT64_FORMAT
+      " us, scalar %" G_GINT64_FORMAT " us", count, simd, scalar);
+
+  simd = _measure_convert (f32_data, ML_TENSOR_TYPE_INT8, FALSE);
+  scalar = _measure_convert (f32_data, ML_TENSOR_TYPE_INT8, TRUE);
+  g_warning ("float32 to int8 (%u elements): vectorized %" G_GINT64_FORMAT
+      " us, scalar %" G_GINT64_FORMAT " us", count, simd, scalar);
+
+  ml_tensors_data_destroy (u8_data);
+  ml_tensors_data_destroy (f32_data);
+}
+
+/**
+ * @brief Internal function to measure the pre-processing latency.
+ */
+static gint64
+_measure_preprocess (ml_tensors_data_h src, ml_tensors_info_h info, const gchar *layout, const gchar *num_threads)
+{
+  ml_tensors_data_h dst;
+  ml_option_h option;
+  gint64 start, total = 0;
+  int i, status;
+
+  ml_option_create (&option);
+  ml_option_set (option, "layout", g_strdup (layout), g_free);
+  ml_option_set (option, "mean", g_strdup ("123.68,116.78,103.94"), g_free);
+  ml_option_set (option, "std", g_strdup ("58.40,57.12,57.38"), g_free);
+  if (num_threads)
+    ml_option_set (option, "num_threads", g_strdup (num_threads), g_free);
+
+  for (i = 0; i < RUN_COUNT; i++) {
+    start = g_get_monotonic_time ();
+    status = ml_tensors_data_preprocess (src, info, option, &dst);
+    total += g_get_monotonic_time () - start;
+
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (dst);
+  }
+
+  ml_option_destroy (option);
+  return total / RUN_COUNT;
+}
+
+/**
+ * @brief Internal function to measure the latency of unfused, hand-written pre-processing (bilinear resize, normalize and transpose in separate passes).
+ * @note The resize uses the same sampling as ml_tensors_data_preprocess(), with half-pixel centers.
+ */
+static gint64
+_measure_preprocess_naive (const guint8 *src, guint sw, guint sh, guint dw, guint dh)
+{
+  const float mean[] = { 123.68f, 116.78f, 103.94f };
+  const float std[] = { 58.40f, 57.12f, 57.38f };
+  float *resized = g_new (float, dw * dh * 3);
+  float *norm = g_new (float, dw * dh * 3);
+  float *out = g_new (float, dw * dh * 3);
+  gint64 start, total = 0;
+  guint x, y, c, x0, x1, y0, y1;
+  float fx, fy, wx, wy, top, bottom;
+  int i;
+
+  for (i = 0; i < RUN_COUNT; i++) {
+    start = g_get_monotonic_time ();
+
+    for (y = 0; y < dh; y++) {
+      fy = MAX (0.0f, (y + 0.5f) * sh / dh - 0.5f);
+      y0 = MIN ((guint) fy, sh - 1);
+      y1 = MIN (y0 + 1, sh - 1);
+      wy = fy - y0;
+
+      for (x = 0; x < dw; x++) {
+        fx = MAX (0.0f, (x + 0.5f) * sw / dw - 0.5f);
+        x0 = MIN ((guint) fx, sw - 1);
+        x1 = MIN (x0 + 1, sw - 1);
+        wx = fx - x0;
+
+        for (c = 0; c < 3; c++) {
+          top = src[(y0 * sw + x0) * 3 + c] * (1.0f - wx) + src[(y0 * sw + x1) * 3 + c] * wx;
+          bottom = src[(y1 * sw + x0) * 3 + c] * (1.0f - wx) + src[(y1 * sw + x1) * 3 + c] * wx;
+          resized[(y * dw + x) * 3 + c] = top * (1.0f - wy) + bottom * wy;
+        }
+      }
+    }
+
+    for (x = 0; x < dw * dh * 3; x++)
+      norm[x] = (resized[x] - mean[x % 3]) / std[x % 3];
+
+    for (c = 0; c < 3; c++)
+      for (x = 0; x < dw * dh; x++)
+        out[c * dw * dh + x] = norm[x * 3 + c];
+
+    total += g_get_monotonic_time () - start;
+  }
+
+  g_free (resized);
+  g_free (norm);
+  g_free (out);
+  return total / RUN_COUNT;
+}
+
+/**
+ * @brief Measure the latency of fused image pre-processing with orange.raw.
+ */
+TEST (nnstreamer_capi_common_latency, data_preprocess)
+{
+  const guint dw = 512, dh = 512;
+  ml_tensors_info_h img_info, info;
+  ml_tensors_data_h image;
+  ml_tensor_dimension img_dim = { 3, 224, 224, 1 };
+  ml_tensor_dimension nhwc_dim = { 3, dw, dh, 1 };
+  ml_tensor_dimension nchw_dim = { dw, dh, 3, 1 };
+  gchar *raw;
+  gsize raw_size;
+  gint64 fused1, fused, naive;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_get_contents (orange_raw_file, &raw, &raw_size, NULL));
+  ASSERT_EQ (raw_size, 224U * 224U * 3U);
+
+  ml_tensors_info_create (&img_info);
+  ml_tensors_info_set_count (img_info, 1);
+  ml_tensors_info_set_tensor_type (img_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (img_info, 0, img_dim);
+  ml_tensors_data_create (img_info, &image);
+  ml_tensors_data_set_tensor_data (image, 0, raw, raw_size);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+
+  naive = _measure_preprocess_naive ((const guint8 *) raw, 224, 224, dw, dh);
+
+  ml_tensors_info_set_tensor_dimension (info, 0, nhwc_dim);
+  fused1 = _measure_preprocess (image, info, "NHWC", "1");
+  fused = _measure_preprocess (image, info, "NHWC", NULL);
+  g_warning ("orange.raw 224x224 to float32 %ux%u NHWC: fused %" G_GINT64_FORMAT
+      " us, fused single thread %" G_GINT64_FORMAT " us", dw, dh, fused, fused1);
+
+  ml_tensors_info_set_tensor_dimension (info, 0, nchw_dim);
+  fused1 = _measure_preprocess (image, info, "NCHW", "1");
+  fused = _measure_preprocess (image, info, "NCHW", NULL);
+  g_warning ("orange.raw 224x224 to float32 %ux%u NCHW: fused %" G_GINT64_FORMAT
+      " us, fused single thread %" G_GINT64_FORMAT " us, unfused bilinear %" G_GINT64_FORMAT " us",
+      dw, dh, fused, fused1, naive);
+
+  g_free (raw);
+  ml_tensors_data_destroy (image);
+  ml_tensors_info_destroy (img_info);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Internal function to measure the latency of ml-information used for an event.
+ */
+static gint64
+_measure_information (void)
+{
+  ml_information_h info;
+  void *value;
+  gint64 start, total = 0;
+  int i, j, status;
+
+  for (i = 0; i < RUN_COUNT; i++) {
+    start = g_get_monotonic_time ();
+    for (j = 0; j < 1000; j++) {
+      _ml_information_create (&info);
+      _ml_information_set (info, "name", (void *) "output", NULL);
+      _ml_information_set (info, "data", (void *) &j, NULL);
+      status = ml_information_get (info, "data", &value);
+      ml_information_destroy (info);
+    }
+    total += g_get_monotonic_time () - start;
+
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  return total / RUN_COUNT;
+}
+
+/**
+ * @brief Internal function to measure the latency of the hash table with same usage, which was used for ml-information.
+ */
+static gint64
+_measure_information_hash (void)
+{
+  GHashTable *table;
+  gpointer value = NULL;
+  gint64 start, total = 0;
+  int i, j;
+
+  for (i = 0; i < RUN_COUNT; i++) {
+    start = g_get_monotonic_time ();
+    for (j = 0; j < 1000; j++) {
+      table = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+      /* each value was allocated to keep the destroy function */
+      g_hash_table_insert (table, g_strdup ("name"), g_new0 (gpointer, 2));
+      g_hash_table_insert (table, g_strdup ("data"), g_new0 (gpointer, 2));
+      value = g_hash_table_lookup (table, "data");
+      g_hash_table_destroy (table);
+    }
+    total += g_get_monotonic_time () - start;
+
+    EXPECT_TRUE (value != NULL);
+  }
+
+  return total / RUN_COUNT;
+}
+
+/**
+ * @brief Measure the latency of ml-information created for every event.
+ */
+TEST (nnstreamer_capi_common_latency, information)
+{
+  gint64 flat, hash;
+
+  flat = _measure_information ();
+  hash = _measure_information_hash ();
+  g_warning ("1000 events with 2 values: ml-information %" G_GINT64_FORMAT
+      " us, hash table %" G_GINT64_FORMAT " us", flat, hash);
+}
+
+/**
+ * @brief Main gtest
+ */
+int
+main (int argc, char **argv)
+{
+  int result = -1;
+
+  try {
+    testing::InitGoogleTest (&argc, argv);
+  } catch (...) {
+    g_warning ("catch 'testing::internal::<unnamed>::ClassUniqueToAlwaysTrue'");
+  }
+
+  /* ignore tizen feature status while running the testcases */
+  set_feature_state (ML_FEATURE, SUPPORTED);
+
+  try {
+    result = RUN_ALL_TESTS ();
+  } catch (...) {
+    g_warning ("catch `testing::internal::GoogleTestFailureException`");
+  }
+
+  set_feature_state (ML_FEATURE, NOT_CHECKED_YET);
+
+  return result;
+}
@@ -8,6 +8,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include <glib.h>
 #include <glib/gstdio.h> /* GStatBuf */
 #include <ml-api-inference-internal.h>
@@ -223,6 +224,87 @@ TEST (nnstreamer_capi_construct_destruct, failure_02_n)
   EXPECT_EQ (status, ML_ERROR_STREAMS_PIPE);
 }
 
+/**
+ * @brief Data to count the pipelines destroyed asynchronously.
+ */
+typedef struct {
+  GMutex lock;
+  GCond cond;
+  guint destroyed;
+  guint failed;
+} TestDestroyAsync;
+
+/**
+ * @brief Callback to count the pipelines destroyed asynchronously.
+ */
+static void
+test_destroy_async_callback (int status, void *user_data)
+{
+  TestDestroyAsync *data = (TestDestroyAsync *) user_data;
+
+  g_mutex_lock (&data->lock);
+  data->destroyed++;
+  if (status != ML_ERROR_NONE)
+    data->failed++;
+  g_cond_signal (&data->cond);
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief Test NNStreamer pipeline destroyed asynchronously.
+ */
+TEST (nnstreamer_capi_construct_destruct, destroy_async_01_p)
+{
+  const char *pipeline = "videotestsrc is-live=true ! videoconvert ! tensor_converter ! tensor_sink";
+  ml_pipeline_h handle[4];
+  TestDestroyAsync data;
+  gint64 end_time;
+  guint i;
+  int status;
+
+  g_mutex_init (&data.lock);
+  g_cond_init (&data.cond);
+  data.destroyed = data.failed = 0;
+
+  for (i = 0; i < 4; i++) {
+    status = ml_pipeline_construct (pipeline, NULL, NULL, &handle[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_start (handle[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  for (i = 0; i < 4; i++) {
+    status = ml_pipeline_destroy_async (handle[i], test_destroy_async_callback, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  end_time = g_get_monotonic_time () + 5 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&data.lock);
+  while (data.destroyed < 4) {
+    if (!g_cond_wait_until (&data.cond, &data.lock, end_time))
+      break;
+  }
+  g_mutex_unlock (&data.lock);
+
+  EXPECT_EQ (data.destroyed, 4U);
+  EXPECT_EQ (data.failed, 0U);
+
+  g_mutex_clear (&data.lock);
+  g_cond_clear (&data.cond);
+}
+
+/**
+ * @brief Test NNStreamer pipeline destroyed asynchronously with invalid param.
+ */
+TEST (nnstreamer_capi_construct_destruct, destroy_async_02_n)
+{
+  int status;
+
+  status = ml_pipeline_destroy_async (NULL, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
 /**
  * @brief Test NNStreamer pipeline construct & destruct
  */
@@ -612,6 +694,333 @@ file_cmp (const gchar *f1, const gchar *f2)
   return cmp;
 }
 
+/**
+ * @brief Test NNStreamer pipeline statistics.
+ */
+TEST (nnstreamer_capi_playstop, stats_01_p)
+{
+  const char *pipeline = "videotestsrc num-buffers=5 ! videoconvert ! video/x-raw,format=RGB,width=32,height=32 ! tensor_converter name=conv ! queue name=q ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_information_list_h stats;
+  ml_information_h info;
+  unsigned int i, length;
+  guint *count_sink;
+  gchar *name;
+  uint64_t *value;
+  gboolean found = FALSE, found_queue = FALSE;
+  int status;
+
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_set_stats_enabled (handle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (*count_sink, 5);
+  EXPECT_EQ (*count_sink, 5U);
+
+  status = ml_pipeline_get_stats (handle, &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_information_list_length (stats, &length);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GE (length, 4U);
+
+  for (i = 0; i < length; i++) {
+    status = ml_information_list_get (stats, i, &info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_information_get (info, "name", (void **) &name);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    if (g_str_equal (name, "conv")) {
+      found = TRUE;
+
+      status = ml_information_get (info, "buffers_in", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (*value, 5U);
+
+      status = ml_information_get (info, "buffers_out", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (*value, 5U);
+
+      status = ml_information_get (info, "latency_p50", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    } else if (g_str_equal (name, "q")) {
+      found_queue = TRUE;
+
+      /* The queue pushes the buffers in its own thread, the latency is not measured. */
+      status = ml_information_get (info, "latency_p50", (void **) &value);
+      EXPECT_NE (status, ML_ERROR_NONE);
+
+      status = ml_information_get (info, "queue_level", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+    }
+  }
+
+  EXPECT_TRUE (found);
+  EXPECT_TRUE (found_queue);
+  ml_information_list_destroy (stats);
+
+  /* The statistics is not available after disabling it. */
+  status = ml_pipeline_set_stats_enabled (handle, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_get_stats (handle, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (count_sink);
+}
+
+/**
+ * @brief Test NNStreamer pipeline statistics with invalid param.
+ */
+TEST (nnstreamer_capi_playstop, stats_02_n)
+{
+  const char *pipeline = "videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_information_list_h stats;
+  int status;
+
+  status = ml_pipeline_set_stats_enabled (NULL, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_get_stats (NULL, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Not enabled. */
+  status = ml_pipeline_get_stats (handle, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_set_stats_enabled (handle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_get_stats (handle, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* The statistics is released with the pipeline. */
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test NNStreamer pipeline pool.
+ */
+TEST (nnstreamer_capi_playstop, pool_01_p)
+{
+  const char *pipeline = "videotestsrc num-buffers=3 ! videoconvert ! video/x-raw,format=RGB,width=32,height=32 ! tensor_converter ! tensor_sink name=sinkx";
+  ml_pipeline_pool_h pool;
+  ml_pipeline_h handle, reused;
+  ml_pipeline_sink_h sinkhandle;
+  guint *count_sink;
+  int status;
+
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_pool_create (1, &pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_prepare (pool, pipeline, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_acquire (pool, pipeline, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (*count_sink, 3);
+  EXPECT_EQ (*count_sink, 3U);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_release (pool, handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The released pipeline is reset and reused. */
+  status = ml_pipeline_pool_acquire (pool, pipeline, &reused);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (reused, handle);
+
+  *count_sink = 0;
+  status = ml_pipeline_sink_register (
+      reused, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (reused);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (*count_sink, 3);
+  EXPECT_EQ (*count_sink, 3U);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_release (pool, reused);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_destroy (pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (count_sink);
+}
+
+/**
+ * @brief Test NNStreamer pipeline pool, the state set by the application is cleared when the pipeline is released.
+ */
+TEST (nnstreamer_capi_playstop, pool_03_p)
+{
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_pool_h pool;
+  ml_pipeline_h handle, reused;
+  ml_pipeline_src_h srchandle;
+  ml_information_list_h stats;
+  ml_option_h option;
+  int status;
+
+  status = ml_pipeline_pool_create (1, &pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_acquire (pool, pipeline, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_set_stats_enabled (handle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "max_bytes", g_strdup ("8"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_set_flow_control (srchandle, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_release (pool, handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The pipeline is released already. */
+  status = ml_pipeline_pool_release (pool, handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_pool_acquire (pool, pipeline, &reused);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (reused, handle);
+
+  /* The statistics and the flow control are not set. */
+  status = ml_pipeline_get_stats (reused, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_get_handle (reused, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_wait_ready (srchandle, 10);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_release (pool, reused);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_destroy (pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test NNStreamer pipeline pool with invalid param.
+ */
+TEST (nnstreamer_capi_playstop, pool_02_n)
+{
+  const char *pipeline = "videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx";
+  ml_pipeline_pool_h pool;
+  ml_pipeline_h handle, other;
+  ml_pipeline_sink_h sinkhandle;
+  int status;
+
+  status = ml_pipeline_pool_create (0, &pool);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_create (1, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_destroy (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_pool_create (1, &pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_prepare (pool, NULL, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_acquire (pool, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_acquire (pool, pipeline, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_acquire (pool, "invalid_element ! tensor_sink", &handle);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_acquire (pool, pipeline, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The handles of elements should be released. */
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_dm01, NULL, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_pool_release (pool, handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The pipeline not acquired from the pool. */
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &other);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_pool_release (pool, other);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (other);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_release (NULL, handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_release (pool, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_pool_release (pool, handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_pool_destroy (pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
 /**
  * @brief Test NNStreamer pipeline sink
  */
@@ -964,691 +1373,785 @@ TEST (nnstreamer_capi_sink, failure_06_n)
 }
 
 /**
- * @brief Test NNStreamer pipeline src
+ * @brief A tensor-sink callback taking a long time, to fill the queue of asynchronous sink.
  */
-TEST (nnstreamer_capi_src, dummy_01)
+static void
+test_sink_callback_slow (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
+{
+  g_usleep (50000); /* 50ms */
+  test_sink_callback_count (data, info, user_data);
+}
+
+/**
+ * @brief Test NNStreamer pipeline sink with asynchronous delivery.
+ */
+TEST (nnstreamer_capi_sink, set_async_01_p)
 {
-  const gchar *_tmpdir = g_get_tmp_dir ();
-  const gchar *_dirname = "nns-tizen-XXXXXX";
-  gchar *fullpath = g_build_path (G_DIR_SEPARATOR_S, _tmpdir, _dirname, NULL);
-  gchar *dir = g_mkdtemp ((gchar *) fullpath);
-  gchar *file1 = g_build_path (G_DIR_SEPARATOR_S, dir, "output", NULL);
-  gchar *pipeline = g_strdup_printf (
-      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
-      file1);
   ml_pipeline_h handle;
-  ml_pipeline_state_e state;
-  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_option_h option;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data1, data2;
-  unsigned int count = 0;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  ml_tensor_dimension dim = {
-    0,
-  };
+  guint *count_sink;
+  uint64_t dropped = 1;
 
-  int i;
-  uint8_t *uintarray1[10];
-  uint8_t *uintarray2[10];
-  uint8_t *content = NULL;
-  gsize len;
+  pipeline = g_strdup ("videotestsrc num-buffers=5 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false");
+
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (dir != NULL);
-  for (i = 0; i < 10; i++) {
-    uintarray1[i] = (uint8_t *) g_malloc (4);
-    ASSERT_TRUE (uintarray1[i] != NULL);
-    uintarray1[i][0] = i + 4;
-    uintarray1[i][1] = i + 1;
-    uintarray1[i][2] = i + 3;
-    uintarray1[i][3] = i + 2;
-
-    uintarray2[i] = (uint8_t *) g_malloc (4);
-    ASSERT_TRUE (uintarray2[i] != NULL);
-    uintarray2[i][0] = i + 3;
-    uintarray2[i][1] = i + 2;
-    uintarray2[i][2] = i + 1;
-    uintarray2[i][3] = i + 4;
-    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
-    /** @todo Check whether gstreamer really deallocates this */
-  }
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (10000); /* 10ms. Wait a bit. */
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
-  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
-  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_option_create (&option);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_option_set (option, "queue_size", g_strdup ("4"), g_free);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
-
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
-
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
-
-  status = ml_tensors_data_create (info, &data1);
+  status = ml_option_set (option, "overflow", g_strdup ("block"), g_free);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (info);
-
-  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
+  status = ml_pipeline_sink_set_async (sinkhandle, option);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  wait_pipeline_process_buffers (*count_sink, 5);
+  EXPECT_EQ (*count_sink, 5U);
+
+  /* Nothing is dropped with the blocking policy. */
+  status = ml_pipeline_sink_get_dropped_count (sinkhandle, &dropped);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
+  EXPECT_EQ (dropped, 0U);
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  /* Back to the synchronous delivery. */
+  status = ml_pipeline_sink_set_async (sinkhandle, NULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  g_free (pipeline);
+  g_free (count_sink);
+}
 
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
+/**
+ * @brief Test NNStreamer pipeline sink with asynchronous delivery, dropping the new data when the queue is full.
+ */
+TEST (nnstreamer_capi_sink, set_async_02_p)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_option_h option;
+  gchar *pipeline;
+  int status;
+  guint *count_sink;
+  uint64_t dropped = 0;
 
-  for (i = 0; i < 10; i++) {
-    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("videotestsrc num-buffers=20 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false");
 
-    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-    status = ml_tensors_data_create (info, &data2);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_slow, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "queue_size", g_strdup ("1"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "overflow", g_strdup ("drop-newest"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    g_usleep (50000); /* 50ms. Wait a bit. */
-  }
+  status = ml_pipeline_sink_set_async (sinkhandle, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (50000); /* Wait for the pipeline to flush all */
+  g_usleep (1000000); /* 1s. Let all frames flow. */
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-
-  EXPECT_TRUE (g_file_get_contents (file1, (gchar **) &content, &len, NULL));
-  EXPECT_EQ (len, 8U * 11);
-  EXPECT_TRUE (content != nullptr);
+  status = ml_pipeline_sink_get_dropped_count (sinkhandle, &dropped);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (dropped, 0U);
 
-  if (content && len == 88U) {
-    for (i = 0; i < 10; i++) {
-      EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
-      EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
-      EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
-      EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
-      EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
-      EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
-      EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
-      EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
-    }
-  }
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (content);
-  ml_tensors_info_destroy (info);
-  ml_tensors_data_destroy (data1);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i = 0; i < 10; i++) {
-    g_free (uintarray1[i]);
-    g_free (uintarray2[i]);
-  }
+  /* The streaming thread is not blocked by the slow callback. */
+  EXPECT_TRUE (*count_sink > 0U);
+  EXPECT_TRUE (*count_sink + dropped <= 20U);
 
-  g_free (fullpath);
-  g_free (file1);
+  g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when pipeline is NULL.
+ * @brief A tensor-sink callback calling the pipeline function, to test the release of asynchronous sink.
  */
-TEST (nnstreamer_capi_src, failure_01_n)
+static void
+test_sink_callback_get_state (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  int status;
-  ml_pipeline_src_h srchandle;
+  ml_pipeline_h pipe = (ml_pipeline_h) user_data;
+  ml_pipeline_state_e state;
 
-  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_usleep (50000); /* 50ms */
+  ml_pipeline_get_state (pipe, &state);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
+ * @brief Test NNStreamer pipeline sink with asynchronous delivery, unregistering the sink while the callback calls the pipeline function.
  */
-TEST (nnstreamer_capi_src, failure_02_n)
+TEST (nnstreamer_capi_sink, set_async_04_p)
 {
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_option_h option;
+  gchar *pipeline;
+  int status;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  pipeline = g_strdup ("videotestsrc num-buffers=20 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false");
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_get_state, handle, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "queue_size", g_strdup ("2"), g_free);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
- */
-TEST (nnstreamer_capi_src, failure_03_n)
-{
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  status = ml_pipeline_sink_set_async (sinkhandle, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_usleep (100000); /* 100ms. The callback is running. */
+
+  /* The worker thread is joined after unlocking the pipeline. */
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
+ * @brief Data structure for the sink callback unregistering its own handle.
  */
-TEST (nnstreamer_capi_src, failure_04_n)
+typedef struct {
+  ml_pipeline_sink_h sink; /**< The sink handle to be unregistered */
+  guint count; /**< The number of received data */
+  gboolean unregistered; /**< TRUE if the sink is unregistered in the callback */
+  int status; /**< The result of unregistering the sink */
+} test_sink_unregister_s;
+
+/**
+ * @brief A tensor-sink callback, slower than the pipeline, unregistering its own handle after 3 frames.
+ */
+static void
+test_sink_callback_unregister (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  test_sink_unregister_s *test = (test_sink_unregister_s *) user_data;
+  gboolean done;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* The queue is full while the callback is running. */
+  g_usleep (20000);
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  G_LOCK (callback_lock);
+  test->count++;
+  done = (test->count == 3);
+  G_UNLOCK (callback_lock);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (done) {
+    int status = ml_pipeline_sink_unregister (test->sink);
+
+    G_LOCK (callback_lock);
+    test->status = status;
+    test->unregistered = TRUE;
+    G_UNLOCK (callback_lock);
+  }
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
+ * @brief Test NNStreamer pipeline sink with asynchronous delivery, unregistering the sink in the callback while the streaming thread is blocked.
  */
-TEST (nnstreamer_capi_src, failure_05_n)
+TEST (nnstreamer_capi_sink, set_async_05_p)
 {
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
+  ml_option_h option;
+  test_sink_unregister_s *test;
+  gchar *pipeline;
+  int status;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  test = (test_sink_unregister_s *) g_malloc0 (sizeof (test_sink_unregister_s));
+  ASSERT_TRUE (test != NULL);
+
+  pipeline = g_strdup ("videotestsrc num-buffers=20 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false");
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : handle */
-  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_unregister, test, &test->sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "queue_size", g_strdup ("1"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "overflow", g_strdup ("block"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_set_async (test->sink, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The streaming thread waits for a room without the lock of sink element. */
+  wait_pipeline_process_buffers (test->unregistered, TRUE);
+  EXPECT_TRUE (test->unregistered);
+  EXPECT_EQ (test->status, ML_ERROR_NONE);
+  EXPECT_EQ (test->count, 3U);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+  g_free (test);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
+ * @brief Test NNStreamer pipeline sink with asynchronous delivery.
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_src, failure_06_n)
+TEST (nnstreamer_capi_sink, set_async_03_n)
 {
-  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
-  ml_tensors_data_h data;
-  ml_tensors_info_h info;
+  ml_pipeline_sink_h sinkhandle;
+  ml_option_h option;
+  gchar *pipeline;
+  int status;
+  guint *count_sink;
+  uint64_t dropped;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx");
+
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_option_create (&option);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_pipeline_sink_set_async (NULL, option);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_option_set (option, "queue_size", g_strdup ("0"), g_free);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_set_async (sinkhandle, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_create (info, &data);
+  status = ml_option_set (option, "queue_size", g_strdup ("2"), g_free);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "overflow", g_strdup ("invalid"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_set_async (sinkhandle, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* null data */
-  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  status = ml_pipeline_sink_get_dropped_count (NULL, &dropped);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_get_dropped_count (sinkhandle, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_src_release_handle (srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  status = ml_pipeline_stop (handle);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (data);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Internal function to push dummy into appsrc.
+ * @brief A tensor-sink callback keeping the data after the callback returns.
  */
 static void
-test_src_cb_push_dummy (ml_pipeline_src_h src_handle)
+test_sink_callback_ref (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  ml_tensors_data_h data;
-  ml_tensors_info_h info;
+  GQueue *queue = (GQueue *) user_data;
+  ml_tensors_data_h retained;
+  int status;
 
-  if (ml_pipeline_src_get_tensors_info (src_handle, &info) == ML_ERROR_NONE) {
-    ml_tensors_data_create (info, &data);
-    ml_pipeline_src_input_data (src_handle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
-    ml_tensors_info_destroy (info);
-  }
+  status = ml_tensors_data_ref (data, &retained);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (status != ML_ERROR_NONE)
+    return;
+
+  G_LOCK (callback_lock);
+  g_queue_push_tail (queue, retained);
+  G_UNLOCK (callback_lock);
 }
 
 /**
- * @brief appsrc callback - need_data.
+ * @brief Data structure to check the clones of sink data in consecutive frames.
+ */
+typedef struct {
+  guint frames; /**< The number of received frames */
+  gboolean shared[3]; /**< TRUE if the clone shares the buffer of sink data */
+} test_clone_frames_s;
+
+/**
+ * @brief A tensor-sink callback cloning the data, getting the writable buffer in the first frame only.
  */
 static void
-test_src_cb_need_data (ml_pipeline_src_h src_handle, unsigned int length, void *user_data)
+test_sink_callback_clone_frames (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  /* For test, push dummy if given src handles are same. */
-  if (src_handle == user_data)
-    test_src_cb_push_dummy (src_handle);
+  test_clone_frames_s *result = (test_clone_frames_s *) user_data;
+  ml_tensors_data_h cloned;
+  const void *raw, *cloned_raw;
+  void *writable;
+  size_t size;
+  guint frame;
+
+  G_LOCK (callback_lock);
+  frame = result->frames;
+  G_UNLOCK (callback_lock);
+
+  if (frame >= 3)
+    return;
+
+  if (frame == 0)
+    ml_tensors_data_get_tensor_data (data, 0, &writable, &size);
+
+  if (ml_tensors_data_clone (data, &cloned) != ML_ERROR_NONE)
+    return;
+
+  if (ml_tensors_data_peek_tensor_data (data, 0, &raw, &size) == ML_ERROR_NONE
+      && ml_tensors_data_peek_tensor_data (cloned, 0, &cloned_raw, &size) == ML_ERROR_NONE) {
+    G_LOCK (callback_lock);
+    result->shared[frame] = (raw == cloned_raw);
+    result->frames++;
+    G_UNLOCK (callback_lock);
+  }
+
+  ml_tensors_data_destroy (cloned);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink, the clone shares the buffers after the writable buffer is given in the previous frame.
  */
-TEST (nnstreamer_capi_src, callback_replace)
+TEST (nnstreamer_capi_sink, data_clone_frames_01_p)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle1, srchandle2;
   ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_src_callbacks_s callback = {
-    0,
-  };
-  guint *count_sink;
+  test_clone_frames_s *result;
   int status;
+  const char *pipeline = "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false";
 
-  callback.need_data = test_src_cb_need_data;
-
-  count_sink = (guint *) g_malloc0 (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
+  result = (test_clone_frames_s *) g_malloc0 (sizeof (test_clone_frames_s));
+  ASSERT_TRUE (result != NULL);
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_src_set_event_cb (srchandle1, &callback, srchandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+      handle, "sinkx", test_sink_callback_clone_frames, result, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  test_src_cb_push_dummy (srchandle1);
-  g_usleep (100000);
+  wait_pipeline_process_buffers (result->frames, 3);
+  EXPECT_EQ (result->frames, 3U);
 
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (*count_sink > 1U);
-
-  /* Set new callback with new handle. */
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* New callback will not push dummy. */
-  status = ml_pipeline_src_set_event_cb (srchandle2, &callback, srchandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (100000);
-  *count_sink = 0;
-  test_src_cb_push_dummy (srchandle2);
-  g_usleep (100000);
-
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (*count_sink == 1U);
-  g_free (count_sink);
+  /* The first clone is copied, the writable buffer was given to the callback. */
+  EXPECT_FALSE (result->shared[0]);
+  EXPECT_TRUE (result->shared[1]);
+  EXPECT_TRUE (result->shared[2]);
+
+  g_free (result);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink, keeping the sink data without copying it.
  */
-TEST (nnstreamer_capi_src, callback_invalid_param_01_n)
+TEST (nnstreamer_capi_sink, data_ref_01_p)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
-  ml_pipeline_src_callbacks_s callback = {
-    0,
-  };
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_data_h data;
+  gchar *pipeline;
   int status;
+  GQueue queue = G_QUEUE_INIT;
+  void *raw;
+  size_t size;
 
-  callback.need_data = test_src_cb_need_data;
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! tensor_converter ! tensor_sink name=sinkx sync=false");
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_ref, &queue, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param */
-  status = ml_pipeline_src_set_event_cb (NULL, &callback, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (g_queue_get_length (&queue), 3);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The data is valid after the pipeline is destroyed. */
+  EXPECT_EQ (g_queue_get_length (&queue), 3U);
+  while ((data = g_queue_pop_head (&queue)) != NULL) {
+    status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (raw != NULL);
+    EXPECT_EQ (size, 3U * 16U * 16U);
+
+    ml_tensors_data_destroy (data);
+  }
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink, pull the data from appsink.
  */
-TEST (nnstreamer_capi_src, callback_invalid_param_02_n)
+TEST (nnstreamer_capi_sink, pull_01_p)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  const char *pipeline = "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! tensor_converter ! appsink name=sinkx sync=false";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
+  unsigned int i, count;
+  void *raw;
+  size_t size;
   int status;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param */
-  status = ml_pipeline_src_set_event_cb (srchandle, NULL, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  for (i = 0; i < 3; i++) {
+    status = ml_pipeline_sink_pull (handle, "sinkx", 1000, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (raw != NULL);
+    EXPECT_EQ (size, 3U * 16U * 16U);
+
+    status = ml_tensors_data_get_info (data, &info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_info_get_count (info, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 1U);
+    ml_tensors_info_destroy (info);
+
+    ml_tensors_data_destroy (data);
+  }
+
+  /* End of stream. */
+  status = ml_pipeline_sink_pull (handle, "sinkx", 100, &data);
+  EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Check decoded orange.png with raw data.
+ * @brief Test NNStreamer pipeline sink, pull the data from tensor_sink.
  */
-static void
-check_orange_output (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
+TEST (nnstreamer_capi_sink, pull_02_p)
 {
+  const char *pipeline = "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! tensor_converter ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_tensors_data_h data;
+  unsigned int i;
+  void *raw;
+  size_t size;
   int status;
-  size_t data_size;
-  uint8_t *raw_content;
-  gsize raw_content_len;
-  gchar *orange_raw_file;
-
-  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
 
-  orange_raw_file = g_build_filename (
-      root_path, "tests", "test_models", "data", "orange.raw", NULL);
-  ASSERT_TRUE (g_file_test (orange_raw_file, G_FILE_TEST_EXISTS));
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (g_file_get_contents (
-      orange_raw_file, (gchar **) &raw_content, &raw_content_len, NULL));
+  /* tensor_sink keeps the data from the first call. */
+  status = ml_pipeline_sink_pull (handle, "sinkx", 0, &data);
+  EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
 
-  status = ml_tensors_data_get_tensor_data (data, 0, (void **) &data, &data_size);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_EQ (raw_content_len, data_size);
+  for (i = 0; i < 3; i++) {
+    status = ml_pipeline_sink_pull (handle, "sinkx", 1000, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = 0;
-  for (size_t i = 0; i < data_size; ++i) {
-    if (*(((uint8_t *) data) + i) != *(raw_content + i)) {
-      status = 1;
-      break;
-    }
-  }
+    status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (size, 3U * 16U * 16U);
 
-  EXPECT_EQ (status, 0);
+    /* The data is valid after the pipeline is destroyed. */
+    if (i == 2) {
+      status = ml_pipeline_destroy (handle);
+      EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (raw_content);
-  g_free (orange_raw_file);
+      status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_TRUE (raw != NULL);
+    }
+
+    ml_tensors_data_destroy (data);
+  }
 }
 
 /**
- * @brief Test NNStreamer pipeline src (appsrc with png file)
+ * @brief Test NNStreamer pipeline sink, pull the data with invalid param.
  */
-TEST (nnstreamer_capi_src, pngfile)
+TEST (nnstreamer_capi_sink, pull_03_n)
 {
-  int status, i;
-
+  const char *pipeline = "videotestsrc num-buffers=3 ! tensor_converter ! appsink name=sinkx sync=false";
   ml_pipeline_h handle;
   ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_src_h srchandle;
-  ml_pipeline_state_e state;
+  ml_tensors_data_h data;
+  int status;
 
-  ml_tensors_info_h in_info;
-  ml_tensor_dimension in_dim;
-  ml_tensors_data_h input = NULL;
+  status = ml_pipeline_sink_pull (NULL, "sinkx", 0, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  gchar *orange_png_file, *pipeline;
-  uint8_t *content;
-  gsize content_len;
-  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  orange_png_file = g_build_filename (
-      root_path, "tests", "test_models", "data", "orange.png", NULL);
-  ASSERT_TRUE (g_file_test (orange_png_file, G_FILE_TEST_EXISTS));
-
-  pipeline = g_strdup_printf (
-      "appsrc name=srcx caps=image/png ! pngdec ! videoconvert ! videoscale ! video/x-raw,format=RGB,width=224,height=224,framerate=0/1 ! tensor_converter ! tensor_sink name=sinkx sync=false async=false");
-
-  /* construct pipeline */
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* set sink callback */
-  status = ml_pipeline_sink_register (handle, "sinkx", check_orange_output, NULL, &sinkhandle);
+  status = ml_pipeline_sink_pull (handle, NULL, 0, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_pull (handle, "sinkx", 0, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_pull (handle, "invalid_name", 0, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* The data of appsink is passed to the callback. */
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_dm01, NULL, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_pull (handle, "sinkx", 0, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* set src_handle */
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+}
 
-  /* get the data of input png file */
-  EXPECT_TRUE (g_file_get_contents (orange_png_file, (gchar **) &content, &content_len, NULL));
+/**
+ * @brief A tensor-sink callback counting the data for each size (16x16 and 32x32 RGB).
+ */
+static void
+test_sink_callback_size (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
+{
+  guint *count = (guint *) user_data;
+  void *raw;
+  size_t size;
 
-  /* set ml_tensors_info */
-  ml_tensors_info_create (&in_info);
-  in_dim[0] = content_len;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  for (i = 4; i < ML_TENSOR_RANK_LIMIT; i++)
-    in_dim[i] = 0;
+  if (ml_tensors_data_get_tensor_data (data, 0, &raw, &size) != ML_ERROR_NONE)
+    return;
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  G_LOCK (callback_lock);
+  if (size == 3U * 16U * 16U)
+    count[0]++;
+  else if (size == 3U * 32U * 32U)
+    count[1]++;
+  G_UNLOCK (callback_lock);
+}
 
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+/**
+ * @brief Test NNStreamer pipeline sink, the caps is changed in the stream.
+ */
+TEST (nnstreamer_capi_sink, caps_changed_01_p)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  ml_pipeline_sink_h sinkhandle;
+  guint *count;
+  int status;
+  const char *pipeline = "input-selector name=ins ! tensor_sink name=sinkx sync=false "
+      "videotestsrc is-live=true ! video/x-raw,format=RGB,width=16,height=16,framerate=30/1 ! tensor_converter ! ins.sink_0 "
+      "videotestsrc is-live=true ! video/x-raw,format=RGB,width=32,height=32,framerate=30/1 ! tensor_converter ! ins.sink_1";
 
-  status = ml_pipeline_start (handle);
+  count = (guint *) g_malloc0 (sizeof (guint) * 2);
+  ASSERT_TRUE (count != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_get_state (handle, &state);
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_size, count, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (input, 0, content, content_len);
+  status = ml_pipeline_switch_select (switchhandle, "sink_0");
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_input_data (srchandle, input, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (1000 * 1000);
+  wait_pipeline_process_buffers (count[0], 3);
+  EXPECT_GE (count[0], 3U);
 
-  status = ml_pipeline_stop (handle);
+  /* The sink receives new caps, the data should be handled with new information. */
+  status = ml_pipeline_switch_select (switchhandle, "sink_1");
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (1000 * 1000);
+  wait_pipeline_process_buffers (count[1], 3);
+  EXPECT_GE (count[1], 3U);
 
-  status = ml_pipeline_get_state (handle, &state);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PAUSED);
 
-  /* release handles and allocated memory */
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_sink_unregister (sinkhandle);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_info);
-  g_free (content);
-  g_free (orange_png_file);
-  g_free (pipeline);
+  g_free (count);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief A tensor-sink callback accessing the second tensor first, then cloning the data.
  */
-TEST (nnstreamer_capi_switch, dummy_01)
+static void
+test_sink_callback_second (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_switch_e type;
-  ml_pipeline_state_e state;
-  gchar *pipeline;
-  int status;
-  guint *count_sink;
-  TestPipeState *pipe_state;
-  gchar **node_list = NULL;
-
-  pipeline = g_strdup (
-      "input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
-
-  count_sink = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
-
-  pipe_state = (TestPipeState *) g_new0 (TestPipeState, 1);
-  ASSERT_TRUE (pipe_state != NULL);
+  guint *count = (guint *) user_data;
+  ml_tensors_data_h cloned;
+  void *raw;
+  size_t size;
 
-  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (ml_tensors_data_get_tensor_data (data, 1, &raw, &size) != ML_ERROR_NONE
+      || raw == NULL || size != 3U * 32U * 32U)
+    return;
 
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
+  if (ml_tensors_data_clone (data, &cloned) != ML_ERROR_NONE)
+    return;
 
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (ml_tensors_data_get_tensor_data (cloned, 0, &raw, &size) == ML_ERROR_NONE
+      && raw != NULL && size == 3U * 16U * 16U) {
+    G_LOCK (callback_lock);
+    *count = *count + 1;
+    G_UNLOCK (callback_lock);
+  }
 
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
+  ml_tensors_data_destroy (cloned);
+}
 
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
-      idx++;
-      g_free (name);
-    }
+/**
+ * @brief Test NNStreamer pipeline sink, the tensors are accessed partially in the callback.
+ */
+TEST (nnstreamer_capi_sink, partial_access_01_p)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  guint *count;
+  int status;
+  const char *pipeline = "tensor_mux name=mux ! tensor_sink name=sinkx sync=false "
+      "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! tensor_converter ! mux.sink_0 "
+      "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=32,height=32 ! tensor_converter ! mux.sink_1";
 
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
+  count = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count != NULL);
 
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_pipeline_switch_select (switchhandle, "sink_1");
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_second, count, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (50000);
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
-
-  wait_pipeline_process_buffers (*count_sink, 3);
-  g_usleep (300000); /* To check if more frames are coming in  */
-  EXPECT_EQ (*count_sink, 3U);
+  wait_pipeline_process_buffers (*count, 3);
+  EXPECT_EQ (*count, 3U);
 
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -1656,2399 +2159,5268 @@ TEST (nnstreamer_capi_switch, dummy_01)
   status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (pipe_state->paused);
-  EXPECT_TRUE (pipe_state->playing);
-
-  g_free (pipeline);
-  g_free (count_sink);
-  g_free (pipe_state);
+  g_free (count);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief A tensor-sink callback pre-processing the data not accessed yet.
  */
-TEST (nnstreamer_capi_switch, dummy_02)
+static void
+test_sink_callback_preprocess (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
-  guint *count_sink0, *count_sink1;
-  gchar **node_list = NULL;
-
-  /**
-   * Prerolling problem
-   * For running the test, set async=false in the sink element when using an output selector.
-   * The pipeline state can be changed to paused after all sink element receive buffer.
-   */
-  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
-                       "outs.src_0 ! tensor_sink name=sink0 async=false "
-                       "outs.src_1 ! tensor_sink name=sink1 async=false");
-
-  count_sink0 = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink0 != NULL);
-  *count_sink0 = 0;
+  guint *count = (guint *) user_data;
+  ml_tensors_info_h out_info;
+  ml_tensors_data_h out;
+  ml_tensor_dimension dim = { 3, 16, 16, 1 };
+  uint8_t *raw;
+  float *converted;
+  size_t size, i;
+  gboolean matched = FALSE;
 
-  count_sink1 = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink1 != NULL);
-  *count_sink1 = 0;
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* The buffer of sink data is mapped when pre-processing it. */
+  if (ml_tensors_data_preprocess (data, out_info, NULL, &out) == ML_ERROR_NONE) {
+    if (ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size) == ML_ERROR_NONE
+        && ml_tensors_data_get_tensor_data (out, 0, (void **) &converted, &size) == ML_ERROR_NONE
+        && size == 3U * 16U * 16U * sizeof (float)) {
+      matched = TRUE;
+      for (i = 0; i < 3U * 16U * 16U; i++) {
+        if (converted[i] != (float) raw[i]) {
+          matched = FALSE;
+          break;
+        }
+      }
+    }
 
-  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
+    ml_tensors_data_destroy (out);
+  }
 
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (out_info);
 
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
+  if (matched) {
+    G_LOCK (callback_lock);
+    *count = *count + 1;
+    G_UNLOCK (callback_lock);
+  }
+}
 
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
-      idx++;
-      g_free (name);
-    }
+/**
+ * @brief Test NNStreamer pipeline sink, the data is pre-processed in the callback without accessing the tensors.
+ */
+TEST (nnstreamer_capi_sink, partial_access_02_p)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  guint *count;
+  int status;
+  const char *pipeline = "videotestsrc num-buffers=3 ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false";
 
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
+  count = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count != NULL);
 
-  status = ml_pipeline_sink_register (
-      handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle0 != NULL);
 
   status = ml_pipeline_sink_register (
-      handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle1 != NULL);
-
-  status = ml_pipeline_switch_select (switchhandle, "src_1");
+      handle, "sinkx", test_sink_callback_preprocess, count, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (200000); /* 200ms. Let a few frames flow. */
+  wait_pipeline_process_buffers (*count, 3);
+  EXPECT_EQ (*count, 3U);
 
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_sink_unregister (sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_unregister (sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_EQ (*count_sink0, 0U);
-  EXPECT_TRUE (*count_sink1 > 0U);
+  g_free (count);
+}
 
-  g_free (pipeline);
-  g_free (count_sink0);
-  g_free (count_sink1);
+/**
+ * @brief Test NNStreamer pipeline src
+ */
+TEST (nnstreamer_capi_src, dummy_01)
+{
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path (G_DIR_SEPARATOR_S, _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *) fullpath);
+  gchar *file1 = g_build_path (G_DIR_SEPARATOR_S, dir, "output", NULL);
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
+      file1);
+  ml_pipeline_h handle;
+  ml_pipeline_state_e state;
+  ml_pipeline_src_h srchandle;
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data1, data2;
+  unsigned int count = 0;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensor_dimension dim = {
+    0,
+  };
+
+  int i;
+  uint8_t *uintarray1[10];
+  uint8_t *uintarray2[10];
+  uint8_t *content = NULL;
+  gsize len;
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (dir != NULL);
+  for (i = 0; i < 10; i++) {
+    uintarray1[i] = (uint8_t *) g_malloc (4);
+    ASSERT_TRUE (uintarray1[i] != NULL);
+    uintarray1[i][0] = i + 4;
+    uintarray1[i][1] = i + 1;
+    uintarray1[i][2] = i + 3;
+    uintarray1[i][3] = i + 2;
+
+    uintarray2[i] = (uint8_t *) g_malloc (4);
+    ASSERT_TRUE (uintarray2[i] != NULL);
+    uintarray2[i][0] = i + 3;
+    uintarray2[i][1] = i + 2;
+    uintarray2[i][2] = i + 1;
+    uintarray2[i][3] = i + 4;
+    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
+    /** @todo Check whether gstreamer really deallocates this */
+  }
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (10000); /* 10ms. Wait a bit. */
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
+  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
+  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
+
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
+
+  status = ml_tensors_data_create (info, &data1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+
+  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
+
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
+
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
+
+  for (i = 0; i < 10; i++) {
+    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_create (info, &data2);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_usleep (50000); /* Wait for the pipeline to flush all */
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+
+  EXPECT_TRUE (g_file_get_contents (file1, (gchar **) &content, &len, NULL));
+  EXPECT_EQ (len, 8U * 11);
+  EXPECT_TRUE (content != nullptr);
+
+  if (content && len == 88U) {
+    for (i = 0; i < 10; i++) {
+      EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
+      EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
+      EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
+      EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
+      EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
+      EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
+      EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
+      EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
+    }
+  }
+
+  g_free (content);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data1);
+
+  for (i = 0; i < 10; i++) {
+    g_free (uintarray1[i]);
+    g_free (uintarray2[i]);
+  }
+
+  g_free (fullpath);
+  g_free (file1);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when pipeline is NULL.
  */
-TEST (nnstreamer_capi_switch, failure_01_n)
+TEST (nnstreamer_capi_src, failure_01_n)
 {
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
   int status;
+  ml_pipeline_src_h srchandle;
 
-  /* invalid param : pipe */
-  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
+  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_switch, failure_02_n)
+TEST (nnstreamer_capi_src, failure_02_n)
 {
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
-
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  ml_pipeline_src_h srchandle;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* invalid param : name */
-  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
+  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_switch, failure_03_n)
+TEST (nnstreamer_capi_src, failure_03_n)
 {
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
-
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  ml_pipeline_src_h srchandle;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* invalid param : wrong name */
-  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_switch, failure_04_n)
+TEST (nnstreamer_capi_src, failure_04_n)
 {
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
-
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  ml_pipeline_src_h srchandle;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* invalid param : invalid type */
-  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_switch, failure_05_n)
+TEST (nnstreamer_capi_src, failure_05_n)
 {
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
-
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* invalid param : handle */
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
+  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
  */
-TEST (nnstreamer_capi_switch, failure_06_n)
+TEST (nnstreamer_capi_src, failure_06_n)
 {
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
-  int status;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* successfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : handle */
-  status = ml_pipeline_switch_select (NULL, "invalidpadname");
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* null data */
+  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src, push multiple frames at once.
  */
-TEST (nnstreamer_capi_switch, failure_07_n)
+TEST (nnstreamer_capi_src, input_batch_01_p)
 {
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
-  int status;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_data_h data[5];
+  ml_tensors_info_h info;
+  guint *count_sink;
+  int status, i;
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* successfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : pad name */
-  status = ml_pipeline_switch_select (switchhandle, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
+  for (i = 0; i < 5; i++) {
+    status = ml_tensors_data_create (info, &data[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
 
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_08_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
-  int status;
+  /* The data handles are released after pushing them. */
+  status = ml_pipeline_src_input_data_batch (
+      srchandle, data, 5, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  for (i = 0; i < 5; i++)
+    EXPECT_TRUE (data[i] == NULL);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_pipeline_process_buffers (*count_sink, 5);
+  EXPECT_EQ (*count_sink, 5U);
 
-  /* successfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong pad name */
-  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
+ * @brief Test NNStreamer pipeline src, push multiple frames with invalid param.
  */
-TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_01_n)
+TEST (nnstreamer_capi_src, input_batch_02_n)
 {
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data[2];
+  ml_tensors_info_h info, invalid_info;
+  ml_tensor_dimension dim = { 8, 1, 1, 1 };
   int status;
 
-  status = _ml_check_plugin_availability (NULL, "tensor_filter");
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_src_input_data_batch (
+      NULL, data, 2, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-/**
- * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
- */
-TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_02_n)
-{
-  int status;
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = _ml_check_plugin_availability ("nnstreamer", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer Utility for checking nnfw availability with custom option
- */
-TEST (nnstreamer_capi_util, nnfw_availability_full_01)
-{
-  int status;
-  bool result;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability_full (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking nnfw availability with custom option (invalid param)
- */
-TEST (nnstreamer_capi_util, nnfw_availability_full_02_n)
-{
-  int status;
+  ml_tensors_info_create (&invalid_info);
+  ml_tensors_info_set_count (invalid_info, 1);
+  ml_tensors_info_set_tensor_type (invalid_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (invalid_info, 0, dim);
 
-  status = ml_check_nnfw_availability_full (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  ml_tensors_data_create (info, &data[0]);
+  ml_tensors_data_create (invalid_info, &data[1]);
 
-/**
- * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
- */
-TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_01_n)
-{
-  int status;
+  status = ml_pipeline_src_input_data_batch (
+      srchandle, NULL, 2, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_src_input_data_batch (
+      srchandle, data, 0, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-/**
- * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
- */
-TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_02_n)
-{
-  bool result;
-  int status;
+  /* The second frame has invalid size, no frame is consumed. */
+  status = ml_pipeline_src_input_data_batch (
+      srchandle, data, 2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (data[0] != NULL);
+  EXPECT_TRUE (data[1] != NULL);
 
-  /* any is unknown nnfw type */
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY, &result);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* The same handle is given twice, no frame is consumed. */
+  ml_tensors_data_destroy (data[1]);
+  data[1] = data[0];
+
+  status = ml_pipeline_src_input_data_batch (
+      srchandle, data, 2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (data[0] != NULL);
+
+  ml_tensors_data_create (invalid_info, &data[1]);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data[0]);
+  ml_tensors_data_destroy (data[1]);
+  ml_tensors_info_destroy (info);
+  ml_tensors_info_destroy (invalid_info);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ * @brief Test NNStreamer pipeline src, push the frames acquired from the buffer pool.
  */
-TEST (nnstreamer_capi_util, availability_01)
+TEST (nnstreamer_capi_src, acquire_data_01_p)
 {
-  bool result;
-  int status;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  const uint8_t raw[4] = { 1, 2, 3, 4 };
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_data_h data;
+  guint *count_sink;
+  void *ptr, *raw_out;
+  size_t size;
+  int status, i;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, &result);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_SIMD, &result);
+  for (i = 0; i < 5; i++) {
+    status = ml_pipeline_src_acquire_data (srchandle, NULL, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_get_tensor_data (data, 0, &ptr, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (size, 4U);
+
+    /* The input is written directly into the pooled memory. */
+    status = ml_tensors_data_set_tensor_data (data, 0, raw, size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_get_tensor_data (data, 0, &raw_out, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (ptr, raw_out);
+
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* The frame not pushed is returned to the pool. */
+  status = ml_pipeline_src_acquire_data (srchandle, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_destroy (data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_GPU, &result);
+  wait_pipeline_process_buffers (*count_sink, 5);
+  EXPECT_EQ (*count_sink, 5U);
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
-}
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (count_sink);
+}
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ * @brief Test NNStreamer pipeline src, acquire the frame with invalid param.
  */
-TEST (nnstreamer_capi_util, availability_fail_01_n)
+TEST (nnstreamer_capi_src, acquire_data_02_n)
 {
-  bool result;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h invalid_info;
+  ml_tensor_dimension dim = { 8, 1, 1, 1 };
   int status;
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_MOVIDIUS, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  status = ml_pipeline_src_acquire_data (NULL, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_EDGE_TPU, &result);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_VIVANTE, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SR, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SLSI, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
+  status = ml_pipeline_src_acquire_data (srchandle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-#ifdef ENABLE_TENSORFLOW
-/**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
- */
-TEST (nnstreamer_capi_util, availability_02)
-{
-  bool result;
-  int status;
+  /* The information mismatches the caps of src. */
+  ml_tensors_info_create (&invalid_info);
+  ml_tensors_info_set_count (invalid_info, 1);
+  ml_tensors_info_set_tensor_type (invalid_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (invalid_info, 0, dim);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY, &result);
+  status = ml_pipeline_src_acquire_data (srchandle, invalid_info, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+
+  ml_tensors_info_destroy (invalid_info);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ * @brief Test NNStreamer pipeline src, push the frames with the flow control.
  */
-TEST (nnstreamer_capi_util, availability_fail_02_n)
+TEST (nnstreamer_capi_src, flow_control_01_p)
 {
-  bool result;
-  int status;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
+  ml_option_h option;
+  guint *count_sink;
+  int status, i;
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_NPU_VIVANTE, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = ml_check_nnfw_availability (
-      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /* ENABLE_TENSORFLOW */
 
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_03)
-{
-  bool result;
-  int status;
+  /* The slow callback fills the queue of appsrc. */
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_slow, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_fail_03_n)
-{
-  bool result;
-  int status;
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "max_bytes", g_strdup ("8"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "timeout", g_strdup ("1000"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_set_flow_control (srchandle, option);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  ml_option_destroy (option);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
 
-#ifdef ENABLE_NNFW_RUNTIME
-/**
- * @brief Test NNStreamer Utility for checking availability of NNFW
- */
-TEST (nnstreamer_capi_util, availability_04)
-{
-  bool result;
-  int status;
+  /* Each push waits for the room of appsrc, no frame is dropped. */
+  for (i = 0; i < 10; i++) {
+    status = ml_pipeline_src_wait_ready (srchandle, 1000);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  wait_pipeline_process_buffers (*count_sink, 10);
+  EXPECT_EQ (*count_sink, 10U);
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of NNFW
+ * @brief A flag to hold the sink callback, to fill the queue of appsrc.
  */
-TEST (nnstreamer_capi_util, availability_fail_04_n)
+static gint flow_control_hold = 0;
+
+/**
+ * @brief A tensor-sink callback waiting until the flag is cleared.
+ */
+static void
+test_sink_callback_hold (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  bool result;
-  int status;
+  while (g_atomic_int_get (&flow_control_hold))
+    g_usleep (10000); /* 10ms */
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_SR, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  test_sink_callback_count (data, info, user_data);
+}
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+/**
+ * @brief A thread waiting for the room of appsrc.
+ */
+static gpointer
+test_src_wait_ready_thread (gpointer data)
+{
+  ml_pipeline_src_h srchandle = (ml_pipeline_src_h) data;
+
+  return GINT_TO_POINTER (ml_pipeline_src_wait_ready (srchandle, 5000));
 }
-#endif /* ENABLE_NNFW_RUNTIME */
 
-#ifdef ENABLE_MOVIDIUS_NCSDK2
 /**
- * @brief Test NNStreamer Utility for checking availability of NCSDK2
+ * @brief Test NNStreamer pipeline src, the pipeline is not locked while waiting for the room of appsrc.
  */
-TEST (nnstreamer_capi_util, availability_05)
+TEST (nnstreamer_capi_src, flow_control_03_p)
 {
-  bool result;
-  int status;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_state_e state;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
+  ml_option_h option;
+  GThread *thread;
+  gint64 start;
+  guint *count_sink;
+  int status, i;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_ANY, &result);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_AUTO, &result);
+  g_atomic_int_set (&flow_control_hold, 1);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_hold, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of NCSDK2
- */
-TEST (nnstreamer_capi_util, availability_fail_05_n)
-{
-  bool result;
-  int status;
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "max_bytes", g_strdup ("4"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_set_flow_control (srchandle, option);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  ml_option_destroy (option);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /* ENABLE_MOVIDIUS_NCSDK2 */
 
-#ifdef ENABLE_ARMNN
-/**
- * @brief Test NNStreamer Utility for checking availability of ARMNN
- */
-TEST (nnstreamer_capi_util, availability_06)
-{
-  bool result;
-  int status;
+  /* The sink callback holds a frame, and appsrc queues the others. */
+  for (i = 0; i < 3; i++) {
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY, &result);
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  g_usleep (100000); /* 100ms */
+  status = ml_pipeline_src_wait_ready (srchandle, 10);
+  EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
+
+  thread = g_thread_new ("wait-ready", test_src_wait_ready_thread, srchandle);
+  g_usleep (100000); /* 100ms. The thread is waiting. */
+
+  /* Other functions of the pipeline do not wait for the timeout. */
+  start = g_get_monotonic_time ();
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  EXPECT_LT (g_get_monotonic_time () - start, 1000 * G_TIME_SPAN_MILLISECOND);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_AUTO, &result);
+  g_atomic_int_set (&flow_control_hold, 0);
+  status = GPOINTER_TO_INT (g_thread_join (thread));
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU, &result);
+  wait_pipeline_process_buffers (*count_sink, 3);
+  EXPECT_EQ (*count_sink, 3U);
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of ARMNN
+ * @brief Test NNStreamer pipeline src, set the flow control with invalid param.
  */
-TEST (nnstreamer_capi_util, availability_fail_06_n)
+TEST (nnstreamer_capi_src, flow_control_02_n)
 {
-  bool result;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_option_h option;
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU, &result);
+  status = ml_option_create (&option);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU_EDGE_TPU, &result);
+  status = ml_pipeline_src_set_flow_control (NULL, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_src_wait_ready (NULL, 10);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /* ENABLE_ARMNN */
 
-/**
- * @brief Test NNStreamer Utility for checking an element availability
- */
-TEST (nnstreamer_capi_util, element_available_01_p)
-{
-  bool available;
-  int status, n_elems, i;
-  /**
-   * If the allowed element list of nnstreamer is changed, this should also be changed.
-   * https://github.com/nnstreamer/nnstreamer/blob/main/packaging/nnstreamer.spec#L642 (# Element allowance in Tizen)
-   */
-  const gchar *allowed = "tensor_converter tensor_filter tensor_query_serversrc capsfilter input-selector output-selector queue tee valve appsink appsrc audioconvert audiorate audioresample audiomixer videoconvert videocrop videorate videoscale videoflip videomixer compositor fakesrc fakesink filesrc filesink audiotestsrc videotestsrc jpegparse jpegenc jpegdec pngenc pngdec tcpclientsink tcpclientsrc tcpserversink tcpserversrc xvimagesink ximagesink evasimagesink evaspixmapsink glimagesink theoraenc lame vorbisenc wavenc volume oggmux avimux matroskamux v4l2src avsysvideosrc camerasrc tvcamerasrc pulsesrc fimcconvert tizenwlsink gdppay gdpdepay join rtpdec rtspsrc rtspclientsink zmqsrc zmqsink mqttsrc mqttsink udpsrc udpsink multiudpsink audioamplify audiochebband audiocheblimit audiodynamic audioecho audiofirfilter audioiirfilter audioinvert audiokaraoke audiopanorama audiowsincband audiowsinclimit scaletempo stereo";
-  /* This not_allowed list is written only for testing. */
-  const gchar *not_allowed
-      = "videobox videobalance aasink adder alpha alsasink x264enc ximagesrc webpenc wavescope v4l2sink v4l2radio urisourcebin uridecodebin typefind timeoverlay rtpstreampay rtpsession rtpgstpay queue2 fdsink fdsrc chromium capssetter cairooverlay autovideosink";
-  gchar **elements;
-  gboolean restricted;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  restricted = nnsconf_get_custom_value_bool (
-      "element-restriction", "enable_element_restriction", FALSE);
+  /* The flow control is not set. */
+  status = ml_pipeline_src_wait_ready (srchandle, 10);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* element restriction is disabled */
-  if (!restricted)
-    return;
+  status = ml_pipeline_src_set_flow_control (srchandle, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  elements = g_strsplit (allowed, " ", -1);
-  n_elems = g_strv_length (elements);
+  status = ml_option_set (option, "max_bytes", g_strdup ("-1"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_set_flow_control (srchandle, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  for (i = 0; i < n_elems; i++) {
-    /* If the plugin is not installed, the availability of the element cannot be tested. */
-    GstElementFactory *factory = gst_element_factory_find (elements[i]);
+  status = ml_option_set (option, "max_bytes", g_strdup ("16"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_option_set (option, "timeout", g_strdup ("invalid"), g_free);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_set_flow_control (srchandle, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-    if (factory) {
-      status = ml_check_element_availability (elements[i], &available);
-      EXPECT_EQ (status, ML_ERROR_NONE);
-      EXPECT_EQ (available, true);
-      gst_object_unref (factory);
-    }
-  }
-  g_strfreev (elements);
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  elements = g_strsplit (not_allowed, " ", -1);
-  n_elems = g_strv_length (elements);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i = 0; i < n_elems; i++) {
-    GstElementFactory *factory = gst_element_factory_find (elements[i]);
-    if (factory) {
-      status = ml_check_element_availability (elements[i], &available);
-      EXPECT_EQ (status, ML_ERROR_NONE);
-      EXPECT_EQ (available, false);
-      gst_object_unref (factory);
-    }
-  }
-  g_strfreev (elements);
+  ml_option_destroy (option);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking an element availability (null param)
+ * @brief Internal function to push dummy into appsrc.
  */
-TEST (nnstreamer_capi_util, element_available_02_n)
+static void
+test_src_cb_push_dummy (ml_pipeline_src_h src_handle)
 {
-  bool available;
-  int status;
-
-  status = ml_check_element_availability (nullptr, &available);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
 
-  status = ml_check_element_availability ("tensor_filter", nullptr);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  if (ml_pipeline_src_get_tensors_info (src_handle, &info) == ML_ERROR_NONE) {
+    ml_tensors_data_create (info, &data);
+    ml_pipeline_src_input_data (src_handle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    ml_tensors_info_destroy (info);
+  }
 }
 
 /**
- * @brief Test NNStreamer Utility for checking an element availability (invalid element name)
+ * @brief appsrc callback - need_data.
  */
-TEST (nnstreamer_capi_util, element_available_03_n)
+static void
+test_src_cb_need_data (ml_pipeline_src_h src_handle, unsigned int length, void *user_data)
 {
-  bool available;
-  int status;
-
-  status = ml_check_element_availability ("invalid-elem", &available);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (available, false);
+  /* For test, push dummy if given src handles are same. */
+  if (src_handle == user_data)
+    test_src_cb_push_dummy (src_handle);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking tensors info handle
+ * @brief Test NNStreamer pipeline src callback.
  */
-TEST (nnstreamer_capi_util, tensors_info)
+TEST (nnstreamer_capi_src, callback_replace)
 {
-  ml_tensors_info_h info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e out_type;
-  gchar *out_name;
-  size_t data_size;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle1, srchandle2;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_src_callbacks_s callback = {
+    0,
+  };
+  guint *count_sink;
   int status;
 
-  status = ml_tensors_info_create (&info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  callback.need_data = test_src_cb_need_data;
 
-  in_dim[0] = 3;
-  in_dim[1] = 300;
-  in_dim[2] = 300;
-  in_dim[3] = 1;
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  /* add tensor info */
-  status = ml_tensors_info_set_count (info, 2);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
+  status = ml_pipeline_src_set_event_cb (srchandle1, &callback, srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  test_src_cb_push_dummy (srchandle1);
+  g_usleep (100000);
 
-  /* get tensor info */
-  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
+  EXPECT_TRUE (*count_sink > 1U);
 
-  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  /* Set new callback with new handle. */
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle2);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name == NULL);
 
-  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  /* New callback will not push dummy. */
+  status = ml_pipeline_src_set_event_cb (srchandle2, &callback, srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
 
-  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
-  g_free (out_name);
+  g_usleep (100000);
+  *count_sink = 0;
+  test_src_cb_push_dummy (srchandle2);
+  g_usleep (100000);
 
-  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (*count_sink == 1U);
+  g_free (count_sink);
+}
 
-  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+/**
+ * @brief Test NNStreamer pipeline src callback.
+ */
+TEST (nnstreamer_capi_src, callback_invalid_param_01_n)
+{
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_src_callbacks_s callback = {
+    0,
+  };
+  int status;
 
-  /* get tensor size */
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300));
+  callback.need_data = test_src_cb_need_data;
 
-  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
 
-  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
 
-  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
+  /* invalid param */
+  status = ml_pipeline_src_set_event_cb (NULL, &callback, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking extended tensors info handle
+ * @brief Test NNStreamer pipeline src callback.
  */
-TEST (nnstreamer_capi_util, tensors_info_extended)
+TEST (nnstreamer_capi_src, callback_invalid_param_02_n)
 {
-  ml_tensors_info_h info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e out_type;
-  gchar *out_name;
-  size_t data_size;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
   int status;
-  guint i;
 
-  status = ml_tensors_info_create_extended (&info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    in_dim[i] = i % 4 + 1;
-  }
-
-  /* add tensor info */
-  status = ml_tensors_info_set_count (info, 2);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid param */
+  status = ml_pipeline_src_set_event_cb (srchandle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+}
 
-  /* get tensor info */
-  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
+/**
+ * @brief Check decoded orange.png with raw data.
+ */
+static void
+check_orange_output (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
+{
+  int status;
+  size_t data_size;
+  uint8_t *raw_content;
+  gsize raw_content_len;
+  gchar *orange_raw_file;
 
-  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    EXPECT_EQ (out_dim[i], i % 4 + 1);
-  }
+  orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_test (orange_raw_file, G_FILE_TEST_EXISTS));
 
-  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name == NULL);
+  EXPECT_TRUE (g_file_get_contents (
+      orange_raw_file, (gchar **) &raw_content, &raw_content_len, NULL));
 
-  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  status = ml_tensors_data_get_tensor_data (data, 0, (void **) &data, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (raw_content_len, data_size);
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    EXPECT_EQ (out_dim[i], i % 4 + 1);
+  status = 0;
+  for (size_t i = 0; i < data_size; ++i) {
+    if (*(((uint8_t *) data) + i) != *(raw_content + i)) {
+      status = 1;
+      break;
+    }
   }
 
-  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
-  g_free (out_name);
-
-  /* get tensor size */
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4));
-
-  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == ((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * 8));
-
-  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size
-               == (((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4))
-                   + ((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * 8)));
+  EXPECT_EQ (status, 0);
 
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_content);
+  g_free (orange_raw_file);
 }
 
 /**
- * @brief Test utility functions
+ * @brief Test NNStreamer pipeline src (appsrc with png file)
  */
-TEST (nnstreamer_capi_util, compare_info)
+TEST (nnstreamer_capi_src, pngfile)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim;
-  int status;
+  int status, i;
 
-  status = ml_tensors_info_create (&info1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_state_e state;
 
-  status = ml_tensors_info_create (&info2);
+  ml_tensors_info_h in_info;
+  ml_tensor_dimension in_dim;
+  ml_tensors_data_h input = NULL;
+
+  gchar *orange_png_file, *pipeline;
+  uint8_t *content;
+  gsize content_len;
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* start pipeline test with valid model file */
+  orange_png_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.png", NULL);
+  ASSERT_TRUE (g_file_test (orange_png_file, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf (
+      "appsrc name=srcx caps=image/png ! pngdec ! videoconvert ! videoscale ! video/x-raw,format=RGB,width=224,height=224,framerate=0/1 ! tensor_converter ! tensor_sink name=sinkx sync=false async=false");
+
+  /* construct pipeline */
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  dim[0] = 3;
-  dim[1] = 4;
-  dim[2] = 4;
-  dim[3] = 1;
+  /* set sink callback */
+  status = ml_pipeline_sink_register (handle, "sinkx", check_orange_output, NULL, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  /* set src_handle */
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  /* get the data of input png file */
+  EXPECT_TRUE (g_file_get_contents (orange_png_file, (gchar **) &content, &content_len, NULL));
 
-  /* compare info */
-  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+  /* set ml_tensors_info */
+  ml_tensors_info_create (&in_info);
+  in_dim[0] = content_len;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  for (i = 4; i < ML_TENSOR_RANK_LIMIT; i++)
+    in_dim[i] = 0;
 
-  /* change type */
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
-  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  /* validate info */
-  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test utility functions
- */
-TEST (nnstreamer_capi_util, compare_info_extended)
-{
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim;
-  int status, i;
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-  status = ml_tensors_info_create_extended (&info1);
+  status = ml_tensors_data_set_tensor_data (input, 0, content, content_len);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create_extended (&info2);
+  status = ml_pipeline_src_input_data (srchandle, input, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    dim[i] = i + 1;
-  }
-
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  g_usleep (1000 * 1000);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* compare info */
-  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+  g_usleep (1000 * 1000);
 
-  /* change type */
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
-  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PAUSED);
 
-  /* validate info */
-  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+  /* release handles and allocated memory */
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (content);
+  g_free (orange_png_file);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, compare_info_extended_n)
+TEST (nnstreamer_capi_switch, dummy_01)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim;
-  int status, i;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_switch_e type;
+  ml_pipeline_state_e state;
+  gchar *pipeline;
+  int status;
+  guint *count_sink;
+  TestPipeState *pipe_state;
+  gchar **node_list = NULL;
 
-  status = ml_tensors_info_create_extended (&info1);
+  pipeline = g_strdup (
+      "input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
+
+  count_sink = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
+
+  pipe_state = (TestPipeState *) g_new0 (TestPipeState, 1);
+  ASSERT_TRUE (pipe_state != NULL);
+
+  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info2);
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    dim[i] = i + 1;
-  }
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
+      idx++;
+      g_free (name);
+    }
 
-  /* compare info */
-  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
-}
-
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_create_1_n)
-{
-  int status = ml_tensors_info_create (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_create_2_n)
-{
-  ml_tensors_info_h i;
-  int status = _ml_tensors_info_create_from_gst (&i, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_create_3_n)
-{
-  GstTensorsInfo gi;
-  int status = _ml_tensors_info_create_from_gst (nullptr, &gi);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_switch_select (switchhandle, "sink_1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_create_4_n)
-{
-  int status = ml_tensors_info_create_extended (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_destroy_n)
-{
-  int status = ml_tensors_info_destroy (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  g_usleep (50000);
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_init_n)
-{
-  int status = _ml_tensors_info_initialize (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  wait_pipeline_process_buffers (*count_sink, 3);
+  g_usleep (300000); /* To check if more frames are coming in  */
+  EXPECT_EQ (*count_sink, 3U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_valid_01_n)
-{
-  bool valid;
-  int status = ml_tensors_info_validate (nullptr, &valid);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_valid_02_n)
-{
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-  int status;
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_validate (info, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (pipe_state->paused);
+  EXPECT_TRUE (pipe_state->playing);
 
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (pipe_state);
 }
 
 /**
- * @brief Test utility functions (internal)
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, info_comp_01_n)
+TEST (nnstreamer_capi_switch, dummy_02)
 {
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-  bool equal;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
+  guint *count_sink0, *count_sink1;
+  gchar **node_list = NULL;
 
-  status = ml_tensors_info_create (&info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /**
+   * Prerolling problem
+   * For running the test, set async=false in the sink element when using an output selector.
+   * The pipeline state can be changed to paused after all sink element receive buffer.
+   */
+  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
+                       "outs.src_0 ! tensor_sink name=sink0 async=false "
+                       "outs.src_1 ! tensor_sink name=sink1 async=false");
 
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  count_sink0 = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink0 != NULL);
+  *count_sink0 = 0;
 
-  status = _ml_tensors_info_compare (nullptr, info, &equal);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  count_sink1 = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink1 != NULL);
+  *count_sink1 = 0;
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
-
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_comp_02_n)
-{
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
 
-  bool equal;
-  int status;
+  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
 
-  status = ml_tensors_info_create (&info);
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
 
-  status = _ml_tensors_info_compare (info, nullptr, &equal);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
+      idx++;
+      g_free (name);
+    }
 
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-}
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_comp_03_n)
-{
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-  int status;
+  status = ml_pipeline_sink_register (
+      handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle0 != NULL);
 
-  status = ml_tensors_info_create (&info1);
+  status = ml_pipeline_sink_register (
+      handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle1 != NULL);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  status = ml_pipeline_switch_select (switchhandle, "src_1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info2);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  g_usleep (200000); /* 200ms. Let a few frames flow. */
 
-  status = _ml_tensors_info_compare (info1, info2, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_sink_unregister (sinkhandle0);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  status = ml_pipeline_sink_unregister (sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_comp_0)
-{
-  bool equal;
-  ml_tensors_info_h info1, info2;
-  int status = ml_tensors_info_create (&info1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create (&info2);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_count (info1, 1U);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info2, 2U);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = _ml_tensors_info_compare (info1, info2, &equal);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  ASSERT_FALSE (equal);
+  EXPECT_EQ (*count_sink0, 0U);
+  EXPECT_TRUE (*count_sink1 > 0U);
 
-  status = ml_tensors_info_destroy (info1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info2);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink0);
+  g_free (count_sink1);
 }
 
 /**
- * @brief Test utility functions (internal)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_comp_1)
+TEST (nnstreamer_capi_switch, failure_01_n)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim = { 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 };
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
   int status;
-  bool equal;
 
-  status = ml_tensors_info_create (&info1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid param : pipe */
+  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+/**
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
+ */
+TEST (nnstreamer_capi_switch, failure_02_n)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
+  int status;
 
-  status = ml_tensors_info_create_extended (&info2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = _ml_tensors_info_compare (info1, info2, &equal);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  ASSERT_FALSE (equal);
+  /* invalid param : name */
+  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_set_count_n)
+TEST (nnstreamer_capi_switch, failure_03_n)
 {
-  int status = ml_tensors_info_set_count (nullptr, 1);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
+  int status;
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_count_1_n)
-{
-  ml_tensors_info_h info;
-  int status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT + 1);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* invalid param : wrong name */
+  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_count_1_n)
-{
-  unsigned int count;
-  int status = ml_tensors_info_get_count (nullptr, &count);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_get_count_2_n)
+TEST (nnstreamer_capi_switch, failure_04_n)
 {
-  ml_tensors_info_h info;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_get_count (info, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  /* invalid param : invalid type */
+  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_tname_0_n)
-{
-  int status = ml_tensors_info_set_tensor_name (nullptr, 0, "fail");
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_set_tname_1_n)
+TEST (nnstreamer_capi_switch, failure_05_n)
 {
-  ml_tensors_info_h info;
-  int status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 3);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_pipeline_h handle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
+  int status;
 
-  status = ml_tensors_info_set_tensor_name (info, 3, "fail");
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_tname_1)
-{
-  ml_tensors_info_h info;
-  int status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  /* invalid param : handle */
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_set_tensor_name (info, 0, "first");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 0, "second");
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_get_tname_01_n)
+TEST (nnstreamer_capi_switch, failure_06_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
-  char *name = NULL;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_get_tensor_name (nullptr, 0, &name);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* successfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : handle */
+  status = ml_pipeline_switch_select (NULL, "invalidpadname");
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_get_tname_02_n)
+TEST (nnstreamer_capi_switch, failure_07_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_get_tensor_name (info, 0, nullptr);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* successfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : pad name */
+  status = ml_pipeline_switch_select (switchhandle, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, info_get_tname_03_n)
+TEST (nnstreamer_capi_switch, failure_08_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
-  char *name = NULL;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_get_tensor_name (info, 2, &name);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* successfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : wrong pad name */
+  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_ttype_01_n)
-{
-  int status;
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (nullptr, 0, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
  */
-TEST (nnstreamer_capi_util, info_set_ttype_02_n)
+TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_01_n)
 {
   int status;
-  ml_tensors_info_h info;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UNKNOWN);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = _ml_check_plugin_availability (NULL, "tensor_filter");
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
  */
-TEST (nnstreamer_capi_util, info_set_ttype_03_n)
+TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_02_n)
 {
   int status;
-  ml_tensors_info_h info;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = _ml_check_plugin_availability ("nnstreamer", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking nnfw availability with custom option
  */
-TEST (nnstreamer_capi_util, info_get_ttype_01_n)
+TEST (nnstreamer_capi_util, nnfw_availability_full_01)
 {
   int status;
-  ml_tensor_type_e type;
+  bool result;
 
-  status = ml_tensors_info_get_tensor_type (nullptr, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_nnfw_availability_full (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking nnfw availability with custom option (invalid param)
  */
-TEST (nnstreamer_capi_util, info_get_ttype_02_n)
+TEST (nnstreamer_capi_util, nnfw_availability_full_02_n)
 {
   int status;
-  ml_tensors_info_h info;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_get_tensor_type (info, 0, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability_full (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
  */
-TEST (nnstreamer_capi_util, info_get_ttype_03_n)
+TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_01_n)
 {
   int status;
-  ml_tensors_info_h info;
-  ml_tensor_type_e type;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_type (info, 2, &type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
  */
-TEST (nnstreamer_capi_util, info_set_tdimension_01_n)
+TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_02_n)
 {
+  bool result;
   int status;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
 
-  status = ml_tensors_info_set_tensor_dimension (nullptr, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* any is unknown nnfw type */
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY, &result);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
  */
-TEST (nnstreamer_capi_util, info_set_tdimension_02_n)
+TEST (nnstreamer_capi_util, availability_01)
 {
+  bool result;
   int status;
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 1, 2, 3, 4 };
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_tensors_info_set_tensor_dimension (info, 2, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_NEON, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_SIMD, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
  */
-TEST (nnstreamer_capi_util, info_set_tdimension_03_n)
+TEST (nnstreamer_capi_util, availability_fail_01_n)
 {
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0 };
+  bool result;
   int status;
 
-  /* max rank 4 (ML_TENSOR_RANK_LIMIT_PREV) */
-  ml_tensors_info_create (&info);
-  ml_tensors_info_set_count (info, 1);
-
-  dim[0] = 0;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  dim[0] = 2;
-  dim[2] = 0;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  dim[2] = 1;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_EDGE_TPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  ml_tensors_info_destroy (info);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_VIVANTE, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  /* max rank 16 (ML_TENSOR_RANK_LIMIT) */
-  ml_tensors_info_create_extended (&info);
-  ml_tensors_info_set_count (info, 1);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SR, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  dim[0] = 0;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SLSI, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
 
-  dim[0] = 2;
-  dim[7] = 0;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  EXPECT_NE (status, ML_ERROR_NONE);
+#ifdef ENABLE_TENSORFLOW
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ */
+TEST (nnstreamer_capi_util, availability_02)
+{
+  bool result;
+  int status;
 
-  dim[7] = 1;
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  ml_tensors_info_destroy (info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
  */
-TEST (nnstreamer_capi_util, info_get_tdimension_01_n)
+TEST (nnstreamer_capi_util, availability_fail_02_n)
 {
+  bool result;
   int status;
-  ml_tensor_dimension dim;
 
-  status = ml_tensors_info_get_tensor_dimension (nullptr, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_NPU_VIVANTE, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+
+  status = ml_check_nnfw_availability (
+      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 }
+#endif /* ENABLE_TENSORFLOW */
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_util, info_get_tdimension_02_n)
+TEST (nnstreamer_capi_util, availability_03)
 {
+  bool result;
   int status;
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 2, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_util, info_get_tsize_01_n)
+TEST (nnstreamer_capi_util, availability_fail_03_n)
 {
+  bool result;
   int status;
-  ml_tensors_info_h info;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_size (info, 0, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 }
 
+#ifdef ENABLE_NNFW_RUNTIME
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of NNFW
  */
-TEST (nnstreamer_capi_util, info_get_tsize_02_n)
+TEST (nnstreamer_capi_util, availability_04)
 {
+  bool result;
   int status;
-  size_t data_size;
 
-  status = ml_tensors_info_get_tensor_size (nullptr, 0, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tsize_03_n)
-{
-  int status;
-  size_t data_size;
-  ml_tensors_info_h info;
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
-  EXPECT_TRUE (data_size == 0);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of NNFW
  */
-TEST (nnstreamer_capi_util, info_clone)
+TEST (nnstreamer_capi_util, availability_fail_04_n)
 {
-  gint status;
-  guint count = 0;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  bool result;
+  int status;
 
-  status = ml_tensors_info_create (&in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create (&out_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_SR, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  in_dim[0] = 5;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-
-  status = ml_tensors_info_set_count (in_info, 1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /* ENABLE_NNFW_RUNTIME */
 
-  status = ml_tensors_info_clone (out_info, in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+#ifdef ENABLE_MOVIDIUS_NCSDK2
+/**
+ * @brief Test NNStreamer Utility for checking availability of NCSDK2
+ */
+TEST (nnstreamer_capi_util, availability_05)
+{
+  bool result;
+  int status;
 
-  status = ml_tensors_info_get_count (out_info, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (in_dim[0] == out_dim[0]);
-  EXPECT_TRUE (in_dim[1] == out_dim[1]);
-  EXPECT_TRUE (in_dim[2] == out_dim[2]);
-  EXPECT_TRUE (in_dim[3] == out_dim[3]);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_destroy (in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (out_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking availability of NCSDK2
  */
-TEST (nnstreamer_capi_util, info_clone_extended)
+TEST (nnstreamer_capi_util, availability_fail_05_n)
 {
-  gint status;
-  guint i;
-  guint count = 0;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  bool result;
+  int status;
 
-  status = ml_tensors_info_create_extended (&in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create_extended (&out_info);
+  EXPECT_EQ (result, false);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /* ENABLE_MOVIDIUS_NCSDK2 */
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    in_dim[i] = i + 1;
-  }
+#ifdef ENABLE_ARMNN
+/**
+ * @brief Test NNStreamer Utility for checking availability of ARMNN
+ */
+TEST (nnstreamer_capi_util, availability_06)
+{
+  bool result;
+  int status;
 
-  status = ml_tensors_info_set_count (in_info, 1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_clone (out_info, in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_count (out_info, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU_NEON, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+}
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    EXPECT_TRUE (in_dim[i] == out_dim[i]);
-  }
+/**
+ * @brief Test NNStreamer Utility for checking availability of ARMNN
+ */
+TEST (nnstreamer_capi_util, availability_fail_06_n)
+{
+  bool result;
+  int status;
 
-  status = ml_tensors_info_destroy (in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (result, false);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU_EDGE_TPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 }
+#endif /* ENABLE_ARMNN */
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking an element availability
  */
-TEST (nnstreamer_capi_util, info_clone_max)
+TEST (nnstreamer_capi_util, element_available_01_p)
 {
-  gint status;
-  guint count = 0;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  bool available;
+  int status, n_elems, i;
+  /**
+   * If the allowed element list of nnstreamer is changed, this should also be changed.
+   * https://github.com/nnstreamer/nnstreamer/blob/main/packaging/nnstreamer.spec#L642 (# Element allowance in Tizen)
+   */
+  const gchar *allowed = "tensor_converter tensor_filter tensor_query_serversrc capsfilter input-selector output-selector queue tee valve appsink appsrc audioconvert audiorate audioresample audiomixer videoconvert videocrop videorate videoscale videoflip videomixer compositor fakesrc fakesink filesrc filesink audiotestsrc videotestsrc jpegparse jpegenc jpegdec pngenc pngdec tcpclientsink tcpclientsrc tcpserversink tcpserversrc xvimagesink ximagesink evasimagesink evaspixmapsink glimagesink theoraenc lame vorbisenc wavenc volume oggmux avimux matroskamux v4l2src avsysvideosrc camerasrc tvcamerasrc pulsesrc fimcconvert tizenwlsink gdppay gdpdepay join rtpdec rtspsrc rtspclientsink zmqsrc zmqsink mqttsrc mqttsink udpsrc udpsink multiudpsink audioamplify audiochebband audiocheblimit audiodynamic audioecho audiofirfilter audioiirfilter audioinvert audiokaraoke audiopanorama audiowsincband audiowsinclimit scaletempo stereo";
+  /* This not_allowed list is written only for testing. */
+  const gchar *not_allowed
+      = "videobox videobalance aasink adder alpha alsasink x264enc ximagesrc webpenc wavescope v4l2sink v4l2radio urisourcebin uridecodebin typefind timeoverlay rtpstreampay rtpsession rtpgstpay queue2 fdsink fdsrc chromium capssetter cairooverlay autovideosink";
+  gchar **elements;
+  gboolean restricted;
 
-  status = ml_tensors_info_create (&in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create (&out_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  restricted = nnsconf_get_custom_value_bool (
+      "element-restriction", "enable_element_restriction", FALSE);
 
-  in_dim[0] = 5;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
+  /* element restriction is disabled */
+  if (!restricted)
+    return;
 
-  status = ml_tensors_info_set_count (in_info, ML_TENSOR_SIZE_LIMIT);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  elements = g_strsplit (allowed, " ", -1);
+  n_elems = g_strv_length (elements);
 
-  for (unsigned int i = 0; i < ML_TENSOR_SIZE_LIMIT; ++i) {
-    status = ml_tensors_info_set_tensor_type (in_info, i, ML_TENSOR_TYPE_UINT8);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    status = ml_tensors_info_set_tensor_dimension (in_info, i, in_dim);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  }
-
-  status = ml_tensors_info_clone (out_info, in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_get_count (out_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, (guint) ML_TENSOR_SIZE_LIMIT);
-
-  for (unsigned int i = 0; i < ML_TENSOR_SIZE_LIMIT; ++i) {
-    status = ml_tensors_info_get_tensor_type (out_info, i, &type);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  for (i = 0; i < n_elems; i++) {
+    /* If the plugin is not installed, the availability of the element cannot be tested. */
+    GstElementFactory *factory = gst_element_factory_find (elements[i]);
 
-    status = ml_tensors_info_get_tensor_dimension (out_info, i, out_dim);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (in_dim[0] == out_dim[0]);
-    EXPECT_TRUE (in_dim[1] == out_dim[1]);
-    EXPECT_TRUE (in_dim[2] == out_dim[2]);
-    EXPECT_TRUE (in_dim[3] == out_dim[3]);
+    if (factory) {
+      status = ml_check_element_availability (elements[i], &available);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (available, true);
+      gst_object_unref (factory);
+    }
   }
+  g_strfreev (elements);
 
-  status = ml_tensors_info_destroy (in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (out_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-}
-
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_clone_01_n)
-{
-  int status;
-  ml_tensors_info_h src;
-
-  status = ml_tensors_info_create (&src);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_clone (nullptr, src);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  elements = g_strsplit (not_allowed, " ", -1);
+  n_elems = g_strv_length (elements);
 
-  status = ml_tensors_info_destroy (src);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < n_elems; i++) {
+    GstElementFactory *factory = gst_element_factory_find (elements[i]);
+    if (factory) {
+      status = ml_check_element_availability (elements[i], &available);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (available, false);
+      gst_object_unref (factory);
+    }
+  }
+  g_strfreev (elements);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking an element availability (null param)
  */
-TEST (nnstreamer_capi_util, info_clone_02_n)
+TEST (nnstreamer_capi_util, element_available_02_n)
 {
+  bool available;
   int status;
-  ml_tensors_info_h desc;
 
-  status = ml_tensors_info_create (&desc);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_clone (desc, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_element_availability (nullptr, &available);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (desc);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_element_availability ("tensor_filter", nullptr);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking an element availability (invalid element name)
  */
-TEST (nnstreamer_capi_util, data_create_01_n)
+TEST (nnstreamer_capi_util, element_available_03_n)
 {
+  bool available;
   int status;
-  ml_tensors_data_h data = nullptr;
 
-  status = ml_tensors_data_create (nullptr, &data);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_check_element_availability ("invalid-elem", &available);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (available, false);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking tensors info handle
  */
-TEST (nnstreamer_capi_util, data_create_02_n)
+TEST (nnstreamer_capi_util, tensors_info)
 {
-  int status;
   ml_tensors_info_h info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e out_type;
+  gchar *out_name;
+  size_t data_size;
+  int status;
 
   status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (info, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  in_dim[0] = 3;
+  in_dim[1] = 300;
+  in_dim[2] = 300;
+  in_dim[3] = 1;
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  /* add tensor info */
+  status = ml_tensors_info_set_count (info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_create_03_n)
-{
-  int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data = nullptr;
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid info */
-  status = ml_tensors_data_create (info, &data);
+  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  /* get tensor info */
+  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
 
-  status = ml_tensors_data_destroy (data);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, data_create_internal_n)
-{
-  int status;
+  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name == NULL);
 
-  status = _ml_tensors_data_create_no_alloc (NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_01_n)
-{
-  int status;
-  size_t data_size;
-  void *raw_data;
+  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
 
-  status = ml_tensors_data_get_tensor_data (nullptr, 0, &raw_data, &data_size);
+  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
+  g_free (out_name);
+
+  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_02_n)
-{
-  int status;
-  size_t data_size;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_get_tensor_data (data, 0, nullptr, &data_size);
+  /* get tensor size */
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300));
+
+  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
+
+  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
+
+  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
   status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer Utility for checking extended tensors info handle
  */
-TEST (nnstreamer_capi_util, data_get_tdata_03_n)
+TEST (nnstreamer_capi_util, tensors_info_extended)
 {
-  int status;
-  void *raw_data;
   ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e out_type;
+  gchar *out_name;
+  size_t data_size;
+  int status;
+  guint i;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create_extended (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    in_dim[i] = i % 4 + 1;
+  }
+
+  /* add tensor info */
+  status = ml_tensors_info_set_count (info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* get tensor info */
+  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    EXPECT_EQ (out_dim[i], i % 4 + 1);
+  }
+
+  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name == NULL);
+
+  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    EXPECT_EQ (out_dim[i], i % 4 + 1);
+  }
+
+  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
+  g_free (out_name);
+
+  /* get tensor size */
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4));
+
+  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == ((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * 8));
+
+  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size
+               == (((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4))
+                   + ((2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * (2 * 3 * 4) * 8)));
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions
+ */
+TEST (nnstreamer_capi_util, compare_info)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim;
+  int status;
+
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  dim[0] = 3;
+  dim[1] = 4;
+  dim[2] = 4;
+  dim[3] = 1;
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  /* compare info */
+  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+
+  /* change type */
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
+  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+
+  /* validate info */
+  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions
+ */
+TEST (nnstreamer_capi_util, compare_info_extended)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim;
+  int status, i;
+
+  status = ml_tensors_info_create_extended (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_create_extended (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    dim[i] = i + 1;
+  }
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  /* compare info */
+  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+
+  /* change type */
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
+  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+
+  /* validate info */
+  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions
+ */
+TEST (nnstreamer_capi_util, compare_info_extended_n)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim;
+  int status, i;
+
+  status = ml_tensors_info_create_extended (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    dim[i] = i + 1;
+  }
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  /* compare info */
+  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_create_1_n)
+{
+  int status = ml_tensors_info_create (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_create_2_n)
+{
+  ml_tensors_info_h i;
+  int status = _ml_tensors_info_create_from_gst (&i, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_create_3_n)
+{
+  GstTensorsInfo gi;
+  int status = _ml_tensors_info_create_from_gst (nullptr, &gi);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_create_4_n)
+{
+  int status = ml_tensors_info_create_extended (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_destroy_n)
+{
+  int status = ml_tensors_info_destroy (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_init_n)
+{
+  int status = _ml_tensors_info_initialize (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_valid_01_n)
+{
+  bool valid;
+  int status = ml_tensors_info_validate (nullptr, &valid);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_valid_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_info_validate (info, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_01_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  bool equal;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = _ml_tensors_info_compare (nullptr, info, &equal);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  bool equal;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = _ml_tensors_info_compare (info, nullptr, &equal);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_03_n)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  int status;
+
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  status = _ml_tensors_info_compare (info1, info2, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_0)
+{
+  bool equal;
+  ml_tensors_info_h info1, info2;
+  int status = ml_tensors_info_create (&info1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&info2);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_count (info1, 1U);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info2, 2U);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  ASSERT_FALSE (equal);
+
+  status = ml_tensors_info_destroy (info1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info2);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_1)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim = { 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 };
+  int status;
+  bool equal;
+
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  status = ml_tensors_info_create_extended (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  ASSERT_FALSE (equal);
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal) - the same configurations share the interned information.
+ */
+TEST (nnstreamer_capi_util, info_comp_2)
+{
+  ml_tensors_info_h info1, info2, info3;
+  ml_tensor_dimension dim = { 3, 4, 1, 1 };
+  int status;
+  bool equal;
+
+  ml_tensors_info_create (&info1);
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  ml_tensors_info_create (&info2);
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  ml_tensors_info_set_tensor_name (info2, 0, "name");
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (equal);
+  EXPECT_TRUE (((ml_tensors_info_s *) info1)->interned != nullptr);
+  EXPECT_EQ (((ml_tensors_info_s *) info1)->interned,
+      ((ml_tensors_info_s *) info2)->interned);
+
+  /* the clone shares the interned information */
+  status = _ml_tensors_info_create_from (info1, &info3);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((ml_tensors_info_s *) info1)->interned,
+      ((ml_tensors_info_s *) info3)->interned);
+
+  /* changed information should be compared again */
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_INT8);
+  EXPECT_TRUE (((ml_tensors_info_s *) info2)->interned == nullptr);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (equal);
+
+  dim[0] = 4;
+  ml_tensors_info_set_tensor_dimension (info3, 0, dim);
+  status = _ml_tensors_info_compare (info1, info3, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (equal);
+
+  dim[0] = 3;
+  ml_tensors_info_set_tensor_dimension (info3, 0, dim);
+  status = _ml_tensors_info_compare (info1, info3, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (equal);
+
+  ml_tensors_info_destroy (info1);
+  ml_tensors_info_destroy (info2);
+  ml_tensors_info_destroy (info3);
+}
+
+/**
+ * @brief Test utility functions (internal) - the dimensions with trailing 1s are same, and different configurations are not interned.
+ */
+TEST (nnstreamer_capi_util, info_comp_3)
+{
+  ml_tensors_info_h info1, info2, info3;
+  ml_tensor_dimension dim1 = { 3, 4, 1, 1 };
+  ml_tensor_dimension dim2 = { 3, 4, 0, 0 };
+  ml_tensor_dimension dim3 = { 4, 3, 1, 1 };
+  int status;
+  bool equal;
+
+  ml_tensors_info_create (&info1);
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim1);
+
+  ml_tensors_info_create (&info2);
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim2);
+
+  ml_tensors_info_create (&info3);
+  ml_tensors_info_set_count (info3, 1);
+  ml_tensors_info_set_tensor_type (info3, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info3, 0, dim3);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (equal);
+  EXPECT_TRUE (((ml_tensors_info_s *) info1)->interned != nullptr);
+  EXPECT_EQ (((ml_tensors_info_s *) info1)->interned,
+      ((ml_tensors_info_s *) info2)->interned);
+
+  /* the hash is different, compared without interning */
+  status = _ml_tensors_info_compare (info1, info3, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (equal);
+  EXPECT_TRUE (((ml_tensors_info_s *) info3)->interned == nullptr);
+
+  ml_tensors_info_destroy (info1);
+  ml_tensors_info_destroy (info2);
+  ml_tensors_info_destroy (info3);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_count_n)
+{
+  int status = ml_tensors_info_set_count (nullptr, 1);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_count_1_n)
+{
+  ml_tensors_info_h info;
+  int status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT + 1);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_count_1_n)
+{
+  unsigned int count;
+  int status = ml_tensors_info_get_count (nullptr, &count);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_count_2_n)
+{
+  ml_tensors_info_h info;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (info, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_0_n)
+{
+  int status = ml_tensors_info_set_tensor_name (nullptr, 0, "fail");
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_1_n)
+{
+  ml_tensors_info_h info;
+  int status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 3);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_name (info, 3, "fail");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_1)
+{
+  ml_tensors_info_h info;
+  int status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_name (info, 0, "first");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 0, "second");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_01_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  char *name = NULL;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (nullptr, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  char *name = NULL;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (info, 2, &name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_01_n)
+{
+  int status;
+
+  status = ml_tensors_info_set_tensor_type (nullptr, 0, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UNKNOWN);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_01_n)
+{
+  int status;
+  ml_tensor_type_e type;
+
+  status = ml_tensors_info_get_tensor_type (nullptr, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_type (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_type_e type;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_type (info, 2, &type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tdimension_01_n)
+{
+  int status;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_set_tensor_dimension (nullptr, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tdimension_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_dimension (info, 2, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tdimension_03_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0 };
+  int status;
+
+  /* max rank 4 (ML_TENSOR_RANK_LIMIT_PREV) */
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+
+  dim[0] = 0;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  dim[0] = 2;
+  dim[2] = 0;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  dim[2] = 1;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+
+  /* max rank 16 (ML_TENSOR_RANK_LIMIT) */
+  ml_tensors_info_create_extended (&info);
+  ml_tensors_info_set_count (info, 1);
+
+  dim[0] = 0;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  dim[0] = 2;
+  dim[7] = 0;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  dim[7] = 1;
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tdimension_01_n)
+{
+  int status;
+  ml_tensor_dimension dim;
+
+  status = ml_tensors_info_get_tensor_dimension (nullptr, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tdimension_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 2, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_01_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_size (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_02_n)
+{
+  int status;
+  size_t data_size;
+
+  status = ml_tensors_info_get_tensor_size (nullptr, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_03_n)
+{
+  int status;
+  size_t data_size;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_TRUE (data_size == 0);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone)
+{
+  gint status;
+  guint count = 0;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+
+  status = ml_tensors_info_create (&in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  in_dim[0] = 5;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  status = ml_tensors_info_set_count (in_info, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (out_info, in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (in_dim[0] == out_dim[0]);
+  EXPECT_TRUE (in_dim[1] == out_dim[1]);
+  EXPECT_TRUE (in_dim[2] == out_dim[2]);
+  EXPECT_TRUE (in_dim[3] == out_dim[3]);
+
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_extended)
+{
+  gint status;
+  guint i;
+  guint count = 0;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+
+  status = ml_tensors_info_create_extended (&in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create_extended (&out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    in_dim[i] = i + 1;
+  }
+
+  status = ml_tensors_info_set_count (in_info, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (out_info, in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
+    EXPECT_TRUE (in_dim[i] == out_dim[i]);
+  }
+
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_max)
+{
+  gint status;
+  guint count = 0;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+
+  status = ml_tensors_info_create (&in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  in_dim[0] = 5;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  status = ml_tensors_info_set_count (in_info, ML_TENSOR_SIZE_LIMIT);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (unsigned int i = 0; i < ML_TENSOR_SIZE_LIMIT; ++i) {
+    status = ml_tensors_info_set_tensor_type (in_info, i, ML_TENSOR_TYPE_UINT8);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_info_set_tensor_dimension (in_info, i, in_dim);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_tensors_info_clone (out_info, in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, (guint) ML_TENSOR_SIZE_LIMIT);
+
+  for (unsigned int i = 0; i < ML_TENSOR_SIZE_LIMIT; ++i) {
+    status = ml_tensors_info_get_tensor_type (out_info, i, &type);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+    status = ml_tensors_info_get_tensor_dimension (out_info, i, out_dim);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (in_dim[0] == out_dim[0]);
+    EXPECT_TRUE (in_dim[1] == out_dim[1]);
+    EXPECT_TRUE (in_dim[2] == out_dim[2]);
+    EXPECT_TRUE (in_dim[3] == out_dim[3]);
+  }
+
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_01_n)
+{
+  int status;
+  ml_tensors_info_h src;
+
+  status = ml_tensors_info_create (&src);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (nullptr, src);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (src);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_02_n)
+{
+  int status;
+  ml_tensors_info_h desc;
+
+  status = ml_tensors_info_create (&desc);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (desc, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (desc);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_01_n)
+{
+  int status;
+  ml_tensors_data_h data = nullptr;
+
+  status = ml_tensors_data_create (nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = nullptr;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid info */
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, data_create_internal_n)
+{
+  int status;
+
+  status = _ml_tensors_data_create_no_alloc (NULL, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_01_n)
+{
+  int status;
+  size_t data_size;
+  void *raw_data;
+
+  status = ml_tensors_data_get_tensor_data (nullptr, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_02_n)
+{
+  int status;
+  size_t data_size;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, nullptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_03_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_04_n)
+{
+  int status;
+  size_t data_size;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 2, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_01_n)
+{
+  int status;
+  void *raw_data;
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_data_set_tensor_data (nullptr, 0, raw_data, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, nullptr, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_03_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 2, raw_data, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_04_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_05_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
   status = ml_tensors_data_create (info, &data);
   ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, nullptr);
+  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 1024);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions - clone data.
+ */
+TEST (nnstreamer_capi_util, data_clone_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  const int raw_data[5] = { 10, 20, 30, 40, 50 };
+  int *result = nullptr;
+  size_t data_size, result_size;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+
+  /* test code : clone data and compare raw value. */
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (unsigned int i = 0; i < 5; i++)
+    EXPECT_EQ (result[i], raw_data[i]);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - refer data without copying.
+ */
+TEST (nnstreamer_capi_util, data_ref_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  const int raw_data[5] = { 10, 20, 30, 40, 50 };
+  const int new_data[5] = { 1, 2, 3, 4, 5 };
+  const int *result = nullptr;
+  const int *result_out = nullptr;
+  int *writable = nullptr;
+  size_t data_size, result_size;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+
+  status = ml_tensors_data_ref (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The buffer is shared, reading the data does not copy it. */
+  status = ml_tensors_data_peek_tensor_data (data, 0, (const void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_peek_tensor_data (data_out, 0, (const void **) &result_out, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, result_out);
+  EXPECT_EQ (result_size, data_size);
+  for (unsigned int i = 0; i < 5; i++)
+    EXPECT_EQ (result_out[i], raw_data[i]);
+
+  /* Writing the data copies the buffer, the original data is not changed. */
+  status = ml_tensors_data_set_tensor_data (data_out, 0, (const void *) new_data, data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_peek_tensor_data (data_out, 0, (const void **) &result_out, &result_size);
+  EXPECT_NE (result, result_out);
+  for (unsigned int i = 0; i < 5; i++) {
+    EXPECT_EQ (result[i], raw_data[i]);
+    EXPECT_EQ (result_out[i], new_data[i]);
+  }
+
+  /* The writable buffer of a handle does not change the other handle. */
+  status = ml_tensors_data_get_tensor_data (data, 0, (void **) &writable, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  writable[0] = 100;
+  for (unsigned int i = 0; i < 5; i++)
+    EXPECT_EQ (result_out[i], new_data[i]);
+
+  /* The buffer is valid after the original handle is released. */
+  ml_tensors_data_destroy (data);
+  for (unsigned int i = 0; i < 5; i++)
+    EXPECT_EQ (result_out[i], new_data[i]);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - refer data without copying.
+ */
+TEST (nnstreamer_capi_util, data_ref_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+
+  status = ml_tensors_data_ref (data, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_ref (nullptr, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+}
+
+/**
+ * @brief Test utility functions - clone data.
+ */
+TEST (nnstreamer_capi_util, data_clone_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+
+  status = ml_tensors_data_clone (data, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+}
+
+/**
+ * @brief Test utility functions - clone data.
+ */
+TEST (nnstreamer_capi_util, data_clone_03_n)
+{
+  int status;
+  ml_tensors_data_h data_out;
+
+  status = ml_tensors_data_clone (nullptr, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions - clone data.
+ */
+TEST (nnstreamer_capi_util, data_clone_04_p)
+{
+  int status, i;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1, 5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+  int raw_data[25];
+  int *result = nullptr;
+  size_t data_size, result_size;
+
+  for (i = 0; i < 25; i++)
+    raw_data[i] = i;
+
+  ml_tensors_info_create_extended (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+
+  /* test code : clone data and compare raw value. */
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (unsigned int i = 0; i < 25; i++)
+    EXPECT_EQ (result[i], raw_data[i]);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - clone data shares the buffers and copies on write.
+ */
+TEST (nnstreamer_capi_util, data_clone_05_p)
+{
+  int status, i;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  int raw_data[5];
+  int *src = nullptr, *result = nullptr;
+  size_t data_size, result_size;
+
+  for (i = 0; i < 5; i++)
+    raw_data[i] = i;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* cloned handle shares the buffer with the original one. */
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->shared
+      == ((ml_tensors_data_s *) data_out)->shared);
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->tensors[0].data
+      == ((ml_tensors_data_s *) data_out)->tensors[0].data);
+
+  /* update the original data, the clone should not be changed. */
+  raw_data[0] = 100;
+  status = ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, (void **) &src, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (src != result);
+  EXPECT_EQ (src[0], 100);
+  EXPECT_EQ (result[0], 0);
+  for (i = 1; i < 5; i++)
+    EXPECT_EQ (result[i], raw_data[i]);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - clone data and release the original handle first.
+ */
+TEST (nnstreamer_capi_util, data_clone_06_p)
+{
+  int status, i;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  int raw_data[5];
+  int *result = nullptr;
+  size_t data_size, result_size;
+
+  for (i = 0; i < 5; i++)
+    raw_data[i] = i;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (data);
+
+  /* the last reference owns the buffer, no copy is needed. */
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (result == ((ml_tensors_data_s *) data_out)->tensors[0].data);
+  for (i = 0; i < 5; i++)
+    EXPECT_EQ (result[i], raw_data[i]);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - clone data copies the written tensor only and does not alias the pointers given before.
+ */
+TEST (nnstreamer_capi_util, data_clone_07_p)
+{
+  int status, i;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensors_data_h data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  int raw_data[5];
+  int *src = nullptr, *result = nullptr;
+  size_t data_size, result_size;
+
+  for (i = 0; i < 5; i++)
+    raw_data[i] = i;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+  ml_tensors_data_set_tensor_data (data, 1, (const void *) raw_data, data_size);
+
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* writing a tensor copies its buffer only. */
+  status = ml_tensors_data_set_tensor_data (data_out, 0, (const void *) raw_data, data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->tensors[0].data
+      != ((ml_tensors_data_s *) data_out)->tensors[0].data);
+  EXPECT_TRUE (((ml_tensors_data_s *) data)->tensors[1].data
+      == ((ml_tensors_data_s *) data_out)->tensors[1].data);
+  ml_tensors_data_destroy (data_out);
+
+  /* the pointer given before cloning should not change the clone. */
+  status = ml_tensors_data_get_tensor_data (data, 1, (void **) &src, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_clone (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  src[0] = 100;
+  status = ml_tensors_data_get_tensor_data (data_out, 1, (void **) &result, &result_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (src != result);
+  EXPECT_EQ (result[0], 0);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - convert uint8 data to float32 (dequantize).
+ */
+TEST (nnstreamer_capi_util, data_convert_01_p)
+{
+  int status, i;
+  ml_tensors_info_h info, out_info;
+  ml_tensors_data_h data, data_out;
+  ml_tensor_dimension dim = { 20, 1, 1, 1 };
+  ml_tensor_type_e type;
+  uint8_t raw_data[20];
+  float *result = nullptr;
+  size_t data_size;
+
+  for (i = 0; i < 20; i++)
+    raw_data[i] = (uint8_t) (i * 10);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, 20);
+
+  status = ml_tensors_data_convert (data, ML_TENSOR_TYPE_FLOAT32, 0.5f, 100, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_info (data_out, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 20 * sizeof (float));
+  for (i = 0; i < 20; i++)
+    EXPECT_FLOAT_EQ (result[i], (i * 10 - 100) * 0.5f);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - convert float32 data to int8 (quantize with saturation).
+ */
+TEST (nnstreamer_capi_util, data_convert_02_p)
+{
+  int status, i;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_tensor_dimension dim = { 20, 1, 1, 1 };
+  float raw_data[20];
+  int8_t *result = nullptr;
+  size_t data_size;
+
+  for (i = 0; i < 20; i++)
+    raw_data[i] = (i - 10) * 30.0f;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, sizeof (raw_data));
+
+  status = ml_tensors_data_convert (data, ML_TENSOR_TYPE_INT8, 2.0f, 1, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 20U);
+  for (i = 0; i < 20; i++) {
+    int expected = (i - 10) * 15 + 1;
+
+    expected = MAX (-128, MIN (127, expected));
+    EXPECT_EQ (result[i], expected);
+  }
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - vectorized and scalar conversion should be same.
+ */
+TEST (nnstreamer_capi_util, data_convert_03_p)
+{
+  int status, i;
+  float src[1003];
+  uint8_t simd[1003], scalar[1003];
+
+  for (i = 0; i < 1003; i++)
+    src[i] = (i % 517) * 0.75f - 100.0f;
+
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, src,
+      ML_TENSOR_TYPE_UINT8, simd, 1003, 0.5f, 64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _ml_tensors_convert_set_force_scalar (TRUE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, src,
+      ML_TENSOR_TYPE_UINT8, scalar, 1003, 0.5f, 64);
+  _ml_tensors_convert_set_force_scalar (FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_EQ (memcmp (simd, scalar, sizeof (simd)), 0);
+}
+
+/**
+ * @brief Test utility functions - convert data with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_convert_04_n)
+{
+  int status;
+  ml_tensors_data_h data_out;
+
+  status = ml_tensors_data_convert (nullptr, ML_TENSOR_TYPE_FLOAT32, 1.0f, 0, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions - convert data with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_convert_05_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+
+  /* scale should be positive to dequantize */
+  status = ml_tensors_data_convert (data, ML_TENSOR_TYPE_FLOAT32, 0.0f, 0, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_convert (data, ML_TENSOR_TYPE_UNKNOWN, 1.0f, 0, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_convert (data, ML_TENSOR_TYPE_FLOAT32, 1.0f, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+}
+
+/**
+ * @brief Test utility functions - vectorized and scalar conversion should be same, including NaN payload and rounding.
+ */
+TEST (nnstreamer_capi_util, data_convert_06_p)
+{
+  int status, i;
+  uint32_t bits[1003];
+  uint16_t half[1003];
+  float simd_f32[1003], scalar_f32[1003];
+  uint16_t simd_f16[1003], scalar_f16[1003];
+  int8_t simd_i8[1003], scalar_i8[1003];
+
+  for (i = 0; i < 1003; i++) {
+    bits[i] = 0x33000000U + (uint32_t) i * 0x0123457U;
+    half[i] = (uint16_t) (i * 65u + (i % 7));
+  }
+
+  /* NaN with payload, signaling NaN, infinity, and the halfway values. */
+  bits[3] = 0x7fa00001U;
+  bits[5] = 0xff812345U;
+  bits[8] = 0x7f800000U;
+  bits[13] = 0x3f801000U;
+  bits[21] = 0x477ff000U;
+  half[2] = 0x7d01U;
+  half[4] = 0xfe55U;
+
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, bits,
+      ML_TENSOR_TYPE_FLOAT16, simd_f16, 1003, 1.0f, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT16, half,
+      ML_TENSOR_TYPE_FLOAT32, simd_f32, 1003, 1.0f, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, simd_f32,
+      ML_TENSOR_TYPE_INT8, simd_i8, 1003, 0.1f, -3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _ml_tensors_convert_set_force_scalar (TRUE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, bits,
+      ML_TENSOR_TYPE_FLOAT16, scalar_f16, 1003, 1.0f, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT16, half,
+      ML_TENSOR_TYPE_FLOAT32, scalar_f32, 1003, 1.0f, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_raw (ML_TENSOR_TYPE_FLOAT32, scalar_f32,
+      ML_TENSOR_TYPE_INT8, scalar_i8, 1003, 0.1f, -3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_convert_set_force_scalar (FALSE);
+
+  EXPECT_EQ (memcmp (simd_f16, scalar_f16, sizeof (simd_f16)), 0);
+  EXPECT_EQ (memcmp (simd_f32, scalar_f32, sizeof (simd_f32)), 0);
+  EXPECT_EQ (memcmp (simd_i8, scalar_i8, sizeof (simd_i8)), 0);
+
+  /* NaN is quiet and keeps the payload. */
+  EXPECT_EQ (scalar_f16[3], 0x7f00U);
+  EXPECT_EQ (scalar_f16[5], 0xfe09U);
+}
+
+/**
+ * @brief Test utility functions - convert float32 to bfloat16 and back.
+ */
+TEST (nnstreamer_capi_util, data_convert_bf16_01_p)
+{
+  int status, i;
+  ml_tensors_info_h info, info_out;
+  ml_tensors_data_h data, data_bf16, data_out;
+  ml_tensor_type_e type;
+  ml_tensor_dimension dim = { 8, 1, 1, 1 };
+  uint32_t bits[8] = { 0x3f800000, 0x3f808000, 0x3f818000, 0x3f808001,
+    0xc0490fdb, 0x00000000, 0x7f800000, 0x7fc00000 };
+  const uint16_t expected[8] = { 0x3f80, 0x3f80, 0x3f82, 0x3f81,
+    0xc049, 0x0000, 0x7f80, 0x7fc0 };
+  uint16_t *result_bf16 = nullptr;
+  float *result = nullptr;
+  size_t data_size;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_set_tensor_data (data, 0, (const void *) bits, sizeof (bits));
+
+  status = ml_tensors_data_convert_to_bfloat16 (data, &data_bf16);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_info (data_bf16, &info_out);
+  ml_tensors_info_get_tensor_type (info_out, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT16);
+  ml_tensors_info_destroy (info_out);
+
+  status = ml_tensors_data_get_tensor_data (data_bf16, 0, (void **) &result_bf16, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, sizeof (expected));
+  for (i = 0; i < 8; i++)
+    EXPECT_EQ (result_bf16[i], expected[i]);
+
+  status = ml_tensors_data_convert_from_bfloat16 (data_bf16, ML_TENSOR_TYPE_FLOAT32, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, sizeof (bits));
+  EXPECT_FLOAT_EQ (result[0], 1.0f);
+  EXPECT_NEAR (result[4], -3.14159f, 0.02f);
+  EXPECT_TRUE (std::isinf (result[6]));
+  EXPECT_TRUE (std::isnan (result[7]));
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_bf16);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - vectorized and scalar bfloat16 conversion should be same.
+ */
+TEST (nnstreamer_capi_util, data_convert_bf16_02_p)
+{
+  int status, i;
+  float src[1003], simd_f32[1003], scalar_f32[1003];
+  uint16_t simd[1003], scalar[1003];
+
+  for (i = 0; i < 1003; i++)
+    src[i] = (i % 517) * 0.0123f - 3.0f;
+  src[7] = NAN;
+
+  status = _ml_tensors_convert_bf16_raw (ML_TENSOR_TYPE_FLOAT32, src, simd, 1003, TRUE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_bf16_raw (ML_TENSOR_TYPE_FLOAT32, simd, simd_f32, 1003, FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _ml_tensors_convert_set_force_scalar (TRUE);
+  status = _ml_tensors_convert_bf16_raw (ML_TENSOR_TYPE_FLOAT32, src, scalar, 1003, TRUE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_convert_bf16_raw (ML_TENSOR_TYPE_FLOAT32, scalar, scalar_f32, 1003, FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_convert_set_force_scalar (FALSE);
+
+  EXPECT_EQ (memcmp (simd, scalar, sizeof (simd)), 0);
+  EXPECT_EQ (memcmp (simd_f32, scalar_f32, sizeof (simd_f32)), 0);
+}
+
+/**
+ * @brief Test utility functions - convert bfloat16 data with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_convert_bf16_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+
+  status = ml_tensors_data_convert_to_bfloat16 (nullptr, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+
+  /* integer tensors cannot be converted to or from bfloat16 */
+  status = ml_tensors_data_convert_to_bfloat16 (data, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_convert_from_bfloat16 (data, ML_TENSOR_TYPE_FLOAT32, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_convert_from_bfloat16 (data, ML_TENSOR_TYPE_INT32, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_convert_to_bfloat16 (data, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+}
+
+/**
+ * @brief Test utility functions - temporary data handles are reused in the same thread.
+ */
+TEST (nnstreamer_capi_util, data_temp_01_p)
+{
+  int status;
+  GstTensorsInfo gst_info;
+  GstTensorInfo *_info;
+  ml_tensors_data_h data1, data2;
+  ml_tensors_data_s *_data;
+  unsigned int count = 0;
+
+  gst_tensors_info_init (&gst_info);
+  gst_info.num_tensors = 1;
+  _info = gst_tensors_info_get_nth_info (&gst_info, 0);
+  _info->type = _NNS_UINT8;
+  _info->dimension[0] = 10;
+  _info->dimension[1] = 2;
+
+  status = _ml_tensors_data_acquire_temp (&gst_info, &data1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_data_release_temp (data1);
+
+  status = _ml_tensors_data_acquire_temp (&gst_info, &data2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data1, data2);
+
+  _data = (ml_tensors_data_s *) data2;
+  EXPECT_EQ (_data->num_tensors, 1U);
+  EXPECT_EQ (_data->tensors[0].size, 20U);
+  EXPECT_TRUE (_data->tensors[0].data == nullptr);
+  _ml_tensors_data_release_temp (data2);
+
+  /* the cached handle is updated with new information */
+  gst_info.num_tensors = 2;
+  _info = gst_tensors_info_get_nth_info (&gst_info, 1);
+  _info->type = _NNS_FLOAT32;
+  _info->dimension[0] = 4;
+
+  status = _ml_tensors_data_acquire_temp (&gst_info, &data1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _data = (ml_tensors_data_s *) data1;
+  EXPECT_EQ (_data->num_tensors, 2U);
+  EXPECT_EQ (_data->tensors[1].size, 16U);
+
+  ml_tensors_info_get_count (_data->info, &count);
+  EXPECT_EQ (count, 2U);
+  _ml_tensors_data_release_temp (data1);
+
+  gst_tensors_info_free (&gst_info);
+}
+
+/**
+ * @brief Test utility functions - temporary data handle with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_temp_02_n)
+{
+  int status;
+  GstTensorsInfo gst_info;
+  ml_tensors_data_h data;
+
+  gst_tensors_info_init (&gst_info);
+
+  status = _ml_tensors_data_acquire_temp (nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = _ml_tensors_data_acquire_temp (&gst_info, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Internal function to create an image tensor (uint8, NHWC) for pre-processing test.
+ */
+static ml_tensors_data_h
+_create_image_data (unsigned int ch, unsigned int w, unsigned int h)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = NULL;
+  ml_tensor_dimension dim = { ch, w, h, 1 };
+  uint8_t *raw;
+  size_t size, i;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
+  ml_tensors_info_destroy (info);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  for (i = 0; i < size; i++)
+    raw[i] = (uint8_t) (i % 251);
+
+  return data;
+}
+
+/**
+ * @brief Test utility functions - pre-process the image without resizing (normalize and NHWC).
+ */
+TEST (nnstreamer_capi_util, data_preprocess_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_option_h option;
+  ml_tensor_dimension dim = { 3, 4, 2, 1 };
+  const float mean[] = { 1.0f, 2.0f, 3.0f };
+  const float std[] = { 2.0f, 4.0f, 8.0f };
+  uint8_t *raw;
+  float *out;
+  size_t size, i;
+
+  data = _create_image_data (3, 4, 2);
+  ASSERT_TRUE (data != NULL);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_option_create (&option);
+  ml_option_set (option, "mean", g_strdup ("1,2,3"), g_free);
+  ml_option_set (option, "std", g_strdup ("2, 4, 8"), g_free);
+
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  ml_tensors_data_get_tensor_data (data_out, 0, (void **) &out, &size);
+  EXPECT_EQ (size, 3U * 4U * 2U * sizeof (float));
+
+  for (i = 0; i < 3U * 4U * 2U; i++)
+    EXPECT_NEAR (out[i], (raw[i] - mean[i % 3]) / std[i % 3], 1e-5);
+
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - pre-process the image with resizing and NCHW layout.
+ */
+TEST (nnstreamer_capi_util, data_preprocess_02_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_option_h option;
+  ml_tensor_dimension dim = { 2, 1, 3, 1 };
+  uint8_t *raw;
+  float *out;
+  size_t size;
+
+  /* 2x2 image, 3 channels, downscaled to a 2x1 image */
+  data = _create_image_data (3, 2, 2);
+  ASSERT_TRUE (data != NULL);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_option_create (&option);
+  ml_option_set (option, "layout", g_strdup ("NCHW"), g_free);
+
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  ml_tensors_data_get_tensor_data (data_out, 0, (void **) &out, &size);
+  EXPECT_EQ (size, 2U * 3U * sizeof (float));
+
+  /* each output pixel is the average of two rows, planes are ordered by channel */
+  EXPECT_FLOAT_EQ (out[0], (raw[0] + raw[6]) / 2.0f);
+  EXPECT_FLOAT_EQ (out[1], (raw[3] + raw[9]) / 2.0f);
+  EXPECT_FLOAT_EQ (out[2], (raw[1] + raw[7]) / 2.0f);
+  EXPECT_FLOAT_EQ (out[3], (raw[4] + raw[10]) / 2.0f);
+  EXPECT_FLOAT_EQ (out[4], (raw[2] + raw[8]) / 2.0f);
+  EXPECT_FLOAT_EQ (out[5], (raw[5] + raw[11]) / 2.0f);
+
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out);
+}
+
+/**
+ * @brief Test utility functions - pre-process a large image with multiple threads.
+ */
+TEST (nnstreamer_capi_util, data_preprocess_03_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out1, data_out2;
+  ml_option_h option;
+  ml_tensor_dimension dim = { 3, 512, 384, 1 };
+  void *out1, *out2;
+  size_t size1, size2;
+
+  data = _create_image_data (3, 1280, 720);
+  ASSERT_TRUE (data != NULL);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_option_create (&option);
+  ml_option_set (option, "num_threads", g_strdup ("1"), g_free);
+
+  status = ml_tensors_data_preprocess (data, info, option, &data_out1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_option_set (option, "num_threads", g_strdup ("4"), g_free);
+
+  status = ml_tensors_data_preprocess (data, info, option, &data_out2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the result should be same regardless of the number of threads */
+  ml_tensors_data_get_tensor_data (data_out1, 0, &out1, &size1);
+  ml_tensors_data_get_tensor_data (data_out2, 0, &out2, &size2);
+  EXPECT_EQ (size1, size2);
+  EXPECT_EQ (memcmp (out1, out2, size1), 0);
+
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data_out1);
+  ml_tensors_data_destroy (data_out2);
+}
+
+/**
+ * @brief Test utility functions - pre-process with invalid parameters.
+ */
+TEST (nnstreamer_capi_util, data_preprocess_04_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, data_out;
+  ml_option_h option;
+  ml_tensor_dimension dim = { 3, 2, 2, 1 };
+
+  data = _create_image_data (3, 4, 4);
+  ASSERT_TRUE (data != NULL);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_preprocess (nullptr, info, nullptr, &data_out);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_preprocess (data, nullptr, nullptr, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_preprocess (data, info, nullptr, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_create (&option);
+
+  /* invalid layout */
+  ml_option_set (option, "layout", g_strdup ("HWCN"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_option_set (option, "layout", g_strdup ("NHWC"), g_free);
+
+  /* mismatched number of channels */
+  ml_option_set (option, "mean", g_strdup ("1,2"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* zero std */
+  ml_option_set (option, "mean", g_strdup ("1"), g_free);
+  ml_option_set (option, "std", g_strdup ("0"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_option_set (option, "std", g_strdup ("1"), g_free);
+
+  /* invalid number of threads */
+  ml_option_set (option, "num_threads", g_strdup ("0"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_set (option, "num_threads", g_strdup ("-1"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_set (option, "num_threads", g_strdup ("18446744073709551617"), g_free);
+  status = ml_tensors_data_preprocess (data, info, option, &data_out);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Internal function to create tensors info of orange.raw.
  */
-TEST (nnstreamer_capi_util, data_get_tdata_04_n)
+static ml_tensors_info_h
+_create_orange_info (void)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 3, 224, 224, 1 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  return info;
+}
+
+/**
+ * @brief Test utility functions - create tensors data from the memory-mapped file.
+ */
+TEST (nnstreamer_capi_util, data_create_from_file_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, cloned;
+  ml_option_h option;
+  gchar *raw_content;
+  gsize raw_content_len;
+  void *raw;
+  size_t size;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_get_contents (orange_raw_file, &raw_content, &raw_content_len, NULL));
+
+  info = _create_orange_info ();
+
+  ml_option_create (&option);
+  ml_option_set (option, "populate", g_strdup ("true"), g_free);
+  ml_option_set (option, "advice", g_strdup ("sequential"), g_free);
+
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, option, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_clone (data, &cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, raw_content_len);
+  EXPECT_EQ (memcmp (raw, raw_content, size), 0);
+
+  /* writing the data changes neither the clone nor the file */
+  ((uint8_t *) raw)[0] = (uint8_t) (raw_content[0] + 1);
+  status = ml_tensors_data_get_tensor_data (cloned, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (memcmp (raw, raw_content, size), 0);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (cloned);
+
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (memcmp (raw, raw_content, size), 0);
+  ml_tensors_data_destroy (data);
+
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  g_free (raw_content);
+}
+
+/**
+ * @brief Test utility functions - create tensors data from the region of the file.
+ */
+TEST (nnstreamer_capi_util, data_create_from_file_02_p)
 {
   int status;
-  size_t data_size;
-  void *raw_data;
   ml_tensors_info_h info;
   ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_option_h option;
+  ml_tensor_dimension dim = { 3, 224, 1, 1 };
+  gchar *raw_content;
+  gsize raw_content_len;
+  void *raw;
+  size_t size;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_tensors_data_get_tensor_data (data, 2, &raw_data, &data_size);
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_get_contents (orange_raw_file, &raw_content, &raw_content_len, NULL));
+
+  /* the 101st row of the image, the offset is not aligned to the page size */
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_option_create (&option);
+  ml_option_set (option, "offset", g_strdup_printf ("%u", 100U * 224U * 3U), g_free);
+
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, option, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 224U * 3U);
+  EXPECT_EQ (memcmp (raw, raw_content + 100U * 224U * 3U, size), 0);
+
+  ml_tensors_data_destroy (data);
+  ml_option_destroy (option);
+  ml_tensors_info_destroy (info);
+  g_free (raw_content);
+}
+
+/**
+ * @brief Test utility functions - create tensors data from the file with invalid parameters.
+ */
+TEST (nnstreamer_capi_util, data_create_from_file_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_option_h option;
+  ml_tensor_dimension dim = { 3, 224, 1, 1 };
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+
+  info = _create_orange_info ();
+
+  status = ml_tensors_data_create_from_file (nullptr, info, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_from_file (orange_raw_file, nullptr, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, nullptr, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_from_file ("/no/such/file.raw", info, nullptr, &data);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  /* the region exceeds the file */
+  ml_option_create (&option);
+  ml_option_set (option, "offset", g_strdup ("1"), g_free);
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, option, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_set (option, "offset", g_strdup ("-1"), g_free);
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, option, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_set (option, "offset", g_strdup ("0"), g_free);
+  ml_option_set (option, "advice", g_strdup ("never"), g_free);
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, option, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_option_destroy (option);
+
+  /* the file size mismatches the info without offset */
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_tensors_data_create_from_file (orange_raw_file, info, nullptr, &data);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - get frames from the tensors file.
+ */
+TEST (nnstreamer_capi_util, tensors_file_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_file_h file;
+  ml_tensors_data_h data, data2;
+  ml_tensor_dimension dim = { 3, 224, 1, 1 };
+  unsigned int count, i;
+  gchar *raw_content;
+  gsize raw_content_len;
+  void *raw;
+  size_t size;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_get_contents (orange_raw_file, &raw_content, &raw_content_len, NULL));
+
+  /* each row of the image is a frame */
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_file_open (orange_raw_file, info, nullptr, &file);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_file_get_count (file, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 224U);
+
+  for (i = 0; i < count; i += 37) {
+    status = ml_tensors_file_get_frame (file, i, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+    EXPECT_EQ (size, 224U * 3U);
+    EXPECT_EQ (memcmp (raw, raw_content + i * size, size), 0);
+    ml_tensors_data_destroy (data);
+  }
+
+  /* the frames of same index do not alias each other */
+  status = ml_tensors_file_get_frame (file, 0, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_file_get_frame (file, 0, &data2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_set_tdata_01_n)
-{
-  int status;
-  void *raw_data;
+  ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  memset (raw, 0, size);
+  ml_tensors_data_get_tensor_data (data2, 0, &raw, &size);
+  EXPECT_EQ (memcmp (raw, raw_content, size), 0);
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (data2);
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  /* the frame is valid after closing the file */
+  status = ml_tensors_file_get_frame (file, count - 1, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (nullptr, 0, raw_data, 16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_file_close (file);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (raw_data);
+  ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (memcmp (raw, raw_content + (count - 1) * size, size), 0);
+  ml_tensors_data_destroy (data);
+
+  ml_tensors_info_destroy (info);
+  g_free (raw_content);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test utility functions - tensors file with invalid parameters.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_02_n)
+TEST (nnstreamer_capi_util, tensors_file_02_n)
 {
   int status;
   ml_tensors_info_h info;
+  ml_tensors_file_h file;
   ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensor_dimension dim = { 3, 224, 225, 1 };
+  unsigned int count;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_tensors_data_set_tensor_data (data, 0, nullptr, 16);
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+
+  info = _create_orange_info ();
+
+  status = ml_tensors_file_open (nullptr, info, nullptr, &file);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_tensors_file_open (orange_raw_file, nullptr, nullptr, &file);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_set_tdata_03_n)
-{
-  int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  status = ml_tensors_file_open (orange_raw_file, info, nullptr, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  status = ml_tensors_file_get_count (nullptr, &count);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_file_get_frame (nullptr, 0, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_set_tensor_data (data, 2, raw_data, 16);
+  status = ml_tensors_file_close (nullptr);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
+  status = ml_tensors_file_open (orange_raw_file, info, nullptr, &file);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_file_get_frame (file, 1, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_file_get_count (file, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_file_close (file);
+
+  /* a frame is larger than the file */
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  status = ml_tensors_file_open (orange_raw_file, info, nullptr, &file);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Internal function to create tensors data with the given number of tensors for serialization test.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_04_n)
+static ml_tensors_data_h
+_create_serialize_data (unsigned int num, unsigned int seed)
 {
-  int status;
-  void *raw_data;
   ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensors_data_h data = NULL;
+  ml_tensor_dimension dim = { 1, 1, 1, 1 };
+  uint8_t *raw;
+  size_t size, j;
+  unsigned int i;
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, num);
+  for (i = 0; i < num; i++) {
+    dim[0] = 3 + i * 5 + seed;
+    dim[1] = 2 + seed;
+    ml_tensors_info_set_tensor_type (info, i,
+        (i % 2) ? ML_TENSOR_TYPE_FLOAT32 : ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_dimension (info, i, dim);
+  }
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_create (info, &data);
+  ml_tensors_info_destroy (info);
 
-  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 0);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  for (i = 0; i < num; i++) {
+    ml_tensors_data_get_tensor_data (data, i, (void **) &raw, &size);
+    for (j = 0; j < size; j++)
+      raw[j] = (uint8_t) (j * 31 + i + seed);
+  }
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
+  return data;
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Internal function to compare tensors data and its information.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_05_n)
+static void
+_compare_serialize_data (ml_tensors_data_h data1, ml_tensors_data_h data2)
 {
-  int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensors_info_h info1, info2;
+  unsigned int count1, count2, i;
+  const void *raw1, *raw2;
+  size_t size1, size2;
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  ml_tensors_data_get_info (data1, &info1);
+  ml_tensors_data_get_info (data2, &info2);
+  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_get_count (info1, &count1);
+  ml_tensors_info_get_count (info2, &count2);
+  EXPECT_EQ (count1, count2);
 
-  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 1024);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  for (i = 0; i < count1; i++) {
+    ml_tensors_data_peek_tensor_data (data1, i, &raw1, &size1);
+    ml_tensors_data_peek_tensor_data (data2, i, &raw2, &size2);
+    EXPECT_EQ (size1, size2);
+    EXPECT_EQ (memcmp (raw1, raw2, size1), 0);
+  }
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
+  ml_tensors_info_destroy (info1);
+  ml_tensors_info_destroy (info2);
 }
 
 /**
- * @brief Test utility functions - clone data.
+ * @brief Test utility functions - serialize and deserialize multiple frames.
  */
-TEST (nnstreamer_capi_util, data_clone_01_p)
+TEST (nnstreamer_capi_util, data_serialize_01_p)
 {
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensors_data_h data_out;
-  ml_tensor_dimension dim = { 5, 1, 1, 1 };
-  const int raw_data[5] = { 10, 20, 30, 40, 50 };
-  int *result = nullptr;
-  size_t data_size, result_size;
+  ml_tensors_data_h frames[3], data;
+  ml_option_h option;
+  void *blob;
+  size_t size;
+  unsigned int num_frames, i;
+  void *raw;
+  const void *view, *view2;
+  size_t raw_size;
+  GBytes *bytes;
 
-  ml_tensors_info_create (&info);
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  frames[0] = _create_serialize_data (1, 0);
+  frames[1] = _create_serialize_data (3, 1);
+  frames[2] = _create_serialize_data (2, 2);
 
-  ml_tensors_data_create (info, &data);
-  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+  ml_option_create (&option);
+  ml_option_set (option, "checksum", g_strdup ("true"), g_free);
 
-  /* test code : clone data and compare raw value. */
-  status = ml_tensors_data_clone (data, &data_out);
+  status = ml_tensors_data_serialize (frames, 3, option, &blob, &size);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  status = ml_tensors_data_validate_serialized (blob, size, &num_frames);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  for (unsigned int i = 0; i < 5; i++)
-    EXPECT_EQ (result[i], raw_data[i]);
+  EXPECT_EQ (num_frames, 3U);
 
-  ml_tensors_info_destroy (info);
+  for (i = 0; i < num_frames; i++) {
+    status = ml_tensors_data_deserialize (blob, size, i, false, nullptr, nullptr, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    _compare_serialize_data (frames[i], data);
+    ml_tensors_data_destroy (data);
+
+    status = ml_tensors_data_deserialize (blob, size, i, true, nullptr, nullptr, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    _compare_serialize_data (frames[i], data);
+    ml_tensors_data_destroy (data);
+  }
+
+  /* the zero-copy view keeps the blob alive */
+  bytes = g_bytes_new (blob, size);
+  status = ml_tensors_data_deserialize (g_bytes_get_data (bytes, NULL), size, 2,
+      true, (ml_data_destroy_cb) g_bytes_unref, g_bytes_ref (bytes), &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_bytes_unref (bytes);
+
+  status = ml_tensors_data_peek_tensor_data (data, 0, &view, &raw_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _compare_serialize_data (frames[2], data);
+
+  status = ml_tensors_data_peek_tensor_data (data, 0, &view2, &raw_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (view == view2);
   ml_tensors_data_destroy (data);
-  ml_tensors_data_destroy (data_out);
+
+  /* writing the zero-copy view does not change the blob */
+  status = ml_tensors_data_deserialize (blob, size, 1, true, nullptr, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (data, 0, &raw, &raw_size);
+  EXPECT_FALSE (raw >= blob && (uint8_t *) raw < (uint8_t *) blob + size);
+  ((uint8_t *) raw)[0]++;
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_data_validate_serialized (blob, size, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_option_destroy (option);
+  for (i = 0; i < 3; i++)
+    ml_tensors_data_destroy (frames[i]);
+  g_free (blob);
 }
 
 /**
- * @brief Test utility functions - clone data.
+ * @brief Test utility functions - serialize the image without checksum.
  */
-TEST (nnstreamer_capi_util, data_clone_02_n)
+TEST (nnstreamer_capi_util, data_serialize_02_p)
 {
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  ml_tensors_data_h data, out;
+  void *blob;
+  size_t size;
+  unsigned int num_frames;
 
-  ml_tensors_info_create (&info);
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ml_tensors_data_create (info, &data);
+  data = _create_image_data (3, 224, 224);
+  ASSERT_TRUE (data != NULL);
 
-  status = ml_tensors_data_clone (data, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_serialize (&data, 1, NULL, &blob, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (size, 224U * 224U * 3U);
 
-  ml_tensors_info_destroy (info);
+  status = ml_tensors_data_validate_serialized (blob, size, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (num_frames, 1U);
+
+  status = ml_tensors_data_deserialize (blob, size, 0, true, nullptr, nullptr, &out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _compare_serialize_data (data, out);
+
+  ml_tensors_data_destroy (out);
   ml_tensors_data_destroy (data);
+  g_free (blob);
 }
 
 /**
- * @brief Test utility functions - clone data.
+ * @brief Test utility functions - deserialize the corrupted blob.
  */
-TEST (nnstreamer_capi_util, data_clone_03_n)
+TEST (nnstreamer_capi_util, data_serialize_03_n)
 {
   int status;
-  ml_tensors_data_h data_out;
+  ml_tensors_data_h frames[2], data;
+  ml_option_h option;
+  uint8_t *blob;
+  size_t size;
+  unsigned int num_frames;
 
-  status = ml_tensors_data_clone (nullptr, &data_out);
+  frames[0] = _create_serialize_data (2, 0);
+  frames[1] = _create_serialize_data (2, 1);
+
+  ml_option_create (&option);
+  ml_option_set (option, "checksum", g_strdup ("true"), g_free);
+
+  status = ml_tensors_data_serialize (frames, 2, option, (void **) &blob, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* truncated */
+  status = ml_tensors_data_validate_serialized (blob, size - 1, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_deserialize (blob, size - 1, 1, false, nullptr, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* out of range */
+  status = ml_tensors_data_deserialize (blob, size, 2, false, nullptr, nullptr, &data);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* corrupted data */
+  blob[size - 1] ^= 0xFF;
+  status = ml_tensors_data_validate_serialized (blob, size, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  blob[size - 1] ^= 0xFF;
+
+  /* invalid magic */
+  blob[0] ^= 0xFF;
+  status = ml_tensors_data_validate_serialized (blob, size, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_deserialize (blob, size, 0, true, nullptr, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+  ml_tensors_data_destroy (frames[0]);
+  ml_tensors_data_destroy (frames[1]);
+  g_free (blob);
 }
 
 /**
- * @brief Test utility functions - clone data.
+ * @brief Test utility functions - serialize with invalid parameters.
  */
-TEST (nnstreamer_capi_util, data_clone_04_p)
+TEST (nnstreamer_capi_util, data_serialize_04_n)
 {
-  int status, i;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensors_data_h data_out;
-  ml_tensor_dimension dim = { 5, 1, 1, 1, 5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
-  int raw_data[25];
-  int *result = nullptr;
-  size_t data_size, result_size;
+  int status;
+  ml_tensors_data_h frames[2], data;
+  void *blob;
+  size_t size;
+  unsigned int num_frames;
 
-  for (i = 0; i < 25; i++)
-    raw_data[i] = i;
+  frames[0] = _create_serialize_data (1, 0);
+  frames[1] = nullptr;
 
-  ml_tensors_info_create_extended (&info);
-  ml_tensors_info_set_count (info, 1);
-  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT32);
-  ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  status = ml_tensors_data_serialize (nullptr, 1, nullptr, &blob, &size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_serialize (frames, 0, nullptr, &blob, &size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_serialize (frames, 2, nullptr, &blob, &size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_serialize (frames, 1, nullptr, nullptr, &size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_data_create (info, &data);
-  ml_tensors_data_set_tensor_data (data, 0, (const void *) raw_data, data_size);
+  status = ml_tensors_data_serialize (frames, 1, nullptr, &blob, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* test code : clone data and compare raw value. */
-  status = ml_tensors_data_clone (data, &data_out);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_validate_serialized (nullptr, 0, &num_frames);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_get_tensor_data (data_out, 0, (void **) &result, &result_size);
+  status = ml_tensors_data_serialize (frames, 1, nullptr, &blob, &size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  for (unsigned int i = 0; i < 25; i++)
-    EXPECT_EQ (result[i], raw_data[i]);
 
-  ml_tensors_info_destroy (info);
-  ml_tensors_data_destroy (data);
-  ml_tensors_data_destroy (data_out);
+  status = ml_tensors_data_validate_serialized (blob, size, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_deserialize (blob, size, 0, false, nullptr, nullptr, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_deserialize (nullptr, size, 0, false, nullptr, nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (frames[0]);
+  g_free (blob);
 }
 
 /**
@@ -4206,6 +7578,127 @@ TEST (nnstreamer_capi_util, getVersion)
   g_free (version);
 }
 
+/**
+ * @brief Internal function to get the value of memory statistics.
+ */
+static size_t
+_get_memory_stat (const char *key)
+{
+  ml_information_h stats;
+  size_t *value = NULL;
+  size_t ret = 0;
+
+  if (ml_api_get_memory_stats (&stats) != ML_ERROR_NONE)
+    return 0;
+
+  if (ml_information_get (stats, key, (void **) &value) == ML_ERROR_NONE)
+    ret = *value;
+
+  ml_information_destroy (stats);
+  return ret;
+}
+
+/**
+ * @brief Test to get memory statistics of tensors data.
+ */
+TEST (nnstreamer_capi_util, memoryStats_01_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, cloned;
+  ml_tensor_dimension dim = { 10, 10, 1, 1 };
+  size_t current, objects, total, queued;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  current = _get_memory_stat ("user.current");
+  objects = _get_memory_stat ("user.objects");
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current + 400U);
+  EXPECT_EQ (_get_memory_stat ("user.objects"), objects + 1U);
+  EXPECT_GE (_get_memory_stat ("user.peak"), current + 400U);
+  EXPECT_GE (_get_memory_stat ("current"), 400U);
+  EXPECT_GE (_get_memory_stat ("peak"), _get_memory_stat ("current"));
+
+  /* cloned handle shares the buffers */
+  status = ml_tensors_data_clone (data, &cloned);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current + 400U);
+
+  /* the shared buffers are accounted once, moving to new origin */
+  total = _get_memory_stat ("current");
+  queued = _get_memory_stat ("query_queue.current");
+  status = _ml_tensors_data_account ((ml_tensors_data_s *) cloned,
+      ML_MEMORY_ORIGIN_QUERY_QUEUE, FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (_get_memory_stat ("current"), total);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current);
+  EXPECT_EQ (_get_memory_stat ("query_queue.current"), queued + 400U);
+
+  status = _ml_tensors_data_account ((ml_tensors_data_s *) cloned,
+      ML_MEMORY_ORIGIN_USER, FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (_get_memory_stat ("current"), total);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current + 400U);
+  EXPECT_EQ (_get_memory_stat ("query_queue.current"), queued);
+
+  ml_tensors_data_destroy (data);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current + 400U);
+
+  ml_tensors_data_destroy (cloned);
+  EXPECT_EQ (_get_memory_stat ("user.current"), current);
+  EXPECT_EQ (_get_memory_stat ("user.objects"), objects);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test to get memory statistics with invalid parameter.
+ */
+TEST (nnstreamer_capi_util, memoryStats_02_n)
+{
+  int status = ml_api_get_memory_stats (NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test to allocate tensors data exceeding the memory budget.
+ */
+TEST (nnstreamer_capi_util, memoryBudget_01_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = NULL;
+  ml_tensor_dimension dim = { 1024, 1024, 1, 1 };
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_api_set_memory_budget (_get_memory_stat ("current") + 1024U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_GT (_get_memory_stat ("budget"), 0U);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_OUT_OF_MEMORY);
+  EXPECT_TRUE (data == NULL);
+
+  status = ml_api_set_memory_budget (0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (data);
+
+  ml_tensors_info_destroy (info);
+}
+
 /**
  * @brief Test case of Element Property Control.
  * @detail Run the `ml_pipeline_element_get_handle()` API and check its results.
@@ -6329,16 +9822,190 @@ TEST (nnstreamer_capi_element, get_property_double_01_p)
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_sharpness, 0.72);
+
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_sharpness, 1.43);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_double_02_n)
+{
+  int status;
+  double ret_sharpness;
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_double (nullptr, "sharpness", &ret_sharpness);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_double_03_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
+  int status;
+  double ret_sharpness;
+  gchar *pipeline;
+
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_double (vscale_h, "WRONG_NAME", &ret_sharpness);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_double_04_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
+  int status;
+  double wrong_type;
+  gchar *pipeline;
+
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_double (vscale_h, "method", &wrong_type);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_double_05_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
+  int status;
+  gchar *pipeline;
+
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", nullptr);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_enum_01_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
+  int status;
+  gchar *pipeline;
+
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sharpness, 0.72);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sharpness, 1.43);
 
   status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -6351,28 +10018,26 @@ TEST (nnstreamer_capi_element, get_property_double_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_double_02_n)
+TEST (nnstreamer_capi_element, set_property_enum_02_n)
 {
   int status;
-  double ret_sharpness;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_double (nullptr, "sharpness", &ret_sharpness);
+  status = ml_pipeline_element_set_property_enum (nullptr, "method", 3U);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_double_03_n)
+TEST (nnstreamer_capi_element, set_property_enum_03_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  double ret_sharpness;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -6386,11 +10051,8 @@ TEST (nnstreamer_capi_element, get_property_double_03_n)
   status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "WRONG_NAME", &ret_sharpness);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "WRONG_NAME", 3U);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vscale_h);
@@ -6404,35 +10066,28 @@ TEST (nnstreamer_capi_element, get_property_double_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_double_04_n)
+TEST (nnstreamer_capi_element, set_property_enum_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
-  double wrong_type;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "method", &wrong_type);
+  status = ml_pipeline_element_set_property_enum (udpsrc_h, "timeout", 12345);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -6443,13 +10098,15 @@ TEST (nnstreamer_capi_element, get_property_double_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_double_05_n)
+TEST (nnstreamer_capi_element, get_property_enum_01_p)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vscale_h = nullptr;
   int status;
+  uint32_t ret_method;
+  int32_t ret_signed_method;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -6463,12 +10120,34 @@ TEST (nnstreamer_capi_element, get_property_double_05_n)
   status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", nullptr);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_method, 3U);
+
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_method, 5U);
+
+  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_uint32 (vscale_h, "method", &ret_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_method, 2U);
+
+  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_int32 (vscale_h, "method", &ret_signed_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_signed_method, 4);
 
   status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -6481,13 +10160,28 @@ TEST (nnstreamer_capi_element, get_property_double_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_enum_01_p)
+TEST (nnstreamer_capi_element, get_property_enum_02_n)
+{
+  int status;
+  uint32_t ret_method;
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_enum (nullptr, "method", &ret_method);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_enum_03_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vscale_h = nullptr;
   int status;
+  uint32_t ret_method;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -6501,18 +10195,12 @@ TEST (nnstreamer_capi_element, set_property_enum_01_p)
   status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
   status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* Test Code */
+  status = ml_pipeline_element_get_property_enum (vscale_h, "WRONG_NAME", &ret_method);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -6525,22 +10213,47 @@ TEST (nnstreamer_capi_element, set_property_enum_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_enum_02_n)
+TEST (nnstreamer_capi_element, get_property_enum_04_n)
 {
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h demux_h = nullptr;
+  gchar *pipeline;
+  uint32_t ret_wrong_type;
   int status;
 
+  pipeline = g_strdup (
+      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
+      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_string (demux_h, "tensorpick", "1,2");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   /* Test Code */
-  status = ml_pipeline_element_set_property_enum (nullptr, "method", 3U);
+  status = ml_pipeline_element_get_property_enum (demux_h, "tensorpick", &ret_wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (demux_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_enum_03_n)
+TEST (nnstreamer_capi_element, get_property_enum_05_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vscale_h = nullptr;
@@ -6558,8 +10271,11 @@ TEST (nnstreamer_capi_element, set_property_enum_03_n)
   status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   /* Test Code */
-  status = ml_pipeline_element_set_property_enum (vscale_h, "WRONG_NAME", 3U);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vscale_h);
@@ -6573,28 +10289,62 @@ TEST (nnstreamer_capi_element, set_property_enum_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @detail Construct the pipeline and run it during updating elements' property.
  */
-TEST (nnstreamer_capi_element, set_property_enum_04_n)
+TEST (nnstreamer_capi_element, scenario_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
-  int status;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_state_e state;
   gchar *pipeline;
+  int status;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup ("videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale ! video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! "
+                       "tensor_converter ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_enum (udpsrc_h, "timeout", 12345);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* Test code: Set the videotestsrc pattern */
+  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
+
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+
+  /* Stop playing */
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
+
+  /* Test code: Set the new videotestsrc pattern */
+  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 12);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Resume playing */
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
+
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
+
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -6605,654 +10355,797 @@ TEST (nnstreamer_capi_element, set_property_enum_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @detail Construct the pipeline and run it during updating elements' property.
  */
-TEST (nnstreamer_capi_element, get_property_enum_01_p)
+TEST (nnstreamer_capi_element, scenario_02_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
-  uint32_t ret_method;
-  int32_t ret_signed_method;
+  ml_pipeline_sink_h sinkhandle = nullptr;
+  ml_pipeline_element_h asink_h = nullptr;
   gchar *pipeline;
+  guint *count_sink;
+  int status;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
+
+  count_sink = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "sinkx", &asink_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 3U);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (100000);
 
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 5U);
+  EXPECT_TRUE (*count_sink > 0U);
 
-  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
+  /* Test Code */
+  *count_sink = 0;
+
+  status = ml_pipeline_element_set_property_bool (asink_h, "emit-signals", FALSE);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_uint32 (vscale_h, "method", &ret_method);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 2U);
 
-  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  g_usleep (100000);
+
+  /* Since `emit-signals` property of appsink is set as FALSE, *count_sink should be 0. */
+  EXPECT_TRUE (*count_sink == 0U);
+
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_int32 (vscale_h, "method", &ret_signed_method);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_signed_method, 4);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (asink_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
  */
-TEST (nnstreamer_capi_element, get_property_enum_02_n)
+TEST (nnstreamer_capi_internal, copy_from_gst)
 {
   int status;
-  uint32_t ret_method;
+  ml_tensors_info_h ml_info;
+  ml_tensor_type_e type;
+  ml_tensor_dimension dim;
+  char *name;
+  unsigned int count;
+  GstTensorsInfo gst_info;
+  guint i;
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (nullptr, "method", &ret_method);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  gst_tensors_info_init (&gst_info);
+  gst_info.num_tensors = 2;
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    gst_info.info[0].dimension[i] = i + 1;
+    gst_info.info[1].dimension[i] = i + 1;
+  }
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
- */
-TEST (nnstreamer_capi_element, get_property_enum_03_n)
-{
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
-  uint32_t ret_method;
-  gchar *pipeline;
+  status = ml_tensors_info_create (&ml_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_count (ml_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 2U);
+  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (dim[0], 1U);
+  EXPECT_EQ (dim[1], 2U);
+  EXPECT_EQ (dim[2], 3U);
+  EXPECT_EQ (dim[3], 4U);
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  gst_info.info[0].type = _NNS_INT32;
+  gst_info.info[1].type = _NNS_UINT32;
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT32);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT32);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  gst_info.info[0].type = _NNS_INT16;
+  gst_info.info[1].type = _NNS_UINT16;
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT16);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  gst_info.info[0].type = _NNS_INT8;
+  gst_info.info[1].type = _NNS_UINT8;
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT8);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "WRONG_NAME", &ret_method);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  gst_info.info[0].type = _NNS_INT64;
+  gst_info.info[1].type = _NNS_UINT64;
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT64);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT64);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  gst_info.info[0].type = _NNS_FLOAT64;
+  gst_info.info[1].type = _NNS_FLOAT32;
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT64);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  status = ml_pipeline_destroy (handle);
+  gst_info.info[0].name = g_strdup ("tn1");
+  gst_info.info[1].name = g_strdup ("tn2");
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_name (ml_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "tn1");
+  g_free (name);
+  status = ml_tensors_info_get_tensor_name (ml_info, 1, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "tn2");
+  g_free (name);
+
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  gst_tensors_info_free (&gst_info);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
  */
-TEST (nnstreamer_capi_element, get_property_enum_04_n)
+TEST (nnstreamer_capi_internal, copy_from_gst_extended)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h demux_h = nullptr;
-  gchar *pipeline;
-  uint32_t ret_wrong_type;
   int status;
+  ml_tensors_info_h ml_info;
+  ml_tensor_dimension dim;
+  unsigned int count;
+  GstTensorsInfo gst_info;
+  guint i;
 
-  pipeline = g_strdup (
-      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
-      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
+  gst_tensors_info_init (&gst_info);
+  gst_info.num_tensors = 2;
+  gst_info.info[0].type = _NNS_UINT32;
+  gst_info.info[1].type = _NNS_UINT32;
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    gst_info.info[0].dimension[i] = i + 1;
+    gst_info.info[1].dimension[i] = i + 1;
+  }
 
-  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
+  status = ml_tensors_info_create_extended (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_string (demux_h, "tensorpick", "1,2");
+  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
+  status = ml_tensors_info_get_count (ml_info, &count);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (demux_h, "tensorpick", &ret_wrong_type);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_release_handle (demux_h);
+  EXPECT_EQ (count, 2U);
+  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    EXPECT_EQ (dim[i], i + 1);
+  }
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  gst_tensors_info_free (&gst_info);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
  */
-TEST (nnstreamer_capi_element, get_property_enum_05_n)
+TEST (nnstreamer_capi_internal, copy_from_gst_01_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  GstTensorsInfo gst_info;
   int status;
-  gchar *pipeline;
-
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  gst_tensors_info_init (&gst_info);
+  status = _ml_tensors_info_copy_from_gst (NULL, &gst_info);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ */
+TEST (nnstreamer_capi_internal, copy_from_gst_02_n)
+{
+  ml_tensors_info_h ml_info;
+  int status;
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", nullptr);
+  status = _ml_tensors_info_copy_from_gst (ml_info, NULL);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_destroy (handle);
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Construct the pipeline and run it during updating elements' property.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
  */
-TEST (nnstreamer_capi_element, scenario_01_p)
+TEST (nnstreamer_capi_internal, copy_from_ml)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
-  ml_pipeline_state_e state;
-  gchar *pipeline;
   int status;
+  ml_tensors_info_h ml_info;
+  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+  GstTensorsInfo gst_info;
 
-  pipeline = g_strdup ("videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale ! video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! "
-                       "tensor_converter ! tensor_sink name=sinkx");
+  gst_tensors_info_init (&gst_info);
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_tensors_info_set_count (ml_info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (ml_info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (ml_info, 1, dim);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test code: Set the videotestsrc pattern */
-  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 4);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.num_tensors, 2U);
+  EXPECT_EQ (gst_info.info[0].dimension[0], 1U);
+  EXPECT_EQ (gst_info.info[0].dimension[1], 2U);
+  EXPECT_EQ (gst_info.info[0].dimension[2], 3U);
+  EXPECT_EQ (gst_info.info[0].dimension[3], 4U);
+
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT32);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT32);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT32);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT32);
 
-  status = ml_pipeline_start (handle);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT16);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT16);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT16);
 
-  status = ml_pipeline_get_state (handle, &state);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT8);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
-
-  /* Stop playing */
-  status = ml_pipeline_stop (handle);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT8);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT8);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT8);
 
-  /* Test code: Set the new videotestsrc pattern */
-  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 12);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT64);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* Resume playing */
-  status = ml_pipeline_start (handle);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT64);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT64);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT64);
 
-  status = ml_pipeline_get_state (handle, &state);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_FLOAT64);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
-
-  status = ml_pipeline_stop (handle);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_FLOAT32);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_FLOAT64);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_FLOAT32);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_tensors_info_set_tensor_name (ml_info, 0, "tn1");
   EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (ml_info, 1, "tn2");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
+  EXPECT_STREQ (gst_info.info[0].name, "tn1");
+  EXPECT_STREQ (gst_info.info[1].name, "tn2");
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  gst_tensors_info_free (&gst_info);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Construct the pipeline and run it during updating elements' property.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
  */
-TEST (nnstreamer_capi_element, scenario_02_p)
+TEST (nnstreamer_capi_internal, copy_from_ml_01_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_sink_h sinkhandle = nullptr;
-  ml_pipeline_element_h asink_h = nullptr;
-  gchar *pipeline;
-  guint *count_sink;
+  ml_tensors_info_h ml_info;
   int status;
 
-  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
-
-  count_sink = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "sinkx", &asink_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
-
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_usleep (100000);
-
-  status = ml_pipeline_stop (handle);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (*count_sink > 0U);
-
-  /* Test Code */
-  *count_sink = 0;
 
-  status = ml_pipeline_element_set_property_bool (asink_h, "emit-signals", FALSE);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_info_copy_from_ml (NULL, ml_info);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (handle);
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
+}
 
-  g_usleep (100000);
-
-  /* Since `emit-signals` property of appsink is set as FALSE, *count_sink should be 0. */
-  EXPECT_TRUE (*count_sink == 0U);
-
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ */
+TEST (nnstreamer_capi_internal, copy_from_ml_02_n)
+{
+  GstTensorsInfo gst_info;
+  int status;
 
-  status = ml_pipeline_sink_unregister (sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_tensors_info_copy_from_ml (&gst_info, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  status = ml_pipeline_element_release_handle (asink_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Invoke callback for custom-easy filter.
+ */
+static int
+test_custom_easy_cb (const ml_tensors_data_h in, ml_tensors_data_h out, void *user_data)
+{
+  /* test code, set data size. */
+  if (user_data) {
+    void *raw_data = NULL;
+    size_t *data_size = (size_t *) user_data;
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_get_tensor_data (out, 0, &raw_data, data_size);
+  }
 
-  g_free (pipeline);
-  g_free (count_sink);
+  return 0;
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ * @brief Test for custom-easy registration.
  */
-TEST (nnstreamer_capi_internal, copy_from_gst)
+TEST (nnstreamer_capi_custom, register_filter_01_p)
 {
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h in_data;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
-  ml_tensors_info_h ml_info;
-  ml_tensor_type_e type;
-  ml_tensor_dimension dim;
-  char *name;
-  unsigned int count;
-  GstTensorsInfo gst_info;
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinkx",
+      test_custom_filter);
+  guint *count_sink = (guint *) g_malloc0 (sizeof (guint));
+  size_t *filter_data_size = (size_t *) g_malloc0 (sizeof (size_t));
+  size_t data_size;
   guint i;
 
-  gst_tensors_info_init (&gst_info);
-  gst_info.num_tensors = 2;
-  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
-    gst_info.info[0].dimension[i] = i + 1;
-    gst_info.info[1].dimension[i] = i + 1;
-  }
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
 
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_count (ml_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 2U);
-  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
+  /* test code for custom filter */
+  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
+      out_info, test_custom_easy_cb, filter_data_size, &custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (dim[0], 1U);
-  EXPECT_EQ (dim[1], 2U);
-  EXPECT_EQ (dim[2], 3U);
-  EXPECT_EQ (dim[3], 4U);
 
-  gst_info.info[0].type = _NNS_INT32;
-  gst_info.info[1].type = _NNS_UINT32;
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT32);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT32);
 
-  gst_info.info[0].type = _NNS_INT16;
-  gst_info.info[1].type = _NNS_UINT16;
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  status = ml_pipeline_sink_register (
+      pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT16);
 
-  gst_info.info[0].type = _NNS_INT8;
-  gst_info.info[1].type = _NNS_UINT8;
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT8);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  gst_info.info[0].type = _NNS_INT64;
-  gst_info.info[1].type = _NNS_UINT64;
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT64);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  status = ml_pipeline_start (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT64);
 
-  gst_info.info[0].type = _NNS_FLOAT64;
-  gst_info.info[1].type = _NNS_FLOAT32;
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  for (i = 0; i < 5; i++) {
+    status = ml_tensors_data_create (in_info, &in_data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (src, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
+
+  status = ml_pipeline_stop (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT64);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+
+  status = ml_pipeline_src_release_handle (src);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  gst_info.info[0].name = g_strdup ("tn1");
-  gst_info.info[1].name = g_strdup ("tn2");
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_name (ml_info, 0, &name);
+  status = ml_pipeline_sink_unregister (sink);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "tn1");
-  g_free (name);
-  status = ml_tensors_info_get_tensor_name (ml_info, 1, &name);
+
+  status = ml_pipeline_destroy (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "tn2");
-  g_free (name);
 
-  status = ml_tensors_info_destroy (ml_info);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  gst_tensors_info_free (&gst_info);
+  /* check received data in sink node */
+  EXPECT_TRUE (*count_sink > 0U);
+  EXPECT_TRUE (*filter_data_size > 0U && *filter_data_size == data_size);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (filter_data_size);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_gst_extended)
+TEST (nnstreamer_capi_custom, register_filter_02_n)
 {
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
   int status;
-  ml_tensors_info_h ml_info;
-  ml_tensor_dimension dim;
-  unsigned int count;
-  GstTensorsInfo gst_info;
-  guint i;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  gst_tensors_info_init (&gst_info);
-  gst_info.num_tensors = 2;
-  gst_info.info[0].type = _NNS_UINT32;
-  gst_info.info[1].type = _NNS_UINT32;
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
-    gst_info.info[0].dimension[i] = i + 1;
-    gst_info.info[1].dimension[i] = i + 1;
-  }
 
-  status = ml_tensors_info_create_extended (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  _ml_tensors_info_copy_from_gst (ml_info, &gst_info);
-  status = ml_tensors_info_get_count (ml_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 2U);
-  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
-    EXPECT_EQ (dim[i], i + 1);
-  }
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      NULL, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  gst_tensors_info_free (&gst_info);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_gst_01_n)
+TEST (nnstreamer_capi_custom, register_filter_03_n)
 {
-  GstTensorsInfo gst_info;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h out_info;
   int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  gst_tensors_info_init (&gst_info);
-  status = _ml_tensors_info_copy_from_gst (NULL, &gst_info);
+  ml_tensors_info_create (&out_info);
+
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, NULL, out_info, test_custom_easy_cb, NULL, &custom);
   EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_gst_02_n)
+TEST (nnstreamer_capi_custom, register_filter_04_n)
 {
-  ml_tensors_info_h ml_info;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info;
   int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&in_info);
 
-  status = _ml_tensors_info_copy_from_gst (ml_info, NULL);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, NULL, test_custom_easy_cb, NULL, &custom);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (in_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_ml)
+TEST (nnstreamer_capi_custom, register_filter_05_n)
 {
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
   int status;
-  ml_tensors_info_h ml_info;
-  ml_tensor_dimension dim = { 1, 2, 3, 4 };
-  GstTensorsInfo gst_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  gst_tensors_info_init (&gst_info);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (ml_info, 2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (ml_info, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (ml_info, 1, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.num_tensors, 2U);
-  EXPECT_EQ (gst_info.info[0].dimension[0], 1U);
-  EXPECT_EQ (gst_info.info[0].dimension[1], 2U);
-  EXPECT_EQ (gst_info.info[0].dimension[2], 3U);
-  EXPECT_EQ (gst_info.info[0].dimension[3], 4U);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT32);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT32);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, NULL, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT16);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT16);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT16);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT8);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT8);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_06_n)
+{
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_tensors_info_h in_info, out_info;
+  int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT64);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT64);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_FLOAT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_FLOAT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_FLOAT64);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_FLOAT32);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_tensors_info_set_tensor_name (ml_info, 0, "tn1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (ml_info, 1, "tn2");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, ml_info);
-  EXPECT_STREQ (gst_info.info[0].name, "tn1");
-  EXPECT_STREQ (gst_info.info[1].name, "tn2");
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_07_n)
+{
+  int status;
+
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_unregister (NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_08_n)
+{
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  int status;
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  /* test code with invalid output info */
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  gst_tensors_info_free (&gst_info);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_ml_01_n)
+TEST (nnstreamer_capi_custom, register_filter_09_n)
 {
-  ml_tensors_info_h ml_info;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
 
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = _ml_tensors_info_copy_from_ml (NULL, ml_info);
+  /* test code with invalid input info */
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_ml_02_n)
+TEST (nnstreamer_capi_custom, register_filter_10_n)
 {
-  GstTensorsInfo gst_info;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom, custom2;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
 
-  status = _ml_tensors_info_copy_from_ml (&gst_info, NULL);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+
+  /* test code for duplicated name */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
+      out_info, test_custom_easy_cb, NULL, &custom2);
   EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Invoke callback for custom-easy filter.
+ * @brief Test for custom-easy unregistration.
+ * @detail Failed if pipeline is constructed.
  */
-static int
-test_custom_easy_cb (const ml_tensors_data_h in, ml_tensors_data_h out, void *user_data)
+TEST (nnstreamer_capi_custom, register_filter_11_n)
 {
-  /* test code, set data size. */
-  if (user_data) {
-    void *raw_data = NULL;
-    size_t *data_size = (size_t *) user_data;
+  ml_pipeline_h pipe1, pipe2;
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  int status;
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter framework=custom-easy model=tfilter_unreg_test ! tensor_sink name=sinkx");
 
-    ml_tensors_data_get_tensor_data (out, 0, &raw_data, data_size);
-  }
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  return 0;
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+
+  status = ml_pipeline_custom_easy_filter_register ("tfilter_unreg_test",
+      in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* failed to unregister custom-easy filter if pipeline is constructed */
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* successfully done if all pipelines with custom-easy filter are destroyed */
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test for custom-easy registration.
+ * @brief Test for custom-easy filter invoked concurrently.
  */
-TEST (nnstreamer_capi_custom, register_filter_01_p)
+TEST (nnstreamer_capi_custom, thread_safe_01_p)
 {
-  const char test_custom_filter[] = "test-custom-filter";
+  const char test_custom_filter[] = "test-custom-filter-thread-safe";
   ml_pipeline_h pipe;
   ml_pipeline_src_h src;
-  ml_pipeline_sink_h sink;
+  ml_pipeline_sink_h sink0, sink1;
   ml_custom_easy_filter_h custom;
   ml_tensors_info_h in_info, out_info;
   ml_tensors_data_h in_data;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
   gchar *pipeline = g_strdup_printf (
-      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinkx",
-      test_custom_filter);
-  guint *count_sink = (guint *) g_malloc0 (sizeof (guint));
-  size_t *filter_data_size = (size_t *) g_malloc0 (sizeof (size_t));
-  size_t data_size;
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tee name=t "
+      "t. ! queue ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinkx "
+      "t. ! queue ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinky",
+      test_custom_filter, test_custom_filter);
+  guint *count_sink0 = (guint *) g_malloc0 (sizeof (guint));
+  guint *count_sink1 = (guint *) g_malloc0 (sizeof (guint));
   guint i;
 
   ml_tensors_info_create (&in_info);
@@ -7264,18 +11157,23 @@ TEST (nnstreamer_capi_custom, register_filter_01_p)
   ml_tensors_info_set_count (out_info, 1);
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-  ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
 
-  /* test code for custom filter */
   status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
-      out_info, test_custom_easy_cb, filter_data_size, &custom);
+      out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_custom_easy_filter_set_thread_safe (custom, true);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_sink_register (
-      pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
+      pipe, "sinkx", test_sink_callback_count, count_sink0, &sink0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (
+      pipe, "sinky", test_sink_callback_count, count_sink1, &sink1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
@@ -7290,17 +11188,21 @@ TEST (nnstreamer_capi_custom, register_filter_01_p)
 
     status = ml_pipeline_src_input_data (src, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
     EXPECT_EQ (status, ML_ERROR_NONE);
-
-    g_usleep (50000); /* 50ms. Wait a bit. */
   }
 
+  wait_pipeline_process_buffers (*count_sink0, 5);
+  wait_pipeline_process_buffers (*count_sink1, 5);
+  EXPECT_EQ (*count_sink0, 5U);
+  EXPECT_EQ (*count_sink1, 5U);
+
   status = ml_pipeline_stop (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_src_release_handle (src);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_unregister (sink);
+  status = ml_pipeline_sink_unregister (sink0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_unregister (sink1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (pipe);
@@ -7309,327 +11211,347 @@ TEST (nnstreamer_capi_custom, register_filter_01_p)
   status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* check received data in sink node */
-  EXPECT_TRUE (*count_sink > 0U);
-  EXPECT_TRUE (*filter_data_size > 0U && *filter_data_size == data_size);
-
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
   g_free (pipeline);
-  g_free (count_sink);
-  g_free (filter_data_size);
-}
-
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_02_n)
-{
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
-
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      NULL, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  g_free (count_sink0);
+  g_free (count_sink1);
 }
 
 /**
- * @brief Test for custom-easy registration.
+ * @brief Test for custom-easy filter invoked concurrently.
  * @detail Invalid params.
  */
-TEST (nnstreamer_capi_custom, register_filter_03_n)
+TEST (nnstreamer_capi_custom, thread_safe_02_n)
 {
-  const char test_custom_filter[] = "test-custom-filter";
+  const char test_custom_filter[] = "test-custom-filter-thread-safe";
+  ml_pipeline_h pipe;
   ml_custom_easy_filter_h custom;
-  ml_tensors_info_h out_info;
-  int status;
+  ml_tensors_info_h info;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
-
-  ml_tensors_info_create (&out_info);
-
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, NULL, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (out_info);
-}
-
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_04_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info;
   int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  gchar *pipeline = g_strdup_printf (
+      "appsrc ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tensor_filter framework=custom-easy model=%s ! tensor_sink",
+      test_custom_filter);
 
-  ml_tensors_info_create (&in_info);
+  status = ml_pipeline_custom_easy_filter_set_thread_safe (NULL, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  /* test code with null param */
   status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, NULL, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (in_info);
-}
-
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_05_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+      test_custom_filter, info, info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  /* The filter is used in the pipeline. */
+  status = ml_pipeline_custom_easy_filter_set_thread_safe (custom, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, NULL, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (info);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Invoke callback for custom-easy filter, copying the input.
  */
-TEST (nnstreamer_capi_custom, register_filter_06_n)
+static int
+test_custom_easy_copy_cb (const ml_tensors_data_h in, ml_tensors_data_h out, void *user_data)
 {
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_tensors_info_h in_info, out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  void *in_data, *out_data;
+  size_t in_size, out_size;
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
-
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  ml_tensors_data_get_tensor_data (in, 0, &in_data, &in_size);
+  ml_tensors_data_get_tensor_data (out, 0, &out_data, &out_size);
+  memcpy (out_data, in_data, MIN (in_size, out_size));
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* Delay the odd inputs to shuffle the order of outputs. */
+  if (((int8_t *) in_data)[0] % 2)
+    g_usleep (10000);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  return 0;
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief A tensor-sink callback checking the order of outputs.
  */
-TEST (nnstreamer_capi_custom, register_filter_07_n)
+static void
+test_sink_callback_order (
+    const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  int status;
+  guint *count = (guint *) user_data;
+  void *raw;
+  size_t size;
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_unregister (NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  if (ml_tensors_data_get_tensor_data (data, 0, &raw, &size) != ML_ERROR_NONE)
+    return;
+
+  G_LOCK (callback_lock);
+  if (((int8_t *) raw)[0] == (int8_t) *count)
+    *count = *count + 1;
+  G_UNLOCK (callback_lock);
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Test for the pipeline with the replicas of tensor_filter.
  */
-TEST (nnstreamer_capi_custom, register_filter_08_n)
+TEST (nnstreamer_capi_custom, parallel_filter_01_p)
 {
-  const char test_custom_filter[] = "test-custom-filter";
+  const char test_custom_filter[] = "test-custom-filter-parallel";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
   ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h info;
+  ml_tensors_data_h in_data;
+  ml_option_h option;
+  ml_information_list_h stats;
+  ml_information_h stat;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  gchar *name;
+  uint64_t *value;
+  unsigned int i, length;
+  gboolean found = FALSE;
+  int8_t data[2];
   int status;
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=custom-easy model=%s ! tensor_sink name=sinkx",
+      test_custom_filter);
+  guint *count_sink = (guint *) g_malloc0 (sizeof (guint));
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-  /* test code with invalid output info */
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
   status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+      test_custom_filter, info, info, test_custom_easy_copy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
+  status = ml_pipeline_custom_easy_filter_set_thread_safe (custom, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_09_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-  int status;
+  ml_option_create (&option);
+  ml_option_set (option, "parallel_filter", g_strdup ("filterx"), g_free);
+  ml_option_set (option, "parallel_replicas", g_strdup ("4"), g_free);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_pipeline_construct_with_option (pipeline, option, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  /* test code with invalid input info */
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  status = ml_pipeline_set_stats_enabled (pipe, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (
+      pipe, "sinkx", test_sink_callback_order, count_sink, &sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_10_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom, custom2;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-  int status;
+  status = ml_pipeline_start (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  for (i = 0; i < 20; i++) {
+    data[0] = data[1] = (int8_t) i;
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+    status = ml_tensors_data_create (info, &in_data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_set_tensor_data (in_data, 0, data, sizeof (data));
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+    status = ml_pipeline_src_input_data (src, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
 
-  /* test code for duplicated name */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  /* The outputs are in the order of inputs. */
+  wait_pipeline_process_buffers (*count_sink, 20);
+  EXPECT_EQ (*count_sink, 20U);
+
+  status = ml_pipeline_get_stats (pipe, &stats);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
-      out_info, test_custom_easy_cb, NULL, &custom2);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_information_list_length (stats, &length);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < length; i++) {
+    status = ml_information_list_get (stats, i, &stat);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_information_get (stat, "name", (void **) &name);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    if (g_str_equal (name, "filterx")) {
+      found = TRUE;
+
+      status = ml_information_get (stat, "replicas", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (*value, 4U);
+
+      status = ml_information_get (stat, "throughput_gain", (void **) &value);
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_GT (*value, 0U);
+    }
+  }
+  EXPECT_TRUE (found);
+  ml_information_list_destroy (stats);
+
+  status = ml_pipeline_stop (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_release_handle (src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_unregister (sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (info);
+  g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test for custom-easy unregistration.
- * @detail Failed if pipeline is constructed.
+ * @brief Test for the pipeline with the replicas of tensor_filter, pushing the inputs in a buffer list.
  */
-TEST (nnstreamer_capi_custom, register_filter_11_n)
+TEST (nnstreamer_capi_custom, parallel_filter_03_p)
 {
-  ml_pipeline_h pipe1, pipe2;
+  const char test_custom_filter[] = "test-custom-filter-parallel-list";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
   ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h info;
+  ml_tensors_data_h in_data[20];
+  ml_option_h option;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  unsigned int i;
+  int8_t data[2];
   int status;
   gchar *pipeline = g_strdup_printf (
       "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
-      "tensor_filter framework=custom-easy model=tfilter_unreg_test ! tensor_sink name=sinkx");
+      "tensor_filter name=filterx framework=custom-easy model=%s ! tensor_sink name=sinkx",
+      test_custom_filter);
+  guint *count_sink = (guint *) g_malloc0 (sizeof (guint));
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, info, info, test_custom_easy_copy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register ("tfilter_unreg_test",
-      in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  status = ml_pipeline_custom_easy_filter_set_thread_safe (custom, true);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe1);
+  ml_option_create (&option);
+  ml_option_set (option, "parallel_filter", g_strdup ("filterx"), g_free);
+  ml_option_set (option, "parallel_replicas", g_strdup ("2"), g_free);
+#if defined(__linux__)
+  ml_option_set (option, "parallel_affinity", g_strdup ("0,0"), g_free);
+#endif
+
+  status = ml_pipeline_construct_with_option (pipeline, option, NULL, NULL, &pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe2);
+  status = ml_pipeline_sink_register (
+      pipe, "sinkx", test_sink_callback_order, count_sink, &sink);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* failed to unregister custom-easy filter if pipeline is constructed */
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (pipe1);
+  status = ml_pipeline_start (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  for (i = 0; i < 20; i++) {
+    data[0] = data[1] = (int8_t) i;
 
-  status = ml_pipeline_destroy (pipe2);
+    status = ml_tensors_data_create (info, &in_data[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_data_set_tensor_data (in_data[i], 0, data, sizeof (data));
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* The buffers in the list are distributed to the replicas one by one. */
+  status = ml_pipeline_src_input_data_batch (
+      src, in_data, 20, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The outputs are in the order of inputs. */
+  wait_pipeline_process_buffers (*count_sink, 20);
+  EXPECT_EQ (*count_sink, 20U);
+
+  status = ml_pipeline_stop (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_release_handle (src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_unregister (sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The replicas waiting for the order of output are released while destroying the pipeline. */
+  status = ml_pipeline_destroy (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* successfully done if all pipelines with custom-easy filter are destroyed */
   status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (info);
   g_free (pipeline);
+  g_free (count_sink);
+}
+
+/**
+ * @brief Test for the pipeline with the replicas of tensor_filter, with invalid option.
+ */
+TEST (nnstreamer_capi_custom, parallel_filter_02_n)
+{
+  const char *pipeline = "videotestsrc num-buffers=3 ! videoconvert ! tensor_converter name=conv ! tensor_sink";
+  ml_pipeline_h pipe;
+  ml_option_h option;
+  int status;
+
+  status = ml_pipeline_construct_with_option (pipeline, NULL, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_create (&option);
+
+  /* The replicas without the filter. */
+  ml_option_set (option, "parallel_replicas", g_strdup ("2"), g_free);
+  status = ml_pipeline_construct_with_option (pipeline, option, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* The element is not tensor_filter. */
+  ml_option_set (option, "parallel_filter", g_strdup ("conv"), g_free);
+  status = ml_pipeline_construct_with_option (pipeline, option, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* The invalid number of replicas. */
+  ml_option_set (option, "parallel_replicas", g_strdup ("0"), g_free);
+  status = ml_pipeline_construct_with_option (pipeline, option, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
 }
 
 /**
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 #include <fcntl.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -279,6 +280,110 @@ TEST_F (nnstreamer_capi_singleshot_latency, benchmarkNNFWRuntime)
 }
 #endif
 
+/**
+ * @brief The number of pipelines to measure the streaming threads.
+ */
+#define PIPELINE_COUNT 50
+
+/**
+ * @brief Sink callback counting the buffers, to measure the pipelines.
+ */
+static void
+benchmark_sink_cb (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
+{
+  g_atomic_int_inc ((gint *) user_data);
+}
+
+/**
+ * @brief Get the number of threads in this process.
+ */
+static guint
+benchmark_get_num_threads (void)
+{
+  gchar *contents = NULL;
+  gchar *line;
+  guint threads = 0;
+
+  if (g_file_get_contents ("/proc/self/status", &contents, NULL, NULL)) {
+    line = g_strstr_len (contents, -1, "Threads:");
+    if (line)
+      threads = (guint) g_ascii_strtoull (line + sizeof ("Threads:") - 1, NULL, 10);
+    g_free (contents);
+  }
+
+  return threads;
+}
+
+/**
+ * @brief Get the CPU time (us) used by this process.
+ */
+static int64_t
+benchmark_get_cpu_time (void)
+{
+  struct rusage usage;
+
+  getrusage (RUSAGE_SELF, &usage);
+  return (int64_t) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * G_USEC_PER_SEC
+         + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+/**
+ * @brief Measure the threads, CPU time and latency of many pipelines.
+ * @note Each pipeline runs 2 streaming tasks (source and queue), and each task occupies a thread while the pipeline is playing.
+ */
+TEST (nnstreamer_capi_pipeline_latency, benchmarkPipelines)
+{
+  const char *pipeline = "videotestsrc num-buffers=30 ! video/x-raw,format=RGB,width=32,height=32,framerate=30/1 ! "
+                         "queue ! tensor_converter ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle[PIPELINE_COUNT];
+  ml_pipeline_sink_h sink[PIPELINE_COUNT];
+  gint received[PIPELINE_COUNT] = { 0, };
+  guint threads, peak_threads = 0;
+  int64_t start, end, cpu;
+  int status, i, done;
+
+  for (i = 0; i < PIPELINE_COUNT; i++) {
+    status = ml_pipeline_construct (pipeline, NULL, NULL, &handle[i]);
+    ASSERT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_sink_register (handle[i], "sinkx", benchmark_sink_cb, &received[i], &sink[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  cpu = benchmark_get_cpu_time ();
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < PIPELINE_COUNT; i++) {
+    status = ml_pipeline_start (handle[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* Wait until all pipelines are done, up to 10 seconds. */
+  do {
+    threads = benchmark_get_num_threads ();
+    peak_threads = MAX (peak_threads, threads);
+
+    for (i = 0, done = 0; i < PIPELINE_COUNT; i++)
+      done += (g_atomic_int_get (&received[i]) >= 30) ? 1 : 0;
+
+    if (done < PIPELINE_COUNT)
+      g_usleep (1000);
+  } while (done < PIPELINE_COUNT && g_get_monotonic_time () - start < 10 * G_USEC_PER_SEC);
+
+  end = g_get_monotonic_time ();
+  cpu = benchmark_get_cpu_time () - cpu;
+  EXPECT_EQ (done, PIPELINE_COUNT);
+
+  g_warning ("%d pipelines: peak threads = %u, CPU time = %" G_GINT64_FORMAT
+             " us, elapsed = %f us per buffer",
+      PIPELINE_COUNT, peak_threads, cpu, (end - start) * 1.0 / 30);
+
+  for (i = 0; i < PIPELINE_COUNT; i++) {
+    ml_pipeline_sink_unregister (sink[i]);
+    ml_pipeline_destroy (handle[i]);
+  }
+}
+
 /**
  * @brief Main gtest
  */
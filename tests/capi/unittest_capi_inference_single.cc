@@ -4036,6 +4036,370 @@ TEST (nnstreamer_capi_singleshot, many_in_many_out)
   EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
+/**
+ * @brief Test Single with image pre-processing stage.
+ */
+TEST (nnstreamer_capi_singleshot, set_preprocess_01_p)
+{
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  ml_single_h single;
+  ml_tensors_info_h in_info, img_info;
+  ml_tensors_data_h input, image, output1, output2;
+  ml_option_h option;
+  ml_tensor_dimension img_dim = { 3, 640, 480, 1 };
+  void *out1, *out2, *raw;
+  size_t size1, size2, raw_size;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *test_model = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_test (orange_raw_file, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_TRUE (g_file_get_contents (orange_raw_file, (gchar **) &raw, &raw_size, NULL));
+  status = ml_tensors_data_set_tensor_data (input, 0, raw, raw_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (raw);
+
+  status = ml_single_invoke (single, input, &output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* same size image without normalization should give the same result */
+  ml_option_create (&option);
+  ml_option_set (option, "layout", g_strdup ("NHWC"), g_free);
+
+  status = ml_single_set_preprocess (single, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
+
+  status = ml_single_invoke (single, input, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (output1, 0, &out1, &size1);
+  ml_tensors_data_get_tensor_data (output2, 0, &out2, &size2);
+  EXPECT_EQ (size1, size2);
+  EXPECT_EQ (memcmp (out1, out2, size1), 0);
+  ml_tensors_data_destroy (output2);
+
+  /* image with different size is resized */
+  ml_tensors_info_create (&img_info);
+  ml_tensors_info_set_count (img_info, 1);
+  ml_tensors_info_set_tensor_type (img_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (img_info, 0, img_dim);
+  ml_tensors_data_create (img_info, &image);
+
+  status = ml_single_invoke (single, image, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (output2);
+
+  /* disable pre-processing, then the image is not compatible with the model */
+  status = ml_single_set_preprocess (single, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, image, &output2);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (image);
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (output1);
+  ml_tensors_info_destroy (img_info);
+  ml_tensors_info_destroy (in_info);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test Single with invalid pre-processing option.
+ */
+TEST (nnstreamer_capi_singleshot, set_preprocess_02_n)
+{
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  ml_single_h single;
+  ml_option_h option;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *test_model = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_set_preprocess (NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  ml_option_create (&option);
+  ml_option_set (option, "std", g_strdup ("1,a,3"), g_free);
+
+  status = ml_single_set_preprocess (single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_option_destroy (option);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test Single with input conversion.
+ */
+TEST (nnstreamer_capi_singleshot, set_input_conversion_01_p)
+{
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  ml_single_h single;
+  ml_tensors_info_h in_info, f32_info;
+  ml_tensors_data_h input, input_f32, output1, output2;
+  ml_option_h option;
+  void *out1, *out2, *raw;
+  float *f32;
+  size_t size1, size2, raw_size, i;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *test_model = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  g_autofree gchar *orange_raw_file = g_build_filename (
+      root_path, "tests", "test_models", "data", "orange.raw", NULL);
+  ASSERT_TRUE (g_file_test (orange_raw_file, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_TRUE (g_file_get_contents (orange_raw_file, (gchar **) &raw, &raw_size, NULL));
+  status = ml_tensors_data_set_tensor_data (input, 0, raw, raw_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* float32 input with the same values (scale 0.5) */
+  ml_tensors_info_clone (&f32_info, in_info);
+  ml_tensors_info_set_tensor_type (f32_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_data_create (f32_info, &input_f32);
+
+  ml_tensors_data_get_tensor_data (input_f32, 0, (void **) &f32, &size1);
+  for (i = 0; i < raw_size; i++)
+    f32[i] = ((uint8_t *) raw)[i] * 0.5f;
+  g_free (raw);
+
+  status = ml_single_invoke (single, input, &output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* float32 input is not compatible without conversion */
+  status = ml_single_invoke (single, input_f32, &output2);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_option_create (&option);
+  ml_option_set (option, "scale", g_strdup ("0.5"), g_free);
+
+  status = ml_single_set_input_conversion (single, option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_option_destroy (option);
+
+  status = ml_single_invoke (single, input_f32, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (output1, 0, &out1, &size1);
+  ml_tensors_data_get_tensor_data (output2, 0, &out2, &size2);
+  EXPECT_EQ (size1, size2);
+  EXPECT_EQ (memcmp (out1, out2, size1), 0);
+  ml_tensors_data_destroy (output2);
+
+  /* the input with same types is not converted */
+  status = ml_single_invoke (single, input, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (output2);
+
+  status = ml_single_set_input_conversion (single, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input_f32, &output2);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (input_f32);
+  ml_tensors_data_destroy (output1);
+  ml_tensors_info_destroy (f32_info);
+  ml_tensors_info_destroy (in_info);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test Single with invalid input conversion option.
+ */
+TEST (nnstreamer_capi_singleshot, set_input_conversion_02_n)
+{
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  ml_single_h single;
+  ml_option_h option;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *test_model = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_set_input_conversion (NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  ml_option_create (&option);
+  ml_option_set (option, "scale", g_strdup ("-1.0"), g_free);
+  status = ml_single_set_input_conversion (single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_option_destroy (option);
+
+  ml_option_create (&option);
+  ml_option_set (option, "bfloat16", g_strdup ("maybe"), g_free);
+  status = ml_single_set_input_conversion (single, option);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_option_destroy (option);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Internal function to get the value of memory statistics.
+ */
+static size_t
+_get_memory_stat (const char *key)
+{
+  ml_information_h stats;
+  size_t *value = NULL;
+  size_t ret = 0;
+
+  if (ml_api_get_memory_stats (&stats) != ML_ERROR_NONE)
+    return 0;
+
+  if (ml_information_get (stats, key, (void **) &value) == ML_ERROR_NONE)
+    ret = *value;
+
+  ml_information_destroy (stats);
+  return ret;
+}
+
+/**
+ * @brief Test to account the output of single-shot and the memory budget.
+ */
+TEST (nnstreamer_capi_singleshot, memory_stats_01_p)
+{
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output = NULL;
+  size_t current, out_size;
+  void *out;
+  int status;
+
+  const gchar *root_path = g_getenv ("MLAPI_SOURCE_ROOT_PATH");
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  g_autofree gchar *test_model = g_build_filename (root_path, "tests",
+      "test_models", "models", "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  current = _get_memory_stat ("single_output.current");
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (output, 0, &out, &out_size);
+  EXPECT_EQ (_get_memory_stat ("single_output.current"), current + out_size);
+
+  ml_tensors_data_destroy (output);
+  EXPECT_EQ (_get_memory_stat ("single_output.current"), current);
+
+  /* fail early if the output exceeds the budget */
+  status = ml_api_set_memory_budget (_get_memory_stat ("current") + 1U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  output = NULL;
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_OUT_OF_MEMORY);
+  EXPECT_TRUE (output == NULL);
+
+  status = ml_api_set_memory_budget (0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
 /**
  * @brief Test ml_option
  */
@@ -4067,6 +4431,41 @@ TEST (nnstreamer_capi_ml_option, test00)
   EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
+/**
+ * @brief Test ml_option with many keys, more than the keys interned.
+ */
+TEST (nnstreamer_capi_ml_option, manyKeys01_p)
+{
+  int status;
+  ml_option_h option;
+  guint i;
+  void *value;
+
+  status = ml_option_create (&option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 512U; i++) {
+    g_autofree gchar *key = g_strdup_printf ("unittest_many_keys_%u", i);
+
+    status = ml_option_set (option, key, GUINT_TO_POINTER (i + 1U), NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  for (i = 0; i < 512U; i++) {
+    g_autofree gchar *key = g_strdup_printf ("unittest_many_keys_%u", i);
+
+    status = ml_option_get (option, key, &value);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (GPOINTER_TO_UINT (value), i + 1U);
+  }
+
+  status = ml_option_get (option, "unittest_many_keys_unknown", &value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_option_destroy (option);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
 /**
  * @brief Test ml_option
  */